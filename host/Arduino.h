@@ -0,0 +1,246 @@
+#pragma once
+/*
+ * Arduino.h (host) — pengganti inti Arduino-ESP32 untuk build host
+ * Cukup untuk meng-compile project_absensi_esp32.ino apa adanya di
+ * Linux / macOS: String, Serial, GPIO, jam (millis / micros /
+ * esp_timer_get_time), ESP, esp_random dan potongan FreeRTOS yang
+ * dipakai sketch (mutex, task, vTaskDelay).
+ * Jam bisa jalan nyata atau manual (host_hal.h: hostClockManual),
+ * task bisa thread sungguhan atau dijalankan sendiri oleh test.
+ * Perilaku mengikuti core ESP32: min/max = std::min/std::max
+ * (tipe argumen harus sama), unsigned long tetap dipakai apa adanya.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define PSTR(x) x
+#define F(x) x
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+#define DEC 10
+#define HEX 16
+
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+
+// ── String (subset yang dipakai sketch) ──────────────
+class String {
+public:
+  String() {}
+  String(const char* c) : _s(c ? c : "") {}
+  String(const std::string& c) : _s(c) {}
+  explicit String(char c) : _s(1, c) {}
+  String(int v, unsigned char base = 10)           { fmt(base == 16 ? "%x" : "%d", v); }
+  String(unsigned v, unsigned char base = 10)      { fmt(base == 16 ? "%x" : "%u", v); }
+  String(long v, unsigned char base = 10)          { fmt(base == 16 ? "%lx" : "%ld", v); }
+  String(unsigned long v, unsigned char base = 10) { fmt(base == 16 ? "%lx" : "%lu", v); }
+  String(long long v)                              { fmt("%lld", v); }
+  String(unsigned long long v)                     { fmt("%llu", v); }
+  String(unsigned char v, unsigned char base = 10) : String((unsigned)v, base) {}
+  String(float v, unsigned char d = 2)             { fmt("%.*f", (int)d, (double)v); }
+  String(double v, unsigned char d = 2)            { fmt("%.*f", (int)d, v); }
+
+  const char* c_str() const  { return _s.c_str(); }
+  unsigned    length() const { return (unsigned)_s.size(); }
+  bool        isEmpty() const { return _s.empty(); }
+  bool        reserve(unsigned n) { _s.reserve(n); return true; }
+  void        clear() { _s.clear(); }
+
+  String& operator+=(const String& o) { _s += o._s; return *this; }
+  String& operator+=(const char* o)   { _s += o; return *this; }
+  String& operator+=(char o)          { _s += o; return *this; }
+  String& operator+=(int o)           { _s += std::to_string(o); return *this; }
+  String& operator+=(unsigned o)      { _s += std::to_string(o); return *this; }
+  String& operator+=(long o)          { _s += std::to_string(o); return *this; }
+  String& operator+=(unsigned long o) { _s += std::to_string(o); return *this; }
+  bool concat(const char* p, unsigned n) { _s.append(p, n); return true; }
+  bool concat(const String& o) { _s += o._s; return true; }
+  bool concat(const char* o)   { _s += o; return true; }
+  bool concat(char o)          { _s += o; return true; }
+
+  char operator[](unsigned i) const { return i < _s.size() ? _s[i] : 0; }
+  char charAt(unsigned i) const     { return (*this)[i]; }
+  bool operator==(const char* o) const   { return _s == o; }
+  bool operator==(const String& o) const { return _s == o._s; }
+  bool operator!=(const char* o) const   { return _s != o; }
+  bool operator!=(const String& o) const { return _s != o._s; }
+  bool operator<(const String& o) const  { return _s < o._s; }
+  bool equals(const char* o) const       { return _s == o; }
+
+  int indexOf(char c, unsigned from = 0) const        { return pos(_s.find(c, from)); }
+  int indexOf(const char* x, unsigned from = 0) const { return pos(_s.find(x, from)); }
+  int indexOf(const String& x, unsigned from = 0) const { return indexOf(x.c_str(), from); }
+  int lastIndexOf(char c) const { return pos(_s.rfind(c)); }
+  bool startsWith(const char* p) const   { return _s.rfind(p, 0) == 0; }
+  bool startsWith(const String& p) const { return startsWith(p.c_str()); }
+  bool endsWith(const char* p) const {
+    size_t n = strlen(p);
+    return _s.size() >= n && _s.compare(_s.size() - n, n, p) == 0;
+  }
+  bool endsWith(const String& p) const { return endsWith(p.c_str()); }
+  String substring(unsigned a) const { return a >= _s.size() ? String() : String(_s.substr(a)); }
+  String substring(unsigned a, unsigned b) const {
+    if (a > b) std::swap(a, b);
+    return a >= _s.size() ? String() : String(_s.substr(a, b - a));
+  }
+  long   toInt() const   { return atol(_s.c_str()); }
+  double toFloat() const { return atof(_s.c_str()); }
+  void toUpperCase() { for (char& c : _s) c = (char)toupper((unsigned char)c); }
+  void toLowerCase() { for (char& c : _s) c = (char)tolower((unsigned char)c); }
+  void trim() {
+    size_t a = _s.find_first_not_of(" \t\r\n");
+    size_t b = _s.find_last_not_of(" \t\r\n");
+    _s = a == std::string::npos ? std::string() : _s.substr(a, b - a + 1);
+  }
+
+  const std::string& std() const { return _s; }
+
+private:
+  template <class T> void fmt(const char* f, T v) {
+    char b[48]; snprintf(b, sizeof(b), f, v); _s = b;
+  }
+  template <class T> void fmt(const char* f, int d, T v) {
+    char b[64]; snprintf(b, sizeof(b), f, d, v); _s = b;
+  }
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+
+  std::string _s;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b)   { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b)   { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b)          { String r(a); r += b; return r; }
+
+// ── Print / Stream / Serial ──────────────────────────
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t* buf, size_t n) = 0;
+  size_t write(const char* s)            { return write((const uint8_t*)s, strlen(s)); }
+  size_t write(const char* s, size_t n)  { return write((const uint8_t*)s, n); }
+  size_t print(const char* s)            { return write(s); }
+  size_t print(const String& s)          { return write(s.c_str()); }
+  size_t print(char c)                   { return write((uint8_t)c); }
+  size_t print(long v, int base = DEC)   { return print(String(v, (unsigned char)base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+  size_t print(int v, int base = DEC)    { return print((long)v, base); }
+  size_t print(unsigned v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(double v, int d = 2)      { return print(String(v, (unsigned char)d)); }
+  size_t println()                       { return write("\r\n"); }
+  template <class T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  template <class T> size_t println(const T& v, int b) { size_t n = print(v, b); return n + println(); }
+  size_t printf(const char* f, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+  virtual void flush() {}
+  size_t readBytes(uint8_t* buf, size_t n) {
+    size_t i = 0;
+    for (int c; i < n && (c = read()) >= 0; i++) buf[i] = (uint8_t)c;
+    return i;
+  }
+  size_t readBytes(char* buf, size_t n) { return readBytes((uint8_t*)buf, n); }
+  void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  using Print::write;
+  size_t write(const uint8_t* buf, size_t n) override;
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+// ── Jam, GPIO, acak ──────────────────────────────────
+int64_t       esp_timer_get_time();
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalPinToInterrupt(int pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+void tone(uint8_t pin, unsigned int freq, unsigned long ms = 0);
+void noTone(uint8_t pin);
+
+uint32_t esp_random();
+long random(long hi);
+long random(long lo, long hi);
+void randomSeed(unsigned long seed);
+
+// ── ESP ──────────────────────────────────────────────
+class EspClass {
+public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getHeapSize();
+  uint64_t getEfuseMac();
+  [[noreturn]] void restart();
+};
+extern EspClass ESP;
+
+// ── FreeRTOS (subset) ────────────────────────────────
+typedef void*    TaskHandle_t;
+typedef void*    SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define portMAX_DELAY    ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack,
+                                   void* arg, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xPortGetCoreID();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m);
+
+#include "host_hal.h"
@@ -0,0 +1,120 @@
+#pragma once
+/*
+ * ArduinoJson.h (host) — subset baca-saja ArduinoJson v7
+ * Yang dipakai sketch: JsonDocument, deserializeJson() dari File atau
+ * buffer, doc["k"] | default, as<JsonArray>() dan iterasi JsonObject.
+ * Parser rekursif biasa (batas sarang 10 seperti default library);
+ * tidak ada serializeJson — sketch menulis JSON lewat JsonBuf.
+ */
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+struct JsonNode {
+  enum Type : uint8_t { Null, Bool, Num, Str, Arr, Obj } t = Null;
+  bool        b = false;
+  double      num = 0;
+  std::string s;
+  std::vector<JsonNode>                           arr;
+  std::vector<std::pair<std::string, JsonNode>>   obj;
+};
+
+class JsonArray;
+
+class JsonVariant {
+public:
+  JsonVariant(const JsonNode* n = nullptr) : _n(n) {}
+
+  JsonVariant operator[](const char* k) const {
+    if (_n && _n->t == JsonNode::Obj)
+      for (auto& kv : _n->obj) if (kv.first == k) return JsonVariant(&kv.second);
+    return JsonVariant();
+  }
+  JsonVariant operator[](size_t i) const {
+    return _n && _n->t == JsonNode::Arr && i < _n->arr.size() ? JsonVariant(&_n->arr[i]) : JsonVariant();
+  }
+
+  const char* operator|(const char* d) const { return _n && _n->t == JsonNode::Str ? _n->s.c_str() : d; }
+  template <class T, class = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  T operator|(T d) const {
+    if (!_n) return d;
+    if (_n->t == JsonNode::Num)  return (T)_n->num;
+    if (_n->t == JsonNode::Bool) return (T)_n->b;
+    return d;
+  }
+
+  template <class T> T as() const;
+  bool isNull() const { return !_n || _n->t == JsonNode::Null; }
+  size_t size() const {
+    if (!_n) return 0;
+    return _n->t == JsonNode::Arr ? _n->arr.size() : _n->t == JsonNode::Obj ? _n->obj.size() : 0;
+  }
+
+protected:
+  const JsonNode* _n;
+};
+
+typedef JsonVariant JsonObject;
+
+class JsonArray : public JsonVariant {
+public:
+  using JsonVariant::JsonVariant;
+  struct iterator {
+    const JsonNode* p;
+    JsonObject operator*() const { return JsonObject(p); }
+    iterator& operator++() { ++p; return *this; }
+    bool operator!=(const iterator& o) const { return p != o.p; }
+  };
+  iterator begin() const { return { _n && _n->t == JsonNode::Arr ? _n->arr.data() : nullptr }; }
+  iterator end() const {
+    return { _n && _n->t == JsonNode::Arr ? _n->arr.data() + _n->arr.size() : nullptr };
+  }
+};
+
+template <> inline JsonArray  JsonVariant::as<JsonArray>() const  { return JsonArray(_n); }
+template <> inline JsonObject JsonVariant::as<JsonObject>() const { return JsonObject(_n); }
+
+class JsonDocument {
+public:
+  JsonVariant operator[](const char* k) const { return JsonVariant(&_root)[k]; }
+  JsonVariant operator[](size_t i) const { return JsonVariant(&_root)[i]; }
+  template <class T> T as() const { return JsonVariant(&_root).as<T>(); }
+  void clear() { _root = JsonNode(); }
+  JsonNode& root() { return _root; }
+
+private:
+  JsonNode _root;
+};
+
+class DeserializationError {
+public:
+  enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+  DeserializationError(Code c = Ok) : _c(c) {}
+  explicit operator bool() const { return _c != Ok; }
+  Code code() const { return _c; }
+  const char* c_str() const {
+    static const char* const names[] = { "Ok", "EmptyInput", "IncompleteInput",
+                                         "InvalidInput", "NoMemory", "TooDeep" };
+    return names[_c];
+  }
+
+private:
+  Code _c;
+};
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* json, size_t len);
+DeserializationError deserializeJson(JsonDocument& doc, Stream& in);
+inline DeserializationError deserializeJson(JsonDocument& doc, const uint8_t* json, size_t len) {
+  return deserializeJson(doc, (const char*)json, len);
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, uint8_t* json, size_t len) {
+  return deserializeJson(doc, (const char*)json, len);
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* json) {
+  return deserializeJson(doc, json, strlen(json));
+}
+inline DeserializationError deserializeJson(JsonDocument& doc, const String& json) {
+  return deserializeJson(doc, json.c_str(), json.length());
+}
@@ -0,0 +1,19 @@
+#pragma once
+/*
+ * DNSServer.h (host) — DNS captive palsu: tidak mendengar di port 53,
+ * hanya menghitung processNextRequest() (hostDnsPolls) supaya test bisa
+ * memastikan DNS tetap dilayani selama ada pekerjaan lain di task net.
+ */
+#include <WiFi.h>
+
+enum class DNSReplyCode { NoError = 0, NonExistentDomain = 3 };
+
+class DNSServer {
+public:
+  bool start(uint16_t port, const char* domain, const IPAddress& ip) { _on = true; return true; }
+  void stop() { _on = false; }
+  void setErrorReplyCode(DNSReplyCode) {}
+  void processNextRequest() { if (_on) hostDnsPolls++; }
+private:
+  bool _on = false;
+};
@@ -0,0 +1,78 @@
+#pragma once
+/*
+ * LittleFS.h (host) — LittleFS palsu di atas direktori host
+ * Path "/log/00000001.bin" = hostFsRoot + path. Tiap write langsung
+ * ke file OS (tanpa buffer), jadi isi direktori pada saat "mati
+ * listrik" (HostFsFault, host_hal.h) sama dengan isi flash di titik
+ * itu. Mode buka mengikuti VFS ESP32: "r", "r+", "w", "w+", "a", "a+".
+ * File::name() = nama tanpa direktori (core 2.x), path() = lengkap.
+ */
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FileImpl;
+
+class File : public Stream {
+public:
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> p) : _p(p) {}
+
+  using Print::write;
+  size_t write(const uint8_t* buf, size_t n) override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t read(uint8_t* buf, size_t n);
+  int    read() override;
+  int    peek() override;
+  int    available() override;
+  void   flush() override {}
+  bool   seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void   close();
+  explicit operator bool() const;
+  const char* name() const;
+  const char* path() const;
+  bool   isDirectory() const;
+  File   openNextFile(const char* mode = "r");
+  void   rewindDirectory();
+
+private:
+  std::shared_ptr<FileImpl> _p;
+};
+
+class LittleFSFS {
+public:
+  bool   begin(bool formatOnFail = false, const char* base = "/littlefs",
+               uint8_t maxOpen = 10, const char* label = "spiffs");
+  void   end() {}
+  bool   format();
+  File   open(const char* path, const char* mode = "r", bool create = false);
+  File   open(const String& path, const char* mode = "r", bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool   exists(const char* path);
+  bool   exists(const String& path) { return exists(path.c_str()); }
+  bool   remove(const char* path);
+  bool   remove(const String& path) { return remove(path.c_str()); }
+  bool   rename(const char* from, const char* to);
+  bool   rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+  bool   mkdir(const char* path);
+  bool   mkdir(const String& path) { return mkdir(path.c_str()); }
+  bool   rmdir(const char* path);
+  bool   rmdir(const String& path) { return rmdir(path.c_str()); }
+  size_t totalBytes();
+  size_t usedBytes();
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+extern fs::LittleFSFS LittleFS;
@@ -0,0 +1,45 @@
+#pragma once
+/*
+ * MFRC522.h (host) — pembaca RC522 palsu
+ * Kartu datang dari antrean hostCardTap(): PICC_IsNewCardPresent()
+ * true selama antrean berisi, PICC_ReadCardSerial() mengambil satu
+ * ke uid. Register ditulis / dibaca ke array (mode IRQ tidak dipakai).
+ */
+#include <Arduino.h>
+
+class MFRC522 {
+public:
+  enum PCD_Register : byte {
+    CommandReg = 0x01 << 1, CommIEnReg = 0x02 << 1, DivIEnReg = 0x03 << 1,
+    ComIrqReg = 0x04 << 1, DivIrqReg = 0x05 << 1, FIFODataReg = 0x09 << 1,
+    FIFOLevelReg = 0x0A << 1, BitFramingReg = 0x0D << 1, RFCfgReg = 0x26 << 1
+  };
+  enum PCD_Command  : byte { PCD_Idle = 0x00, PCD_Transceive = 0x0C };
+  enum PICC_Command : byte { PICC_CMD_REQA = 0x26 };
+  enum StatusCode   : byte { STATUS_OK, STATUS_ERROR, STATUS_TIMEOUT };
+  enum PCD_RxGain   : byte { RxGain_max = 0x07 << 4 };
+
+  typedef struct {
+    byte size;
+    byte uidByte[10];
+    byte sak;
+  } Uid;
+  Uid uid;
+
+  MFRC522(byte ss, byte rst) { memset(&uid, 0, sizeof(uid)); memset(_reg, 0, sizeof(_reg)); }
+
+  void PCD_Init() {}
+  bool PICC_IsNewCardPresent();
+  bool PICC_ReadCardSerial();
+  StatusCode PICC_HaltA() { return STATUS_OK; }
+  void PCD_StopCrypto1() {}
+  void PCD_WriteRegister(PCD_Register r, byte v) { _reg[(r >> 1) & 0x3F] = v; }
+  byte PCD_ReadRegister(PCD_Register r) { return _reg[(r >> 1) & 0x3F]; }
+  void PCD_SetRegisterBitMask(PCD_Register r, byte m)   { PCD_WriteRegister(r, PCD_ReadRegister(r) | m); }
+  void PCD_ClearRegisterBitMask(PCD_Register r, byte m) { PCD_WriteRegister(r, PCD_ReadRegister(r) & ~m); }
+  byte PCD_GetAntennaGain() { return RxGain_max; }
+  void PCD_SetAntennaGain(byte) {}
+
+private:
+  byte _reg[64];
+};
@@ -0,0 +1,79 @@
+#pragma once
+/*
+ * U8g2lib.h (host) — OLED 128x64 palsu dengan framebuffer sungguhan
+ * Primitif gambar menulis ke buffer berformat sama dengan U8g2 mode
+ * _F_ (baris tile 8 px, 1 byte = 8 pixel vertikal), jadi FrameDiff
+ * bekerja seperti di papan. Font diganti glyph kotak-kotak semu
+ * berukuran sama (lebar tetap dari nama font) — cukup untuk mengukur
+ * tile yang berubah. updateDisplayArea() / sendBuffer() menyalin ke
+ * "panel" dan menghitung byte yang dikirim (hostOled).
+ */
+#include <Arduino.h>
+
+#define U8G2_R0        0
+#define U8X8_PIN_NONE  255
+#define U8G2_DRAW_UPPER_RIGHT 0x01
+#define U8G2_DRAW_UPPER_LEFT  0x02
+#define U8G2_DRAW_LOWER_LEFT  0x04
+#define U8G2_DRAW_LOWER_RIGHT 0x08
+#define U8G2_DRAW_ALL         0x0F
+
+// Font palsu: { lebar glyph, tinggi di atas baseline, di bawah baseline }
+extern const uint8_t u8g2_font_4x6_tf[], u8g2_font_5x7_tf[], u8g2_font_6x10_tf[],
+                     u8g2_font_7x13_tf[], u8g2_font_9x15_tf[];
+
+class U8G2 {
+public:
+  static const int W = 128, H = 64;
+
+  bool begin() { clearBuffer(); return true; }
+  void setContrast(uint8_t) {}
+  void setPowerSave(uint8_t) {}
+  void setBusClock(uint32_t) {}
+  void setFont(const uint8_t* f) { _font = f; }
+  void setDrawColor(uint8_t c)   { _color = c; }
+  void setFontMode(uint8_t)      {}
+
+  void clearBuffer() { memset(_buf, 0, sizeof(_buf)); }
+  void sendBuffer();
+  void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+  void updateDisplay() { sendBuffer(); }
+
+  uint8_t* getBufferPtr()         { return _buf; }
+  uint8_t  getBufferTileWidth()   { return W / 8; }
+  uint8_t  getBufferTileHeight()  { return H / 8; }
+  int      getDisplayWidth()      { return W; }
+  int      getDisplayHeight()     { return H; }
+
+  void drawPixel(int x, int y);
+  void drawHLine(int x, int y, int w) { for (int i = 0; i < w; i++) drawPixel(x + i, y); }
+  void drawVLine(int x, int y, int h) { for (int i = 0; i < h; i++) drawPixel(x, y + i); }
+  void drawLine(int x0, int y0, int x1, int y1);
+  void drawBox(int x, int y, int w, int h) { for (int i = 0; i < h; i++) drawHLine(x, y + i, w); }
+  void drawFrame(int x, int y, int w, int h);
+  void drawRBox(int x, int y, int w, int h, int r);
+  void drawRFrame(int x, int y, int w, int h, int r);
+  void drawCircle(int x0, int y0, int r, uint8_t opt = U8G2_DRAW_ALL);
+  void drawDisc(int x0, int y0, int r, uint8_t opt = U8G2_DRAW_ALL);
+  int  drawStr(int x, int y, const char* s);
+  int  getStrWidth(const char* s) { return (int)strlen(s) * (_font ? _font[0] : 6); }
+  int  getAscent()  { return _font ? _font[1] : 8; }
+  int  getDescent() { return _font ? -(int)_font[2] : -2; }
+
+protected:
+  uint8_t        _buf[W * H / 8];
+  const uint8_t* _font  = nullptr;
+  uint8_t        _color = 1;
+};
+
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C(int rotation, int reset = U8X8_PIN_NONE,
+                                     int clock = U8X8_PIN_NONE, int data = U8X8_PIN_NONE) {
+    clearBuffer();
+  }
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2_SH1106_128X64_NONAME_F_HW_I2C {
+  using U8G2_SH1106_128X64_NONAME_F_HW_I2C::U8G2_SH1106_128X64_NONAME_F_HW_I2C;
+};
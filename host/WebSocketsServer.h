@@ -0,0 +1,73 @@
+#pragma once
+/*
+ * WebSocketsServer.h (host) — server WebSocket minimal (RFC 6455)
+ * Antarmuka sama dengan arduinoWebSockets (Markus Sattler) sejauh
+ * yang dipakai sketch: event CONNECTED / TEXT / BIN / DISCONNECTED,
+ * sendTXT / sendBIN lewat WiFiClient::write (menunggu seperti
+ * library aslinya), _clients[n].tcp untuk subclass. Frame terfragmen
+ * dan ekstensi tidak didukung. Port = hostPort(port).
+ */
+#include <WiFi.h>
+#include <string>
+
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+
+typedef enum {
+  WStype_ERROR, WStype_DISCONNECTED, WStype_CONNECTED, WStype_TEXT, WStype_BIN,
+  WStype_FRAGMENT_TEXT_START, WStype_FRAGMENT_BIN_START, WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN, WStype_PING, WStype_PONG
+} WStype_t;
+
+typedef enum { WSC_NOT_CONNECTED, WSC_HEADER, WSC_CONNECTED } WSclientsStatus_t;
+
+struct WSclient_t {
+  uint8_t           num = 0;
+  WSclientsStatus_t status = WSC_NOT_CONNECTED;
+  WiFiClient*       tcp = nullptr;
+  std::string       rx;
+};
+
+class WebSocketsServer {
+public:
+  typedef std::function<void(uint8_t num, WStype_t type, uint8_t* payload, size_t length)> WebSocketServerEvent;
+
+  WebSocketsServer(uint16_t port, const String& origin = "", const String& protocol = "arduino");
+  virtual ~WebSocketsServer();
+
+  void begin();
+  void close();
+  void loop();
+  void onEvent(WebSocketServerEvent cb) { _event = cb; }
+
+  bool sendTXT(uint8_t num, const uint8_t* payload, size_t length = 0, bool headerToPayload = false);
+  bool sendTXT(uint8_t num, const char* payload, size_t length = 0, bool headerToPayload = false) {
+    return sendTXT(num, (const uint8_t*)payload, length ? length : strlen(payload));
+  }
+  bool sendTXT(uint8_t num, String& payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+  bool broadcastTXT(const uint8_t* payload, size_t length = 0, bool headerToPayload = false);
+  bool broadcastTXT(const char* payload, size_t length = 0, bool headerToPayload = false) {
+    return broadcastTXT((const uint8_t*)payload, length ? length : strlen(payload));
+  }
+  bool broadcastTXT(String& payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+  bool sendBIN(uint8_t num, const uint8_t* payload, size_t length, bool headerToPayload = false);
+  bool broadcastBIN(const uint8_t* payload, size_t length, bool headerToPayload = false);
+
+  void      disconnect();
+  void      disconnect(uint8_t num);
+  bool      clientIsConnected(uint8_t num);
+  uint8_t   connectedClients(bool ping = false);
+  IPAddress remoteIP(uint8_t num);
+  void      enableHeartbeat(uint32_t, uint32_t, uint8_t) {}
+
+protected:
+  WSclient_t _clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+private:
+  bool send(uint8_t num, uint8_t opcode, const uint8_t* payload, size_t length);
+  void handshake(WSclient_t& c);
+  void frames(WSclient_t& c);
+  void drop(WSclient_t& c);
+
+  WiFiServer           _srv;
+  WebSocketServerEvent _event;
+};
@@ -0,0 +1,106 @@
+#pragma once
+/*
+ * WiFi.h (host) — WiFi ESP32 palsu, TCP lewat socket OS
+ * AP / STA hanya dicatat (softAPIP 192.168.4.1, status langsung
+ * WL_CONNECTED). WiFiServer mendengar di 127.0.0.1:(hostPortBase +
+ * port); WiFiClient membungkus socket non-blocking seperti lwIP:
+ * read() tidak menunggu, write() menunggu sampai semua terkirim
+ * (maks ~10 × 1 s, sama dengan WiFiClient ESP32), fd() = socket.
+ * Salinan WiFiClient berbagi satu socket.
+ */
+#include <Arduino.h>
+#include <memory>
+
+#define WIFI_OFF    0
+#define WIFI_STA    1
+#define WIFI_AP     2
+#define WIFI_AP_STA 3
+
+typedef enum {
+  WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4, WL_CONNECTION_LOST = 5, WL_DISCONNECTED = 6
+} wl_status_t;
+
+class IPAddress {
+public:
+  IPAddress() : _a(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : _a((uint32_t)a | (uint32_t)b << 8 | (uint32_t)c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t a) : _a(a) {}                 // urutan byte jaringan, seperti ESP32
+  operator uint32_t() const { return _a; }
+  uint8_t operator[](int i) const { return (uint8_t)(_a >> (8 * i)); }
+  bool operator==(const IPAddress& o) const { return _a == o._a; }
+  bool operator!=(const IPAddress& o) const { return _a != o._a; }
+  String toString() const {
+    char b[16];
+    snprintf(b, sizeof(b), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(b);
+  }
+private:
+  uint32_t _a;
+};
+
+class WiFiClass {
+public:
+  bool      mode(int m) { _mode = m; return true; }
+  int       getMode() const { return _mode; }
+  bool      softAP(const char* ssid, const char* pass = nullptr, int ch = 1, int hidden = 0, int max = 4) { return true; }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+  wl_status_t begin(const char* ssid, const char* pass = nullptr) { _sta = true; return status(); }
+  wl_status_t status() { return _sta ? WL_CONNECTED : WL_DISCONNECTED; }
+  IPAddress localIP()     { return IPAddress(127, 0, 0, 1); }
+  IPAddress broadcastIP() { return IPAddress(127, 0, 0, 1); }    // loopback: tanpa broadcast
+  String    macAddress()  { return String("A1:B2:C3:D4:E5:F6"); }
+  void      setSleep(bool) {}
+private:
+  int  _mode = WIFI_OFF;
+  bool _sta  = false;
+};
+extern WiFiClass WiFi;
+
+struct HostSocket;
+
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+
+  using Print::write;
+  size_t  write(const uint8_t* buf, size_t n) override;
+  int     available() override;
+  int     read() override;
+  int     read(uint8_t* buf, size_t n);
+  int     peek() override;
+  uint8_t connected();
+  void    stop();
+  int     setNoDelay(bool on);
+  int     fd() const;
+  IPAddress remoteIP() const;
+  uint16_t  remotePort() const;
+  explicit operator bool() { return connected(); }
+  bool operator==(const WiFiClient& o) const { return _s == o._s; }
+
+private:
+  std::shared_ptr<HostSocket> _s;
+};
+
+class WiFiServer {
+public:
+  explicit WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) : _port(port) {}
+  ~WiFiServer();
+  void       begin(uint16_t port = 0);
+  void       end();
+  void       setNoDelay(bool on) { _noDelay = on; }
+  bool       hasClient();
+  WiFiClient accept();
+  WiFiClient available() { return accept(); }
+  operator bool() const { return _fd >= 0; }
+
+private:
+  uint16_t _port;
+  int      _fd = -1;
+  bool     _noDelay = false;
+};
+
+// Port host untuk port ESP32 (hostPortBase 0 = sama)
+uint16_t hostPort(uint16_t port);
@@ -0,0 +1,36 @@
+#pragma once
+/*
+ * WiFiUdp.h (host) — WiFiUDP di atas socket UDP OS
+ * begin(port) mendengar di 0.0.0.0:port (port UDP apa adanya — tidak
+ * butuh root, dan port balasan peer tetap cocok); paket keluar
+ * dikumpulkan sampai endPacket() lalu dikirim satu datagram.
+ */
+#include <WiFi.h>
+#include <vector>
+
+class WiFiUDP : public Stream {
+public:
+  ~WiFiUDP() { stop(); }
+  uint8_t begin(uint16_t port);
+  void    stop();
+  int     beginPacket(IPAddress ip, uint16_t port);
+  int     beginPacket(const char* host, uint16_t port);
+  using Print::write;
+  size_t  write(const uint8_t* buf, size_t n) override;
+  int     endPacket();
+  int     parsePacket();
+  int     available() override { return (int)(_in.size() - _at); }
+  int     read() override { return _at < _in.size() ? _in[_at++] : -1; }
+  int     read(uint8_t* buf, size_t n);
+  int     read(char* buf, size_t n) { return read((uint8_t*)buf, n); }
+  int     peek() override { return _at < _in.size() ? _in[_at] : -1; }
+  IPAddress remoteIP() const { return _from; }
+  uint16_t  remotePort() const { return _fromPort; }
+
+private:
+  int      _fd = -1;
+  IPAddress _to, _from;
+  uint16_t  _toPort = 0, _fromPort = 0;
+  std::vector<uint8_t> _out, _in;
+  size_t   _at = 0;
+};
@@ -0,0 +1,19 @@
+#pragma once
+/*
+ * Wire.h (host) — bus I2C tanpa perangkat: setiap alamat NACK
+ * (RTC DS3231 dianggap tidak terpasang)
+ */
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool    begin(int sda = -1, int scl = -1, uint32_t freq = 0) { return true; }
+  void    setClock(uint32_t) {}
+  void    beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool stop = true) { return 2; }
+  size_t  write(uint8_t) { return 1; }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  int     available() { return 0; }
+  int     read() { return -1; }
+};
+extern TwoWire Wire;
@@ -0,0 +1,172 @@
+/*
+ * arduino.cpp (host) — implementasi Arduino.h / host_hal.h: jam,
+ * GPIO, Serial, ESP, esp_random, FreeRTOS di atas std::thread.
+ */
+
+#include "Arduino.h"
+#include "esp_system.h"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unistd.h>
+
+HardwareSerial Serial;
+EspClass       ESP;
+
+// ── Jam ──────────────────────────────────────────────
+static std::chrono::steady_clock::time_point clockT0 = std::chrono::steady_clock::now();
+static bool    clockManual = false;
+static int64_t clockUs     = 0;
+static std::mutex clockMu;
+
+static int64_t realUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - clockT0).count();
+}
+
+int64_t hostClockNow() {
+  std::lock_guard<std::mutex> g(clockMu);
+  return clockManual ? clockUs : realUs();
+}
+
+void hostClockManual(bool manual) {
+  std::lock_guard<std::mutex> g(clockMu);
+  if (manual && !clockManual) clockUs = realUs();
+  if (!manual && clockManual) clockT0 = std::chrono::steady_clock::now() - std::chrono::microseconds(clockUs);
+  clockManual = manual;
+}
+
+void hostClockAdvance(int64_t us) {
+  std::lock_guard<std::mutex> g(clockMu);
+  if (clockManual) clockUs += us;
+}
+
+int64_t       esp_timer_get_time() { return hostClockNow(); }
+unsigned long millis()             { return (unsigned long)(hostClockNow() / 1000); }
+unsigned long micros()             { return (unsigned long)hostClockNow(); }
+
+void delay(unsigned long ms) {
+  if (clockManual) hostClockAdvance((int64_t)ms * 1000);
+  else             std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (clockManual) hostClockAdvance(us);
+  else             std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() { std::this_thread::yield(); }
+
+// ── GPIO ─────────────────────────────────────────────
+static int pinIn[64], pinOut[64];
+static bool pinsReady = false;
+
+static void pinsInit() {
+  if (pinsReady) return;
+  for (int i = 0; i < 64; i++) { pinIn[i] = HIGH; pinOut[i] = LOW; }
+  pinsReady = true;
+}
+
+void pinMode(uint8_t, uint8_t) { pinsInit(); }
+int  digitalRead(uint8_t pin)  { pinsInit(); return pin < 64 ? pinIn[pin] : LOW; }
+void digitalWrite(uint8_t pin, uint8_t v) { pinsInit(); if (pin < 64) pinOut[pin] = v; }
+void hostPinSet(uint8_t pin, int level)   { pinsInit(); if (pin < 64) pinIn[pin] = level; }
+int  hostPinGet(uint8_t pin)              { pinsInit(); return pin < 64 ? pinOut[pin] : LOW; }
+int  digitalPinToInterrupt(int pin)       { return pin; }
+void attachInterrupt(uint8_t, void (*)(), int) {}
+void detachInterrupt(uint8_t) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+void noTone(uint8_t) {}
+
+// ── Acak ─────────────────────────────────────────────
+static std::mt19937 rng(1);
+static std::mutex   rngMu;
+
+void hostSeed(uint32_t seed) { std::lock_guard<std::mutex> g(rngMu); rng.seed(seed); }
+uint32_t esp_random()        { std::lock_guard<std::mutex> g(rngMu); return rng(); }
+long random(long hi)         { return hi > 0 ? (long)(esp_random() % (unsigned long)hi) : 0; }
+long random(long lo, long hi){ return hi > lo ? lo + random(hi - lo) : lo; }
+void randomSeed(unsigned long seed) { hostSeed((uint32_t)seed); }
+
+// ── Serial ───────────────────────────────────────────
+static bool     serialQuiet = false;
+static uint64_t serialBytes = 0;
+
+void     hostSerialQuiet(bool quiet) { serialQuiet = quiet; }
+uint64_t hostSerialBytes()           { return serialBytes; }
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+  serialBytes += n;
+  if (!serialQuiet) fwrite(buf, 1, n, stdout);
+  return n;
+}
+
+size_t Print::printf(const char* f, ...) {
+  char b[256];
+  va_list ap;
+  va_start(ap, f);
+  int n = vsnprintf(b, sizeof(b), f, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  if ((size_t)n < sizeof(b)) return write((const uint8_t*)b, n);
+  std::string big(n + 1, '\0');
+  va_start(ap, f);
+  vsnprintf(&big[0], big.size(), f, ap);
+  va_end(ap);
+  return write((const uint8_t*)big.data(), n);
+}
+
+// ── ESP ──────────────────────────────────────────────
+static uint32_t heapFree = 200 * 1024;
+static uint64_t efuseMac = 0x0000A1B2C3D4E5F6ULL;
+
+void hostHeap(uint32_t freeBytes) { heapFree = freeBytes; }
+void hostMac(uint64_t mac)        { efuseMac = mac; }
+
+uint32_t EspClass::getFreeHeap()     { return heapFree; }
+uint32_t EspClass::getMinFreeHeap()  { return heapFree; }
+uint32_t EspClass::getMaxAllocHeap() { return heapFree; }
+uint32_t EspClass::getHeapSize()     { return 320 * 1024; }
+uint64_t EspClass::getEfuseMac()     { return efuseMac; }
+
+void EspClass::restart() {
+  fflush(stdout);
+  _exit(0);
+}
+
+esp_reset_reason_t esp_reset_reason() { return ESP_RST_POWERON; }
+
+// ── FreeRTOS ─────────────────────────────────────────
+static bool tasksThreaded = true;
+static int  taskCount     = 0;
+
+void hostTasksThreaded(bool threaded) { tasksThreaded = threaded; }
+int  hostTaskCount()                  { return taskCount; }
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* arg,
+                                   UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  taskCount++;
+  if (handle) *handle = nullptr;
+  if (tasksThreaded) std::thread(fn, arg).detach();
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks * portTICK_PERIOD_MS); }
+
+BaseType_t xPortGetCoreID() { return 1; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::timed_mutex(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t ticks) {
+  std::timed_mutex* mu = (std::timed_mutex*)m;
+  if (ticks == portMAX_DELAY) { mu->lock(); return pdTRUE; }
+  return mu->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m) {
+  ((std::timed_mutex*)m)->unlock();
+  return pdTRUE;
+}
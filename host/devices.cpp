@@ -0,0 +1,43 @@
+/*
+ * devices.cpp (host) — SPI / I2C tanpa perangkat, antrean kartu RFID
+ */
+
+#include "MFRC522.h"
+#include "SPI.h"
+#include "Wire.h"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+SPIClass SPI;
+TwoWire  Wire;
+
+static std::mutex                        cardMx;
+static std::deque<std::vector<uint8_t>>  cards;
+
+void hostCardTap(const uint8_t* uid, uint8_t len) {
+  std::lock_guard<std::mutex> g(cardMx);
+  cards.emplace_back(uid, uid + std::min<uint8_t>(len, 10));
+}
+
+int hostCardsPending() {
+  std::lock_guard<std::mutex> g(cardMx);
+  return (int)cards.size();
+}
+
+bool MFRC522::PICC_IsNewCardPresent() {
+  std::lock_guard<std::mutex> g(cardMx);
+  return !cards.empty();
+}
+
+bool MFRC522::PICC_ReadCardSerial() {
+  std::lock_guard<std::mutex> g(cardMx);
+  if (cards.empty()) return false;
+  const std::vector<uint8_t>& c = cards.front();
+  uid.size = (byte)c.size();
+  memcpy(uid.uidByte, c.data(), c.size());
+  uid.sak = 0x08;
+  cards.pop_front();
+  return true;
+}
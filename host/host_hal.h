@@ -0,0 +1,81 @@
+#pragma once
+/*
+ * host_hal.h — Kendali perangkat palsu build host (test / benchmark)
+ * Semua default meniru papan sungguhan yang baru dinyalakan:
+ * jam nyata, task = thread, tombol tidak ditekan, tanpa kartu,
+ * flash kosong di direktori hostFsRoot.
+ *
+ *   jam     : hostClockManual(true) → millis()/micros() hanya maju
+ *             lewat hostClockAdvance() / delay() / vTaskDelay()
+ *   task    : hostTasksThreaded(false) → xTaskCreatePinnedToCore
+ *             hanya dicatat; test memanggil putaran task sendiri
+ *   RFID    : hostCardTap() → kartu berikutnya untuk MFRC522
+ *   tombol  : hostPinSet(pin, LOW) = ditekan (INPUT_PULLUP)
+ *   flash   : LittleFS di direktori host (hostFsRoot), plus injeksi
+ *             kegagalan — lihat HostFsFault
+ *   OLED    : counter tile / byte yang dikirim U8g2 palsu
+ *   jaringan: HTTP/UDP socket sungguhan di 127.0.0.1, port =
+ *             hostPortBase + port ESP32 (0 = port asli)
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+// ── Jam ──────────────────────────────────────────────
+void    hostClockManual(bool manual);       // mulai dari waktu sekarang
+void    hostClockAdvance(int64_t us);
+int64_t hostClockNow();                      // = esp_timer_get_time()
+
+// ── Task FreeRTOS ────────────────────────────────────
+void hostTasksThreaded(bool threaded);       // default true
+int  hostTaskCount();                        // task yang sudah dibuat sketch
+
+// ── GPIO / papan ─────────────────────────────────────
+void     hostPinSet(uint8_t pin, int level);
+int      hostPinGet(uint8_t pin);            // nilai terakhir digitalWrite
+void     hostHeap(uint32_t freeBytes);       // ESP.getFreeHeap() (default 200 KB)
+void     hostMac(uint64_t mac);              // ESP.getEfuseMac() → id unit
+void     hostSeed(uint32_t seed);            // esp_random()
+void     hostSerialQuiet(bool quiet);        // Serial tidak dicetak ke stdout
+uint64_t hostSerialBytes();
+
+// ── RFID ─────────────────────────────────────────────
+void hostCardTap(const uint8_t* uid, uint8_t len);
+int  hostCardsPending();
+
+// ── Flash (LittleFS) ─────────────────────────────────
+// cutAfterBytes / cutAfterOps >= 0: begitu jatah habis (byte ditulis,
+// atau op ubah: write / remove / rename / mkdir / buka-truncate)
+// proses keluar dengan HOST_POWER_CUT — seperti listrik mati tepat di
+// titik itu; yang sudah ditulis tetap ada di direktori. Dipakai test
+// dengan fork(): anak dipotong, induk memeriksa / boot ulang.
+// full: write mengembalikan 0 (flash penuh), op lain tetap jalan.
+// spaceBytes >= 0: sisa ruang; write yang melebihinya ditulis sebagian
+// (short write), sesudah itu 0 sampai diisi lagi.
+#define HOST_POWER_CUT 77
+
+struct HostFsFault {
+  long cutAfterBytes = -1;
+  long cutAfterOps   = -1;
+  bool full          = false;
+  long spaceBytes    = -1;
+};
+
+extern std::string hostFsRoot;              // default "./littlefs"
+extern HostFsFault hostFsFault;
+extern uint64_t    hostFsWriteBytes, hostFsReadBytes, hostFsOps;
+size_t hostFsUsed();                         // total byte file di hostFsRoot
+
+// ── OLED (U8g2) ──────────────────────────────────────
+struct HostOledStats {
+  uint32_t frames;       // sendBuffer / rangkaian updateDisplayArea
+  uint32_t areas;        // panggilan updateDisplayArea
+  uint64_t tileBytes;    // byte kolom tile yang dikirim ke panel
+};
+extern HostOledStats hostOled;
+const uint8_t* hostOledPanel();              // isi panel (1024 byte, format buffer U8g2)
+
+// ── Jaringan ─────────────────────────────────────────
+extern uint16_t hostPortBase;                // default 0 (port ESP32 apa adanya)
+extern uint32_t hostDnsPolls;                // DNSServer::processNextRequest()
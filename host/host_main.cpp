@@ -0,0 +1,52 @@
+/*
+ * host_main.cpp — sketch absensi sebagai program biasa (simulator)
+ * setup() lalu loop() terus-menerus; task jaringan jalan sebagai
+ * thread, dashboard di http://127.0.0.1:<port-base + 80>/.
+ * Perintah dari stdin:
+ *   tap AA:BB:CC:DD    kartu ditempel
+ *   btn l|r [ms]       tombol kiri / kanan ditekan (default 80 ms)
+ *   quit
+ *
+ * Build: lihat CMakeLists.txt (target absensi_host)
+ *   ./absensi_host [--fs DIR] [--port-base N]
+ */
+
+#include "sketch.cpp"
+
+#include <thread>
+
+static void hostConsole() {
+  char line[128];
+  while (fgets(line, sizeof(line), stdin)) {
+    char cmd[8] = "", arg[64] = "";
+    long ms = 80;
+    if (sscanf(line, "%7s %63s %ld", cmd, arg, &ms) < 1) continue;
+    if (!strcmp(cmd, "quit")) { fflush(stdout); _exit(0); }
+    if (!strcmp(cmd, "tap")) {
+      uint8_t uid[10];
+      uint8_t n = strToUid(arg, uid);
+      if (n) hostCardTap(uid, n);
+      else   fprintf(stderr, "[host] UID tidak valid: %s\n", arg);
+    } else if (!strcmp(cmd, "btn") && (arg[0] == 'l' || arg[0] == 'r')) {
+      uint8_t pin = arg[0] == 'l' ? BTN_LEFT : BTN_RIGHT;
+      hostPinSet(pin, LOW);
+      std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+      hostPinSet(pin, HIGH);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "--fs"))             hostFsRoot = argv[i + 1];
+    else if (!strcmp(argv[i], "--port-base")) hostPortBase = (uint16_t)atoi(argv[i + 1]);
+    else { fprintf(stderr, "pemakaian: %s [--fs DIR] [--port-base N]\n", argv[0]); return 2; }
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+  setup();
+  std::thread(hostConsole).detach();
+  for (;;) {
+    loop();
+    delay(1);
+  }
+}
@@ -0,0 +1,156 @@
+/*
+ * json.cpp (host) — parser deserializeJson()
+ */
+
+#include "ArduinoJson.h"
+
+namespace {
+
+struct Parser {
+  const char* p;
+  const char* end;
+  DeserializationError::Code err = DeserializationError::Ok;
+
+  void ws() { while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++; }
+
+  bool fail(DeserializationError::Code c) {
+    if (!err) err = c;
+    return false;
+  }
+
+  bool lit(const char* w) {
+    size_t n = strlen(w);
+    if ((size_t)(end - p) < n) return fail(DeserializationError::IncompleteInput);
+    if (memcmp(p, w, n)) return fail(DeserializationError::InvalidInput);
+    p += n;
+    return true;
+  }
+
+  static void utf8(std::string& o, uint32_t c) {
+    if (c < 0x80) { o += (char)c; return; }
+    if (c < 0x800) { o += (char)(0xC0 | c >> 6); o += (char)(0x80 | (c & 0x3F)); return; }
+    if (c < 0x10000) {
+      o += (char)(0xE0 | c >> 12);
+    } else {
+      o += (char)(0xF0 | c >> 18);
+      o += (char)(0x80 | (c >> 12 & 0x3F));
+    }
+    o += (char)(0x80 | (c >> 6 & 0x3F));
+    o += (char)(0x80 | (c & 0x3F));
+  }
+
+  bool hex4(uint32_t& v) {
+    if (end - p < 4) return fail(DeserializationError::IncompleteInput);
+    v = 0;
+    for (int i = 0; i < 4; i++, p++) {
+      int d = isdigit((uint8_t)*p) ? *p - '0' : (tolower(*p) >= 'a' && tolower(*p) <= 'f') ? tolower(*p) - 'a' + 10 : -1;
+      if (d < 0) return fail(DeserializationError::InvalidInput);
+      v = v << 4 | d;
+    }
+    return true;
+  }
+
+  bool str(std::string& o) {
+    p++;  // "
+    while (p < end && *p != '"') {
+      if (*p != '\\') { o += *p++; continue; }
+      if (++p >= end) break;
+      char e = *p++;
+      switch (e) {
+        case 'n': o += '\n'; break;
+        case 'r': o += '\r'; break;
+        case 't': o += '\t'; break;
+        case 'b': o += '\b'; break;
+        case 'f': o += '\f'; break;
+        case 'u': {
+          uint32_t c;
+          if (!hex4(c)) return false;
+          if (c >= 0xD800 && c < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+            uint32_t lo;
+            p += 2;
+            if (!hex4(lo)) return false;
+            c = 0x10000 + ((c - 0xD800) << 10) + (lo - 0xDC00);
+          }
+          utf8(o, c);
+          break;
+        }
+        default: o += e;
+      }
+    }
+    if (p >= end) return fail(DeserializationError::IncompleteInput);
+    p++;
+    return true;
+  }
+
+  bool value(JsonNode& n, int depth) {
+    if (depth > 10) return fail(DeserializationError::TooDeep);
+    ws();
+    if (p >= end) return fail(DeserializationError::IncompleteInput);
+    switch (*p) {
+      case '{':
+        n.t = JsonNode::Obj;
+        p++; ws();
+        if (p < end && *p == '}') { p++; return true; }
+        for (;;) {
+          ws();
+          if (p >= end) return fail(DeserializationError::IncompleteInput);
+          if (*p != '"') return fail(DeserializationError::InvalidInput);
+          n.obj.emplace_back();
+          if (!str(n.obj.back().first)) return false;
+          ws();
+          if (p >= end) return fail(DeserializationError::IncompleteInput);
+          if (*p++ != ':') return fail(DeserializationError::InvalidInput);
+          if (!value(n.obj.back().second, depth + 1)) return false;
+          ws();
+          if (p >= end) return fail(DeserializationError::IncompleteInput);
+          if (*p == '}') { p++; return true; }
+          if (*p++ != ',') return fail(DeserializationError::InvalidInput);
+        }
+      case '[':
+        n.t = JsonNode::Arr;
+        p++; ws();
+        if (p < end && *p == ']') { p++; return true; }
+        for (;;) {
+          n.arr.emplace_back();
+          if (!value(n.arr.back(), depth + 1)) return false;
+          ws();
+          if (p >= end) return fail(DeserializationError::IncompleteInput);
+          if (*p == ']') { p++; return true; }
+          if (*p++ != ',') return fail(DeserializationError::InvalidInput);
+        }
+      case '"':
+        n.t = JsonNode::Str;
+        return str(n.s);
+      case 't': n.t = JsonNode::Bool; n.b = true;  return lit("true");
+      case 'f': n.t = JsonNode::Bool; n.b = false; return lit("false");
+      case 'n': n.t = JsonNode::Null;              return lit("null");
+      default: {
+        std::string num;
+        while (p < end && strchr("+-0123456789.eE", *p)) num += *p++;
+        char* q;
+        n.num = strtod(num.c_str(), &q);
+        if (num.empty() || *q) return fail(DeserializationError::InvalidInput);
+        n.t = JsonNode::Num;
+        return true;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+DeserializationError deserializeJson(JsonDocument& doc, const char* json, size_t len) {
+  doc.clear();
+  Parser ps{ json, json + len };
+  ps.ws();
+  if (ps.p >= ps.end) return DeserializationError::EmptyInput;
+  ps.value(doc.root(), 0);
+  if (ps.err) doc.clear();
+  return ps.err;
+}
+
+DeserializationError deserializeJson(JsonDocument& doc, Stream& in) {
+  std::string all;
+  for (int c; (c = in.read()) >= 0;) all += (char)c;
+  return deserializeJson(doc, all.data(), all.size());
+}
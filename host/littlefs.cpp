@@ -0,0 +1,234 @@
+/*
+ * littlefs.cpp (host) — LittleFS palsu: file OS di bawah hostFsRoot,
+ * dengan injeksi mati listrik / flash penuh (HostFsFault)
+ */
+
+#include "LittleFS.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+fs::LittleFSFS LittleFS;
+
+std::string hostFsRoot = "./littlefs";
+HostFsFault hostFsFault;
+uint64_t    hostFsWriteBytes = 0, hostFsReadBytes = 0, hostFsOps = 0;
+
+#define HOST_FS_TOTAL (1408 * 1024UL)   // partisi LittleFS skema default 4 MB
+
+static std::string hostPath(const char* p) {
+  std::string s = hostFsRoot;
+  if (!p || *p != '/') s += '/';
+  if (p) s += p;
+  while (s.size() > 1 && s.back() == '/') s.pop_back();
+  return s;
+}
+
+[[noreturn]] static void powerCut() {
+  fflush(stdout);
+  _exit(HOST_POWER_CUT);
+}
+
+// Satu op ubah (write / remove / rename / mkdir / truncate)
+static void fsOp() {
+  if (hostFsFault.cutAfterOps == 0) powerCut();
+  if (hostFsFault.cutAfterOps > 0) hostFsFault.cutAfterOps--;
+  hostFsOps++;
+}
+
+static size_t usedIn(const std::string& dir, bool blocks) {
+  size_t n = 0;
+  DIR* d = opendir(dir.c_str());
+  if (!d) return 0;
+  for (dirent* e; (e = readdir(d));) {
+    if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+    std::string p = dir + "/" + e->d_name;
+    struct stat st;
+    if (stat(p.c_str(), &st)) continue;
+    if (S_ISDIR(st.st_mode)) n += usedIn(p, blocks) + (blocks ? 4096 : 0);
+    else n += blocks ? (st.st_size + 4095) / 4096 * 4096 : st.st_size;
+  }
+  closedir(d);
+  return n;
+}
+
+size_t hostFsUsed() { return usedIn(hostFsRoot, false); }
+
+namespace fs {
+
+struct FileImpl {
+  int         fd  = -1;
+  DIR*        dir = nullptr;
+  bool        writable = false;
+  std::string path, name;
+  ~FileImpl() {
+    if (fd >= 0) ::close(fd);
+    if (dir) closedir(dir);
+  }
+};
+
+static std::shared_ptr<FileImpl> openImpl(const char* path, const char* mode) {
+  std::string hp = hostPath(path);
+  struct stat st;
+  bool there = !stat(hp.c_str(), &st);
+  auto p = std::make_shared<FileImpl>();
+  p->path = path;
+  const char* slash = strrchr(path, '/');
+  p->name = slash ? slash + 1 : path;
+  if (there && S_ISDIR(st.st_mode)) {
+    if (!(p->dir = opendir(hp.c_str()))) return nullptr;
+    return p;
+  }
+  int flags;
+  bool plus = strchr(mode, '+') != nullptr;
+  switch (mode[0]) {
+    case 'w': flags = (plus ? O_RDWR : O_WRONLY) | O_CREAT | O_TRUNC; break;
+    case 'a': flags = (plus ? O_RDWR : O_WRONLY) | O_CREAT | O_APPEND; break;
+    default:  flags = plus ? O_RDWR : O_RDONLY; break;
+  }
+  if (!there && !(flags & O_CREAT)) return nullptr;
+  if ((flags & O_TRUNC) || !there) fsOp();
+  p->fd = ::open(hp.c_str(), flags, 0644);
+  if (p->fd < 0) return nullptr;
+  p->writable = mode[0] != 'r' || plus;
+  if (flags & O_APPEND) lseek(p->fd, 0, SEEK_END);
+  return p;
+}
+
+size_t File::write(const uint8_t* buf, size_t n) {
+  if (!_p || _p->fd < 0 || !_p->writable || !n) return 0;
+  if (hostFsFault.full || !hostFsFault.spaceBytes) return 0;
+  fsOp();
+  if (hostFsFault.spaceBytes > 0 && (long)n > hostFsFault.spaceBytes) n = hostFsFault.spaceBytes;
+  long budget = hostFsFault.cutAfterBytes;
+  if (budget >= 0 && (long)n > budget) {
+    if (budget > 0 && ::write(_p->fd, buf, budget) < 0) {}
+    powerCut();
+  }
+  ssize_t k = ::write(_p->fd, buf, n);
+  if (k < 0) return 0;
+  if (budget >= 0) hostFsFault.cutAfterBytes -= k;
+  if (hostFsFault.spaceBytes > 0) hostFsFault.spaceBytes -= k;
+  hostFsWriteBytes += k;
+  return (size_t)k;
+}
+
+size_t File::read(uint8_t* buf, size_t n) {
+  if (!_p || _p->fd < 0) return 0;
+  ssize_t k = ::read(_p->fd, buf, n);
+  if (k < 0) return 0;
+  hostFsReadBytes += k;
+  return (size_t)k;
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+  int c = read();
+  if (c >= 0) lseek(_p->fd, -1, SEEK_CUR);
+  return c;
+}
+
+int File::available() {
+  if (!_p || _p->fd < 0) return 0;
+  return (int)(size() - position());
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_p || _p->fd < 0) return false;
+  int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+  return lseek(_p->fd, (off_t)pos, whence) >= 0;
+}
+
+size_t File::position() const {
+  if (!_p || _p->fd < 0) return 0;
+  off_t o = lseek(_p->fd, 0, SEEK_CUR);
+  return o < 0 ? 0 : (size_t)o;
+}
+
+size_t File::size() const {
+  struct stat st;
+  if (!_p || _p->fd < 0 || fstat(_p->fd, &st)) return 0;
+  return (size_t)st.st_size;
+}
+
+void File::close() { _p.reset(); }
+
+File::operator bool() const { return _p && (_p->fd >= 0 || _p->dir); }
+
+const char* File::name() const { return _p ? _p->name.c_str() : ""; }
+const char* File::path() const { return _p ? _p->path.c_str() : ""; }
+bool File::isDirectory() const { return _p && _p->dir; }
+
+File File::openNextFile(const char* mode) {
+  if (!_p || !_p->dir) return File();
+  for (dirent* e; (e = readdir(_p->dir));) {
+    if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+    std::string child = _p->path;
+    if (child.empty() || child.back() != '/') child += '/';
+    child += e->d_name;
+    auto p = openImpl(child.c_str(), mode);
+    if (p) return File(p);
+  }
+  return File();
+}
+
+void File::rewindDirectory() { if (_p && _p->dir) rewinddir(_p->dir); }
+
+bool LittleFSFS::begin(bool formatOnFail, const char*, uint8_t, const char*) {
+  struct stat st;
+  if (!stat(hostFsRoot.c_str(), &st)) return S_ISDIR(st.st_mode);
+  return formatOnFail && !::mkdir(hostFsRoot.c_str(), 0755);
+}
+
+bool LittleFSFS::format() {
+  std::string cmd = "rm -rf '" + hostFsRoot + "' && mkdir -p '" + hostFsRoot + "'";
+  return system(cmd.c_str()) == 0;
+}
+
+File LittleFSFS::open(const char* path, const char* mode, bool create) {
+  if (create && mode[0] != 'r') {
+    std::string p = path;
+    for (size_t i = p.find('/', 1); i != std::string::npos; i = p.find('/', i + 1))
+      ::mkdir(hostPath(p.substr(0, i).c_str()).c_str(), 0755);
+  }
+  auto p = openImpl(path, mode);
+  return p ? File(p) : File();
+}
+
+bool LittleFSFS::exists(const char* path) {
+  struct stat st;
+  return !stat(hostPath(path).c_str(), &st);
+}
+
+bool LittleFSFS::remove(const char* path) {
+  if (!exists(path)) return false;
+  fsOp();
+  return !unlink(hostPath(path).c_str());
+}
+
+bool LittleFSFS::rename(const char* from, const char* to) {
+  if (!exists(from)) return false;
+  fsOp();
+  return !::rename(hostPath(from).c_str(), hostPath(to).c_str());
+}
+
+bool LittleFSFS::mkdir(const char* path) {
+  fsOp();
+  return !::mkdir(hostPath(path).c_str(), 0755);
+}
+
+bool LittleFSFS::rmdir(const char* path) {
+  fsOp();
+  return !::rmdir(hostPath(path).c_str());
+}
+
+size_t LittleFSFS::totalBytes() { return HOST_FS_TOTAL; }
+size_t LittleFSFS::usedBytes()  { return usedIn(hostFsRoot, true); }
+
+}  // namespace fs
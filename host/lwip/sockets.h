@@ -0,0 +1,10 @@
+#pragma once
+/*
+ * lwip/sockets.h (host) — socket BSD milik OS (select, fd_set, ...)
+ */
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
@@ -0,0 +1,105 @@
+/*
+ * u8g2.cpp (host) — gambar ke framebuffer U8G2 palsu, salin ke panel
+ */
+
+#include "U8g2lib.h"
+
+const uint8_t u8g2_font_4x6_tf[]  = { 4, 5, 1 };
+const uint8_t u8g2_font_5x7_tf[]  = { 5, 6, 1 };
+const uint8_t u8g2_font_6x10_tf[] = { 6, 7, 2 };
+const uint8_t u8g2_font_7x13_tf[] = { 7, 9, 2 };
+const uint8_t u8g2_font_9x15_tf[] = { 9, 10, 3 };
+
+HostOledStats hostOled = { 0, 0, 0 };
+static uint8_t panel[U8G2::W * U8G2::H / 8];
+
+const uint8_t* hostOledPanel() { return panel; }
+
+void U8G2::sendBuffer() {
+  memcpy(panel, _buf, sizeof(panel));
+  hostOled.frames++;
+  hostOled.areas++;
+  hostOled.tileBytes += sizeof(panel);
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+  for (int r = ty; r < ty + th && r < H / 8; r++) {
+    int from = r * W + tx * 8, n = std::min(tw * 8, W - tx * 8);
+    if (n > 0) memcpy(panel + from, _buf + from, n);
+  }
+  hostOled.areas++;
+  hostOled.tileBytes += (uint32_t)tw * th * 8;
+}
+
+void U8G2::drawPixel(int x, int y) {
+  if (x < 0 || y < 0 || x >= W || y >= H) return;
+  uint8_t& b = _buf[(y / 8) * W + x];
+  uint8_t  m = (uint8_t)(1 << (y & 7));
+  if (_color == 0)      b &= ~m;
+  else if (_color == 2) b ^= m;
+  else                  b |= m;
+}
+
+void U8G2::drawLine(int x0, int y0, int x1, int y1) {
+  int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  for (int err = dx + dy;;) {
+    drawPixel(x0, y0);
+    if (x0 == x1 && y0 == y1) break;
+    int e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void U8G2::drawFrame(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0) return;
+  drawHLine(x, y, w); drawHLine(x, y + h - 1, w);
+  drawVLine(x, y + 1, h - 2); drawVLine(x + w - 1, y + 1, h - 2);
+}
+
+void U8G2::drawRBox(int x, int y, int w, int h, int r) {
+  for (int i = 0; i < h; i++) {
+    int in = 0;
+    if (i < r)          in = r - i;
+    else if (i >= h - r) in = i - (h - r - 1);
+    drawHLine(x + in / 2, y + i, w - in);
+  }
+}
+
+void U8G2::drawRFrame(int x, int y, int w, int h, int r) {
+  if (w <= 2 * r || h <= 2 * r) { drawFrame(x, y, w, h); return; }
+  drawHLine(x + r, y, w - 2 * r); drawHLine(x + r, y + h - 1, w - 2 * r);
+  drawVLine(x, y + r, h - 2 * r); drawVLine(x + w - 1, y + r, h - 2 * r);
+  drawLine(x, y + r - 1, x + r - 1, y);             drawLine(x + w - r, y, x + w - 1, y + r - 1);
+  drawLine(x, y + h - r, x + r - 1, y + h - 1);     drawLine(x + w - r, y + h - 1, x + w - 1, y + h - r);
+}
+
+void U8G2::drawCircle(int x0, int y0, int r, uint8_t) {
+  for (int x = r, y = 0, err = 1 - r; x >= y; y++) {
+    drawPixel(x0 + x, y0 + y); drawPixel(x0 - x, y0 + y); drawPixel(x0 + x, y0 - y); drawPixel(x0 - x, y0 - y);
+    drawPixel(x0 + y, y0 + x); drawPixel(x0 - y, y0 + x); drawPixel(x0 + y, y0 - x); drawPixel(x0 - y, y0 - x);
+    if (err < 0) err += 2 * y + 3;
+    else         { err += 2 * (y - x) + 5; x--; }
+  }
+}
+
+void U8G2::drawDisc(int x0, int y0, int r, uint8_t) {
+  for (int y = -r; y <= r; y++)
+    for (int x = -r; x <= r; x++)
+      if (x * x + y * y <= r * r + r) drawPixel(x0 + x, y0 + y);
+}
+
+// Glyph semu: pola bit dari kode karakter, spasi kosong. y = baseline.
+int U8G2::drawStr(int x, int y, const char* s) {
+  int w = _font ? _font[0] : 6, up = _font ? _font[1] : 8, x0 = x;
+  for (; *s; s++, x += w) {
+    uint8_t c = (uint8_t)*s;
+    if (c == ' ') continue;
+    uint32_t bits = c * 2654435761u;
+    for (int gx = 0; gx < w - 1; gx++)
+      for (int gy = 0; gy < up; gy++)
+        if ((bits >> ((gx * 7 + gy) & 31)) & 1) drawPixel(x + gx, y - up + 1 + gy);
+  }
+  return x - x0;
+}
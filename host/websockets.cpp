@@ -0,0 +1,224 @@
+/*
+ * websockets.cpp (host) — handshake (SHA-1 + base64) dan frame RFC 6455
+ */
+
+#include "WebSocketsServer.h"
+
+#include <strings.h>
+
+// ── SHA-1 / base64 untuk Sec-WebSocket-Accept ────────
+static uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+static void sha1(const std::string& msg, uint8_t out[20]) {
+  uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+  std::string m = msg;
+  uint64_t bits = (uint64_t)msg.size() * 8;
+  m += (char)0x80;
+  while (m.size() % 64 != 56) m += '\0';
+  for (int i = 7; i >= 0; i--) m += (char)(bits >> (8 * i));
+  for (size_t at = 0; at < m.size(); at += 64) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++)
+      w[i] = (uint32_t)(uint8_t)m[at + 4 * i] << 24 | (uint32_t)(uint8_t)m[at + 4 * i + 1] << 16 |
+             (uint32_t)(uint8_t)m[at + 4 * i + 2] << 8 | (uint8_t)m[at + 4 * i + 3];
+    for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20)      { f = (b & c) | (~b & d);          k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d;                   k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else             { f = b ^ c ^ d;                   k = 0xCA62C1D6; }
+      uint32_t t = rol(a, 5) + f + e + k + w[i];
+      e = d; d = c; c = rol(b, 30); b = a; a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for (int i = 0; i < 20; i++) out[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4)));
+}
+
+static std::string base64(const uint8_t* p, size_t n) {
+  static const char T[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string o;
+  for (size_t i = 0; i < n; i += 3) {
+    uint32_t v = p[i] << 16 | (i + 1 < n ? p[i + 1] << 8 : 0) | (i + 2 < n ? p[i + 2] : 0);
+    o += T[v >> 18 & 63];
+    o += T[v >> 12 & 63];
+    o += i + 1 < n ? T[v >> 6 & 63] : '=';
+    o += i + 2 < n ? T[v & 63] : '=';
+  }
+  return o;
+}
+
+// ── Server ───────────────────────────────────────────
+WebSocketsServer::WebSocketsServer(uint16_t port, const String&, const String&) : _srv(port) {
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) _clients[i].num = i;
+}
+
+WebSocketsServer::~WebSocketsServer() { close(); }
+
+void WebSocketsServer::begin() { _srv.begin(); }
+
+void WebSocketsServer::close() {
+  disconnect();
+  _srv.end();
+}
+
+void WebSocketsServer::drop(WSclient_t& c) {
+  bool was = c.status == WSC_CONNECTED;
+  if (c.tcp) { c.tcp->stop(); delete c.tcp; }
+  c.tcp = nullptr;
+  c.status = WSC_NOT_CONNECTED;
+  c.rx.clear();
+  if (was && _event) _event(c.num, WStype_DISCONNECTED, nullptr, 0);
+}
+
+void WebSocketsServer::handshake(WSclient_t& c) {
+  size_t end = c.rx.find("\r\n\r\n");
+  if (end == std::string::npos) {
+    if (c.rx.size() > 4096) drop(c);
+    return;
+  }
+  std::string head = c.rx.substr(0, end), key, url = "/";
+  c.rx.erase(0, end + 4);
+  size_t sp = head.find(' ');
+  if (sp != std::string::npos) url = head.substr(sp + 1, head.find(' ', sp + 1) - sp - 1);
+  for (size_t at = head.find("\r\n"); at != std::string::npos; at = head.find("\r\n", at + 2)) {
+    size_t colon = head.find(':', at + 2), eol = head.find("\r\n", at + 2);
+    if (colon == std::string::npos || (eol != std::string::npos && colon > eol)) continue;
+    if (!strncasecmp(head.c_str() + at + 2, "Sec-WebSocket-Key", colon - at - 2)) {
+      key = head.substr(colon + 1, (eol == std::string::npos ? head.size() : eol) - colon - 1);
+      key.erase(0, key.find_first_not_of(' '));
+    }
+  }
+  if (key.empty()) { drop(c); return; }
+  uint8_t d[20];
+  sha1(key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11", d);
+  std::string rsp = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                    "Sec-WebSocket-Accept: " + base64(d, 20) + "\r\n\r\n";
+  c.tcp->write((const uint8_t*)rsp.data(), rsp.size());
+  c.status = WSC_CONNECTED;
+  if (_event) _event(c.num, WStype_CONNECTED, (uint8_t*)url.c_str(), url.size());
+}
+
+void WebSocketsServer::frames(WSclient_t& c) {
+  while (c.status == WSC_CONNECTED && c.rx.size() >= 2) {
+    const uint8_t* p = (const uint8_t*)c.rx.data();
+    uint8_t op = p[0] & 0x0F;
+    bool masked = p[1] & 0x80;
+    uint64_t len = p[1] & 0x7F;
+    size_t at = 2;
+    if (len == 126) {
+      if (c.rx.size() < 4) return;
+      len = (uint64_t)p[2] << 8 | p[3]; at = 4;
+    } else if (len == 127) {
+      if (c.rx.size() < 10) return;
+      len = 0;
+      for (int i = 0; i < 8; i++) len = len << 8 | p[2 + i];
+      at = 10;
+    }
+    if (len > 65536) { drop(c); return; }
+    size_t need = at + (masked ? 4 : 0) + (size_t)len;
+    if (c.rx.size() < need) return;
+    std::string data = c.rx.substr(at + (masked ? 4 : 0), (size_t)len);
+    if (masked)
+      for (size_t i = 0; i < data.size(); i++) data[i] ^= p[at + (i & 3)];
+    c.rx.erase(0, need);
+    if (op == 0x8) { send(c.num, 0x8, nullptr, 0); drop(c); return; }
+    if (op == 0x9) { send(c.num, 0xA, (const uint8_t*)data.data(), data.size()); continue; }
+    if ((op == 0x1 || op == 0x2) && _event)
+      _event(c.num, op == 0x1 ? WStype_TEXT : WStype_BIN, (uint8_t*)&data[0], data.size());
+  }
+}
+
+void WebSocketsServer::loop() {
+  for (WiFiClient cl = _srv.accept(); cl.fd() >= 0; cl = _srv.accept()) {
+    WSclient_t* free = nullptr;
+    for (WSclient_t& c : _clients) if (c.status == WSC_NOT_CONNECTED) { free = &c; break; }
+    if (!free) { cl.stop(); continue; }
+    free->tcp = new WiFiClient(cl);
+    free->status = WSC_HEADER;
+    free->rx.clear();
+  }
+  for (WSclient_t& c : _clients) {
+    if (c.status == WSC_NOT_CONNECTED) continue;
+    int n = c.tcp->available();
+    if (n > 0) {
+      std::string b(n, '\0');
+      int k = c.tcp->read((uint8_t*)&b[0], n);
+      if (k > 0) c.rx.append(b.data(), k);
+    } else if (!c.tcp->connected()) {
+      drop(c);
+      continue;
+    }
+    if (c.status == WSC_HEADER) handshake(c);
+    if (c.status == WSC_CONNECTED) frames(c);
+  }
+}
+
+bool WebSocketsServer::send(uint8_t num, uint8_t opcode, const uint8_t* payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || _clients[num].status != WSC_CONNECTED) return false;
+  uint8_t h[10];
+  size_t hl = 2;
+  h[0] = 0x80 | opcode;
+  if (length < 126) {
+    h[1] = (uint8_t)length;
+  } else if (length < 65536) {
+    h[1] = 126; h[2] = (uint8_t)(length >> 8); h[3] = (uint8_t)length; hl = 4;
+  } else {
+    h[1] = 127; hl = 10;
+    for (int i = 0; i < 8; i++) h[2 + i] = (uint8_t)((uint64_t)length >> (56 - 8 * i));
+  }
+  std::string f((const char*)h, hl);
+  if (length) f.append((const char*)payload, length);
+  WiFiClient* t = _clients[num].tcp;
+  if (t->write((const uint8_t*)f.data(), f.size()) != f.size()) { drop(_clients[num]); return false; }
+  return true;
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const uint8_t* payload, size_t length, bool) {
+  return send(num, 0x1, payload, length ? length : strlen((const char*)payload));
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t* payload, size_t length, bool) {
+  return send(num, 0x2, payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(const uint8_t* payload, size_t length, bool) {
+  bool ok = true;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+    if (_clients[i].status == WSC_CONNECTED) ok &= sendTXT(i, payload, length);
+  return ok;
+}
+
+bool WebSocketsServer::broadcastBIN(const uint8_t* payload, size_t length, bool) {
+  bool ok = true;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+    if (_clients[i].status == WSC_CONNECTED) ok &= sendBIN(i, payload, length);
+  return ok;
+}
+
+void WebSocketsServer::disconnect() {
+  for (WSclient_t& c : _clients) if (c.status != WSC_NOT_CONNECTED) drop(c);
+}
+
+void WebSocketsServer::disconnect(uint8_t num) {
+  if (num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[num].status != WSC_NOT_CONNECTED) {
+    send(num, 0x8, nullptr, 0);
+    drop(_clients[num]);
+  }
+}
+
+bool WebSocketsServer::clientIsConnected(uint8_t num) {
+  return num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[num].status == WSC_CONNECTED;
+}
+
+uint8_t WebSocketsServer::connectedClients(bool) {
+  uint8_t n = 0;
+  for (WSclient_t& c : _clients) n += c.status == WSC_CONNECTED;
+  return n;
+}
+
+IPAddress WebSocketsServer::remoteIP(uint8_t num) {
+  return num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[num].tcp ? _clients[num].tcp->remoteIP() : IPAddress();
+}
@@ -0,0 +1,211 @@
+/*
+ * wifi.cpp (host) — WiFiClient / WiFiServer / WiFiUDP di atas socket OS
+ */
+
+#include "WiFi.h"
+#include "WiFiUdp.h"
+#include "DNSServer.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+uint16_t  hostPortBase = 0;
+uint32_t  hostDnsPolls = 0;
+
+uint16_t hostPort(uint16_t port) { return (uint16_t)(hostPortBase + port); }
+
+struct HostSocket {
+  int fd;
+  explicit HostSocket(int f) : fd(f) {}
+  ~HostSocket() { if (fd >= 0) ::close(fd); }
+};
+
+static void nonBlocking(int fd) { fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK); }
+
+// ── WiFiClient ───────────────────────────────────────
+WiFiClient::WiFiClient(int fd) : _s(std::make_shared<HostSocket>(fd)) { nonBlocking(fd); }
+
+int WiFiClient::fd() const { return _s ? _s->fd : -1; }
+
+// Seperti WiFiClient ESP32: tunggu socket bisa ditulis (select 1 s,
+// maks 10 kali) sampai semua terkirim
+size_t WiFiClient::write(const uint8_t* buf, size_t n) {
+  size_t done = 0;
+  for (int retry = 0; fd() >= 0 && done < n && retry < 10;) {
+    ssize_t k = ::send(fd(), buf + done, n - done, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (k > 0) { done += k; retry = 0; continue; }
+    if (k < 0 && errno != EAGAIN && errno != EWOULDBLOCK) { stop(); break; }
+    pollfd p = { fd(), POLLOUT, 0 };
+    if (poll(&p, 1, 1000) <= 0) retry++;
+  }
+  return done;
+}
+
+int WiFiClient::available() {
+  int n = 0;
+  if (fd() < 0 || ioctl(fd(), FIONREAD, &n) < 0) return 0;
+  return n;
+}
+
+int WiFiClient::read(uint8_t* buf, size_t n) {
+  if (fd() < 0) return -1;
+  ssize_t k = ::recv(fd(), buf, n, MSG_DONTWAIT);
+  return k > 0 ? (int)k : -1;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::peek() {
+  uint8_t c;
+  return fd() >= 0 && ::recv(fd(), &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (fd() < 0) return 0;
+  uint8_t c;
+  ssize_t k = ::recv(fd(), &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (k > 0 || (k < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) return 1;
+  stop();
+  return 0;
+}
+
+void WiFiClient::stop() {
+  if (!_s || _s->fd < 0) return;
+  ::close(_s->fd);
+  _s->fd = -1;
+}
+
+int WiFiClient::setNoDelay(bool on) {
+  int v = on;
+  return fd() >= 0 ? setsockopt(fd(), IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v)) : -1;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+  sockaddr_in a; socklen_t l = sizeof(a);
+  if (fd() < 0 || getpeername(fd(), (sockaddr*)&a, &l)) return IPAddress();
+  return IPAddress(a.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() const {
+  sockaddr_in a; socklen_t l = sizeof(a);
+  if (fd() < 0 || getpeername(fd(), (sockaddr*)&a, &l)) return 0;
+  return ntohs(a.sin_port);
+}
+
+// ── WiFiServer ───────────────────────────────────────
+WiFiServer::~WiFiServer() { end(); }
+
+void WiFiServer::begin(uint16_t port) {
+  if (port) _port = port;
+  end();
+  _fd = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(hostPort(_port));
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(_fd, (sockaddr*)&a, sizeof(a)) || listen(_fd, 16)) {
+    fprintf(stderr, "[host] port %u tidak bisa dipakai: %s\n", hostPort(_port), strerror(errno));
+    end();
+    return;
+  }
+  nonBlocking(_fd);
+}
+
+void WiFiServer::end() {
+  if (_fd >= 0) ::close(_fd);
+  _fd = -1;
+}
+
+bool WiFiServer::hasClient() {
+  pollfd p = { _fd, POLLIN, 0 };
+  return _fd >= 0 && poll(&p, 1, 0) > 0;
+}
+
+WiFiClient WiFiServer::accept() {
+  if (_fd < 0) return WiFiClient();
+  int c = ::accept(_fd, nullptr, nullptr);
+  if (c < 0) return WiFiClient();
+  WiFiClient cl(c);
+  if (_noDelay) cl.setNoDelay(true);
+  return cl;
+}
+
+// ── WiFiUDP ──────────────────────────────────────────
+uint8_t WiFiUDP::begin(uint16_t port) {
+  stop();
+  _fd = socket(AF_INET, SOCK_DGRAM, 0);
+  int one = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  setsockopt(_fd, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one));
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(port);
+  a.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(_fd, (sockaddr*)&a, sizeof(a))) { stop(); return 0; }
+  nonBlocking(_fd);
+  return 1;
+}
+
+void WiFiUDP::stop() {
+  if (_fd >= 0) ::close(_fd);
+  _fd = -1;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+  _to = ip; _toPort = port;
+  _out.clear();
+  return 1;
+}
+
+int WiFiUDP::beginPacket(const char* host, uint16_t port) {
+  in_addr a;
+  if (!inet_aton(host, &a)) return 0;
+  return beginPacket(IPAddress(a.s_addr), port);
+}
+
+size_t WiFiUDP::write(const uint8_t* buf, size_t n) {
+  _out.insert(_out.end(), buf, buf + n);
+  return n;
+}
+
+int WiFiUDP::endPacket() {
+  if (_fd < 0) return 0;
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(_toPort);
+  a.sin_addr.s_addr = (uint32_t)_to;
+  return sendto(_fd, _out.data(), _out.size(), 0, (sockaddr*)&a, sizeof(a)) == (ssize_t)_out.size();
+}
+
+int WiFiUDP::parsePacket() {
+  if (_fd < 0) return 0;
+  uint8_t b[1500];
+  sockaddr_in a; socklen_t l = sizeof(a);
+  ssize_t k = recvfrom(_fd, b, sizeof(b), MSG_DONTWAIT, (sockaddr*)&a, &l);
+  if (k <= 0) return 0;
+  _in.assign(b, b + k);
+  _at = 0;
+  _from = IPAddress(a.sin_addr.s_addr);
+  _fromPort = ntohs(a.sin_port);
+  return (int)k;
+}
+
+int WiFiUDP::read(uint8_t* buf, size_t n) {
+  size_t k = std::min(n, _in.size() - _at);
+  memcpy(buf, _in.data() + _at, k);
+  _at += k;
+  return (int)k;
+}
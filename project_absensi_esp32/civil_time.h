@@ -0,0 +1,47 @@
+#pragma once
+/*
+ * civil_time.h — Konversi epoch (detik, UTC) ↔ tanggal kalender
+ * Algoritma days_from_civil / civil_from_days (H. Hinnant): tanpa
+ * tabel, tanpa mktime/gmtime, benar untuk seluruh rentang uint32.
+ * Dipakai untuk RTC DS3231 (register BCD) dan kolom waktu CSV.
+ * Tidak bergantung Arduino — bisa di-compile di host.
+ */
+
+#include <stdint.h>
+
+struct CivilTime {
+  uint16_t year;
+  uint8_t  month, day;          // 1..12, 1..31
+  uint8_t  hour, minute, second;
+};
+
+inline int32_t daysFromCivil(int32_t y, uint32_t m, uint32_t d) {
+  y -= m <= 2;
+  int32_t  era = (y >= 0 ? y : y - 399) / 400;
+  uint32_t yoe = (uint32_t)(y - era * 400);
+  uint32_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t)doe - 719468;
+}
+
+inline uint32_t epochOf(const CivilTime& t) {
+  return (uint32_t)daysFromCivil(t.year, t.month, t.day) * 86400UL +
+         t.hour * 3600UL + t.minute * 60UL + t.second;
+}
+
+inline CivilTime civilOf(uint32_t epoch) {
+  CivilTime t;
+  uint32_t days = epoch / 86400, sec = epoch % 86400;
+  t.hour = sec / 3600; t.minute = sec / 60 % 60; t.second = sec % 60;
+
+  uint32_t z   = days + 719468;
+  uint32_t era = z / 146097;
+  uint32_t doe = z - era * 146097;
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  uint32_t mp  = (5 * doy + 2) / 153;
+  t.day   = doy - (153 * mp + 2) / 5 + 1;
+  t.month = mp < 10 ? mp + 3 : mp - 9;
+  t.year  = yoe + era * 400 + (t.month <= 2);
+  return t;
+}
@@ -0,0 +1,108 @@
+#pragma once
+/*
+ * day_summary.h — Rekap absensi harian + cooldown tap per UID
+ *   DaySummary : tabel hash UID → {masuk pertama, keluar terakhir,
+ *                jumlah tap, telat}, O(1) per tap, dikosongkan saat
+ *                ganti hari. first/last = min/max, jadi urutan tap
+ *                (mis. rebuild dari jurnal) tidak berpengaruh.
+ *   TapCooldown: dua generasi bitmap ter-hash; UID yang baru di-tap
+ *                diabaikan selama period..2×period ms tanpa memblok
+ *                UID lain (kecuali tabrakan hash, sesaat).
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "uid_index.h"
+
+struct DayAgg {
+  UidKey   key;
+  uint32_t first, last;  // ts tap pertama / terakhir hari itu
+  uint16_t count;        // 0 = slot kosong
+  uint8_t  late;
+  uint8_t  _pad;
+};
+
+template <uint16_t SLOTS>
+class DaySummary {
+  static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS harus pangkat 2");
+
+public:
+  DaySummary() { clear(0); }
+
+  void clear(uint32_t day) {
+    memset(_e, 0, sizeof(_e));
+    _day = day; _used = 0; _drops = 0;
+  }
+
+  // Return entri UID k setelah tap ts dicatat; nullptr kalau tabel
+  // penuh (dihitung di drops()). Maks SLOTS-1 UID per hari.
+  DayAgg* tap(const UidKey& k, uint32_t ts) {
+    for (uint16_t s = home(k);; s = (s + 1) & MASK) {
+      DayAgg& e = _e[s];
+      if (e.count && e.key != k) continue;
+      if (!e.count) {
+        if (_used + 1 >= SLOTS) { _drops++; return nullptr; }
+        _used++;
+        e.key = k; e.first = e.last = ts; e.late = 0;
+      }
+      if (ts < e.first) e.first = ts;
+      if (ts > e.last)  e.last  = ts;
+      if (e.count < 0xFFFF) e.count++;
+      return &e;
+    }
+  }
+
+  uint32_t day()   const { return _day; }
+  void     setDay(uint32_t day) { _day = day; }
+  uint16_t used()  const { return _used; }
+  uint32_t drops() const { return _drops; }
+
+  // Iterasi slot: entri terisi kalau count != 0
+  static uint16_t slots() { return SLOTS; }
+  DayAgg&       at(uint16_t s)       { return _e[s]; }
+  const DayAgg& at(uint16_t s) const { return _e[s]; }
+
+private:
+  static const uint16_t MASK = SLOTS - 1;
+  static uint16_t home(const UidKey& k) { return (uint16_t)(uidKeyHash(k) & MASK); }
+
+  DayAgg   _e[SLOTS];
+  uint32_t _day;         // nomor hari lokal (epoch / 86400), 0 = belum diketahui
+  uint16_t _used;
+  uint32_t _drops;
+};
+
+template <uint16_t BITS>
+class TapCooldown {
+  static_assert((BITS & (BITS - 1)) == 0 && BITS >= 32, "BITS harus pangkat 2, >= 32");
+
+public:
+  explicit TapCooldown(uint32_t periodMs) : _period(periodMs), _since(0), _cur(0) {
+    memset(_g, 0, sizeof(_g));
+  }
+
+  // true = UID k masih cooldown (tap diabaikan). Tap tetap menandai
+  // generasi berjalan, jadi kartu yang terus ditempel tetap diredam.
+  bool hit(const UidKey& k, uint32_t nowMs) {
+    uint32_t age = nowMs - _since;
+    if (age >= 2 * _period) {
+      memset(_g, 0, sizeof(_g));
+      _since = nowMs;
+    } else if (age >= _period) {
+      _cur ^= 1;
+      memset(_g[_cur], 0, sizeof(_g[_cur]));
+      _since += _period;
+    }
+    uint32_t b = uidKeyHash(k) & (BITS - 1);
+    uint32_t w = b >> 5, m = 1UL << (b & 31);
+    bool seen = ((_g[0][w] | _g[1][w]) & m) != 0;
+    _g[_cur][w] |= m;
+    return seen;
+  }
+
+private:
+  uint32_t _g[2][BITS / 32];
+  uint32_t _period, _since;
+  uint8_t  _cur;
+};
@@ -0,0 +1,65 @@
+#pragma once
+/*
+ * frame_diff.h — Kirim ulang hanya tile OLED yang berubah
+ * Buffer penuh U8g2 (mode _F_) tersusun per baris tile (page 8 px):
+ *   baris ty = TW tile × 8 byte kolom. Frame baru dibandingkan dengan
+ *   salinan frame terakhir yang terkirim; tiap baris yang berubah
+ *   dikirim sebagai rentang tile (updateDisplayArea). Rentang yang
+ *   dipisah celah pendek digabung — satu perintah alamat SH1106 lebih
+ *   mahal daripada beberapa byte kolom.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+template <uint8_t TW, uint8_t TH>
+class FrameDiff {
+public:
+  // Kirim tile (tx..tx+tw-1, ty); dipanggil per rentang yang berubah
+  typedef void (*Send)(uint8_t tx, uint8_t ty, uint8_t tw);
+
+  static const size_t  BYTES   = (size_t)TW * TH * 8;
+  static const uint8_t MIN_GAP = 2;      // celah tile tak berubah yang memisah rentang
+
+  FrameDiff() : _valid(false) {}
+
+  // Isi layar tidak diketahui (mis. setelah begin()) → frame berikut dikirim penuh
+  void invalidate() { _valid = false; }
+
+  // Return jumlah byte data tile yang dikirim
+  size_t flush(const uint8_t* buf, Send send) {
+    size_t sent = 0;
+    for (uint8_t ty = 0; ty < TH; ty++) {
+      int start = -1, lastDirty = -1;
+      for (uint8_t tx = 0; tx < TW; tx++) {
+        if (!tileDirty(buf, tx, ty)) continue;
+        if (start >= 0 && tx - lastDirty > MIN_GAP) {
+          sent += emit(send, start, ty, lastDirty);
+          start = -1;
+        }
+        if (start < 0) start = tx;
+        lastDirty = tx;
+      }
+      if (start >= 0) sent += emit(send, start, ty, lastDirty);
+    }
+    memcpy(_shadow, buf, BYTES);
+    _valid = true;
+    return sent;
+  }
+
+private:
+  bool tileDirty(const uint8_t* buf, uint8_t tx, uint8_t ty) const {
+    size_t at = ((size_t)ty * TW + tx) * 8;
+    return !_valid || memcmp(buf + at, _shadow + at, 8) != 0;
+  }
+
+  static size_t emit(Send send, int from, uint8_t ty, int to) {
+    uint8_t tw = (uint8_t)(to - from + 1);
+    send((uint8_t)from, ty, tw);
+    return (size_t)tw * 8;
+  }
+
+  uint8_t _shadow[BYTES];
+  bool    _valid;
+};
@@ -191,6 +191,11 @@ main{
   height:100%; background:var(--amber);
   transition:width .6s ease;
 }
+.perf{
+  font-family:var(--mono); font-size:9px; color:var(--muted);
+  letter-spacing:1px; margin:-12px 0 20px; min-height:11px;
+  white-space:nowrap; overflow:hidden; text-overflow:ellipsis;
+}
 
 /* ── SECTION ────────────────────────────────────────── */
 .section{ margin-bottom:24px }
@@ -294,6 +299,9 @@ td{ padding:8px 12px; font-size:13px; vertical-align:middle }
   outline:none; transition:border-color .2s;
 }
 .name-inp:focus{ border-color:var(--amber) }
+.hist-inp{ flex:0 1 auto; color-scheme:dark }
+.late-tag{ color:var(--red); font-family:var(--mono); font-size:10px; margin-left:6px }
+.hist-more{ display:flex; justify-content:center; padding:10px }
 
 /* ── LIVE BADGE ─────────────────────────────────────── */
 .live-badge{
@@ -461,10 +469,11 @@ td{ padding:8px 12px; font-size:13px; vertical-align:middle }
     </div>
     <div class="stat-card">
       <div class="stat-lbl">Slot Tersisa</div>
-      <div class="stat-val blue" id="sF">50</div>
+      <div class="stat-val blue" id="sF">-</div>
       <div class="stat-bar"><div class="stat-bar-fill" style="background:var(--blue)" id="sFBar"></div></div>
     </div>
   </div>
+  <div class="perf" id="perf" title="/api/metrics"></div>
 
   <!-- USER TABLE -->
   <div class="section">
@@ -525,6 +534,68 @@ td{ padding:8px 12px; font-size:13px; vertical-align:middle }
     </div>
   </div>
 
+  <!-- REKAP HARI INI (/api/summary) -->
+  <div class="section">
+    <div class="sec-head">
+      <div class="sec-title">
+        <div class="sec-title-bar" style="background:var(--amber)"></div>
+        Rekap Hari Ini <span class="stat-lbl" id="sumInfo"></span>
+      </div>
+      <div class="sec-actions">
+        <button class="btn btn-amber" onclick="summaryLoad()">↺ REFRESH</button>
+      </div>
+    </div>
+    <div class="tbl-wrap">
+      <table>
+        <thead>
+          <tr>
+            <th class="td-num">#</th>
+            <th>NAMA</th>
+            <th>MASUK</th>
+            <th>KELUAR</th>
+            <th>TAP</th>
+          </tr>
+        </thead>
+        <tbody id="sTbody">
+          <tr class="empty-row"><td colspan="5">// belum ada absensi hari ini</td></tr>
+        </tbody>
+      </table>
+    </div>
+  </div>
+
+  <!-- RIWAYAT (jurnal flash, per halaman) -->
+  <div class="section">
+    <div class="sec-head">
+      <div class="sec-title">
+        <div class="sec-title-bar" style="background:var(--blue)"></div>
+        Riwayat
+      </div>
+      <div class="sec-actions">
+        <select class="name-inp hist-inp" id="hUser"><option value="">SEMUA</option></select>
+        <input class="name-inp hist-inp" type="date" id="hDate">
+        <button class="btn btn-amber" onclick="histLoad(true)">⌕ CARI</button>
+      </div>
+    </div>
+    <div class="tbl-wrap">
+      <table>
+        <thead>
+          <tr>
+            <th class="td-num">#</th>
+            <th>NAMA</th>
+            <th>UID</th>
+            <th>WAKTU</th>
+          </tr>
+        </thead>
+        <tbody id="hTbody">
+          <tr class="empty-row"><td colspan="4">// tekan CARI untuk memuat riwayat</td></tr>
+        </tbody>
+      </table>
+      <div class="hist-more" id="hMore" hidden>
+        <button class="btn btn-ghost" onclick="histLoad(false)">▼ LEBIH LAMA</button>
+      </div>
+    </div>
+  </div>
+
 </main>
 
 <div id="toast"></div>
@@ -534,6 +605,27 @@ td{ padding:8px 12px; font-size:13px; vertical-align:middle }
 const HOST = location.hostname;
 let ws, reconnTmr;
 let users = [], logs = [], logViewOffset = 0;
+let maxUsers = 50;   // diperbarui dari status.max
+let pendUsers = [], pendLogs = [];   // daftar yang datang per-part
+let uRev = -1, uEpoch = -1;          // versi daftar user (protokol delta)
+let bootAt = 0;                      // Date.now() saat ESP32 boot (dari status.up)
+let hist = [], histNext = null;      // riwayat /api/logs yang sudah dimuat
+let sumTmr;                          // refresh rekap ditunda sesudah tap
+const USE_BIN = !/[?&]json\b/.test(location.search);   // ?json = paksa teks
+
+// ── WAKTU ────────────────────────────────────────────
+// ts dari ESP32: epoch detik, atau detik sejak boot kalau jam
+// ESP32 belum sinkron (< EPOCH_MIN)
+const EPOCH_MIN = 1700000000;
+const pad2 = n => String(n).padStart(2,'0');
+function fmtTs(ts){
+  if(ts == null) return '';
+  if(ts < EPOCH_MIN)
+    return '+'+pad2(Math.floor(ts/3600))+':'+pad2(Math.floor(ts/60)%60)+':'+pad2(ts%60);
+  const d = new Date(ts*1000);
+  return d.getFullYear()+'-'+pad2(d.getMonth()+1)+'-'+pad2(d.getDate())+' '+
+         pad2(d.getHours())+':'+pad2(d.getMinutes())+':'+pad2(d.getSeconds());
+}
 
 // ── ESC ──────────────────────────────────────────────
 function esc(s){
@@ -544,6 +636,39 @@ function esc(s){
     .replace(/"/g,'&quot;');
 }
 
+// ── MSGPACK ──────────────────────────────────────────
+// Decoder subset MessagePack — pasangan msgpack.h di ESP32
+function mpDecode(b){
+  const dv = new DataView(b.buffer, b.byteOffset, b.byteLength);
+  const td = new TextDecoder();
+  let i = 0;
+  const str = n => { const s = td.decode(b.subarray(i, i+n)); i += n; return s };
+  const arr = n => { const a = []; while(n--) a.push(val()); return a };
+  const map = n => { const o = {}; while(n--){ const k = val(); o[k] = val() } return o };
+  function val(){
+    const t = b[i++];
+    if(t < 0x80)  return t;
+    if(t < 0x90)  return map(t & 15);
+    if(t < 0xa0)  return arr(t & 15);
+    if(t < 0xc0)  return str(t & 31);
+    if(t >= 0xe0) return t - 256;
+    switch(t){
+      case 0xc0: return null;
+      case 0xc2: return false;
+      case 0xc3: return true;
+      case 0xcc: return b[i++];
+      case 0xcd: i += 2; return dv.getUint16(i-2);
+      case 0xce: i += 4; return dv.getUint32(i-4);
+      case 0xd2: i += 4; return dv.getInt32(i-4);
+      case 0xd9: return str(b[i++]);
+      case 0xda: i += 2; return str(dv.getUint16(i-2));
+      case 0xdc: i += 2; return arr(dv.getUint16(i-2));
+    }
+    throw new Error('msgpack 0x'+t.toString(16));
+  }
+  return val();
+}
+
 // ── TOAST ────────────────────────────────────────────
 let toastTmr;
 function toast(msg, ok=true){
@@ -556,17 +681,17 @@ function toast(msg, ok=true){
 
 // ── STATS ────────────────────────────────────────────
 function updateStats(){
-  const u = users.length, l = logs.length, f = 50 - u;
+  const u = users.length, l = logs.length, f = maxUsers - u;
   document.getElementById('sU').textContent = u;
   document.getElementById('sL').textContent = l;
   document.getElementById('sF').textContent = f;
-  document.getElementById('sUBar').style.width = (u/50*100)+'%';
+  document.getElementById('sUBar').style.width = (u/maxUsers*100)+'%';
   document.getElementById('sLBar').style.width = Math.min(l/20*100,100)+'%';
-  document.getElementById('sFBar').style.width = (f/50*100)+'%';
+  document.getElementById('sFBar').style.width = (f/maxUsers*100)+'%';
   // Update ticker dengan last absen
   if(logs.length){
     const last = logs[logs.length-1];
-    updateTicker(`LAST: ${last.name} — ${last.time}`);
+    updateTicker(`LAST: ${last.name} — ${fmtTs(last.ts)}`);
   }
 }
 
@@ -591,6 +716,15 @@ function renderUsers(){
       <td class="col-del"><button class="btn btn-red"   onclick="delUser(${i},'${esc(u.name)}')">✕</button></td>
     </tr>`).join('');
   updateStats();
+  renderHistUsers();
+}
+
+// Pilihan filter riwayat mengikuti daftar user
+function renderHistUsers(){
+  const sel = document.getElementById('hUser'), cur = sel.value;
+  sel.innerHTML = '<option value="">SEMUA</option>' +
+    users.map(u=>`<option value="${esc(u.uid)}">${esc(u.name)}</option>`).join('');
+  sel.value = cur;
 }
 
 // ── RENDER LOGS ───────────────────────────────────────
@@ -606,7 +740,7 @@ function renderLogs(flashFirst=false){
       <td class="td-num">${String(logs.length - i).padStart(3,'0')}</td>
       <td style="font-weight:600;letter-spacing:.5px">${esc(l.name)}</td>
       <td><span class="uid-tag">${esc(l.uid)}</span></td>
-      <td class="ts-cell">${esc(l.time)}</td>
+      <td class="ts-cell">${esc(fmtTs(l.ts))}</td>
     </tr>`).join('');
   updateStats();
 }
@@ -621,12 +755,19 @@ function clearLogView(){
 function connectWS(){
   clearTimeout(reconnTmr);
   ws = new WebSocket('ws://'+HOST+':81');
+  ws.binaryType = 'arraybuffer';
 
   ws.onopen = ()=>{
     const pill = document.getElementById('wsPill');
     pill.classList.add('on');
     document.getElementById('wsLabel').textContent = 'ONLINE';
-    ws.send(JSON.stringify({cmd:'init'}));
+    // Jam ESP32 diambil dari browser (mode AP tanpa internet/NTP)
+    ws.send(JSON.stringify({cmd:'time', epoch:Math.floor(Date.now()/1000),
+                            tz:-new Date().getTimezoneOffset()}));
+    if(USE_BIN) ws.send(JSON.stringify({cmd:'fmt',bin:1}));
+    reqSync();
+    ws.send(JSON.stringify({cmd:'getLogs'}));
+    summaryLoad();
   };
 
   ws.onclose = ()=>{
@@ -639,36 +780,76 @@ function connectWS(){
   ws.onerror = ()=> ws.close();
 
   ws.onmessage = (e)=>{
-    let d; try{ d=JSON.parse(e.data) }catch{ return }
+    let d;
+    try{ d = typeof e.data==='string' ? JSON.parse(e.data) : mpDecode(new Uint8Array(e.data)) }
+    catch{ return }
 
     if(d.type==='status'){
-      document.getElementById('uptime').textContent = d.uptime;
+      bootAt = Date.now() - d.up*1000;
+      tickUptime();
+      if(d.max) maxUsers = d.max;
       // update stat counts tanpa re-render tabel
       document.getElementById('sU').textContent = d.users;
-      document.getElementById('sF').textContent = 50 - d.users;
+      document.getElementById('sF').textContent = maxUsers - d.users;
     }
     else if(d.type==='users'){
-      users = d.users||[];
+      // daftar besar dikirim beberapa part — render setelah part terakhir
+      if(!d.part) pendUsers = [];
+      pendUsers.push(...(d.users||[]));
+      if(!d.more){
+        users = pendUsers; pendUsers = [];
+        uRev = d.rev; uEpoch = d.epoch;
+        renderUsers();
+      }
+    }
+    else if(d.type==='delta'){
+      if(uRev < 0) return;                          // snapshot belum datang
+      if(d.epoch!==uEpoch || d.rev!==uRev+1){       // ada op terlewat
+        if(d.epoch!==uEpoch || d.rev>uRev) reqSync();
+        return;
+      }
+      applyDelta(d);
+      uRev = d.rev;
       renderUsers();
     }
     else if(d.type==='logs'){
-      logs = d.logs||[];
-      renderLogs();
+      if(!d.part) pendLogs = [];
+      pendLogs.push(...(d.logs||[]));
+      if(!d.more){ logs = pendLogs; pendLogs = []; renderLogs(); }
     }
     else if(d.type==='attend'){
-      logs.push({name:d.name, uid:d.uid, time:d.time});
+      logs.push({name:d.name, uid:d.uid, ts:d.ts});
       renderLogs(true);
       toast(d.name+' ABSEN', true);
+      clearTimeout(sumTmr); sumTmr = setTimeout(summaryLoad, 1500);
+    }
+    else if(d.type==='metrics'){
+      // p99 = batas atas bucket log2, jadi dibaca "<="
+      const kb = n => Math.round(n/1024)+'K', ms = us => us<1000 ? us+'µs' : (us/1000).toFixed(1)+'ms';
+      document.getElementById('perf').textContent =
+        'HEAP '+kb(d.heap)+' (MIN '+kb(d.heapMin)+', BLOK '+kb(d.block)+')  ◆  LOOP p99 ≤'+ms(d.loopP99)+
+        '  ◆  HTTP ≤'+ms(d.httpP99)+'  ◆  WS ≤'+ms(d.wsP99)+'  ◆  FLASH '+d.fsW+' TULIS';
     }
     else if(d.type==='userchange'){
-      users = d.users||[];
-      renderUsers();
+      // daftar user terbaru datang terpisah sebagai pesan "users"
       if(d.msg) toast(d.msg, true);
     }
   };
 }
 
+// ── DELTA USER ───────────────────────────────────────
+// del = swap-remove, sama persis dengan removeUser() di ESP32
+function applyDelta(d){
+  if(d.op==='add') users.push({name:d.name, uid:d.uid});
+  else if(d.op==='ren'){ if(users[d.idx]) users[d.idx].name = d.name }
+  else if(d.op==='del'){
+    const last = users.pop();
+    if(d.idx < users.length) users[d.idx] = last;
+  }
+}
+
 // ── WS COMMANDS ──────────────────────────────────────
+function reqSync(){ if(ws&&ws.readyState===1) ws.send(JSON.stringify({cmd:'sync',epoch:uEpoch,rev:uRev})) }
 function reqUsers(){ if(ws&&ws.readyState===1) ws.send(JSON.stringify({cmd:'getUsers'})) }
 
 // ── HTTP ACTIONS ──────────────────────────────────────
@@ -701,8 +882,89 @@ async function delUser(idx, name){
   }catch{ toast('KONEKSI GAGAL',false) }
 }
 
+// ── REKAP HARI INI ───────────────────────────────────
+const fmtClock = ts => ts < EPOCH_MIN ? fmtTs(ts) : fmtTs(ts).slice(11);
+
+async function summaryLoad(){
+  try{
+    const r = await fetch('/api/summary');
+    renderSummary(await r.json());
+  }catch{ toast('GAGAL MEMUAT REKAP',false) }
+}
+
+function renderSummary(d){
+  const tb = document.getElementById('sTbody');
+  document.getElementById('sumInfo').textContent =
+    (d.day||'jam belum sinkron')+' · '+d.present+' hadir · '+d.late+' telat (> '+d.lateAfter+')';
+  const rows = d.items.sort((a,b)=>a.first-b.first);
+  if(!rows.length){
+    tb.innerHTML='<tr class="empty-row"><td colspan="5">// belum ada absensi hari ini</td></tr>';
+    return;
+  }
+  tb.innerHTML = rows.map((u,i)=>`
+    <tr>
+      <td class="td-num">${String(i+1).padStart(2,'0')}</td>
+      <td style="font-weight:600;letter-spacing:.5px">${esc(u.name)}</td>
+      <td class="ts-cell">${esc(fmtClock(u.first))}${u.late?'<span class="late-tag">TELAT</span>':''}</td>
+      <td class="ts-cell">${u.count>1?esc(fmtClock(u.last)):'-'}</td>
+      <td class="ts-cell">${u.count}</td>
+    </tr>`).join('');
+}
+
+// ── RIWAYAT ──────────────────────────────────────────
+// Halaman dari jurnal flash; reset = filter baru, selain itu
+// lanjut dari cursor "next" halaman sebelumnya.
+async function histLoad(reset){
+  if(reset){ hist = []; histNext = null }
+  const q = new URLSearchParams({limit:50});
+  const uid = document.getElementById('hUser').value;
+  const day = document.getElementById('hDate').value;
+  if(uid) q.set('user', uid);
+  if(day){
+    const [y,m,d] = day.split('-').map(Number);
+    const from = new Date(y, m-1, d).getTime()/1000;
+    q.set('from', from);
+    q.set('to', new Date(y, m-1, d+1).getTime()/1000 - 1);
+  }
+  if(!reset && histNext != null) q.set('cursor', histNext);
+  try{
+    const r = await fetch('/api/logs?'+q);
+    const d = await r.json();
+    hist = hist.concat(d.items);
+    histNext = d.next;
+    renderHist();
+  }catch{ toast('GAGAL MEMUAT RIWAYAT',false) }
+}
+
+function renderHist(){
+  const tb = document.getElementById('hTbody');
+  document.getElementById('hMore').hidden = histNext == null;
+  if(!hist.length){
+    tb.innerHTML='<tr class="empty-row"><td colspan="4">// tidak ada riwayat</td></tr>';
+    return;
+  }
+  tb.innerHTML = hist.map((l,i)=>`
+    <tr>
+      <td class="td-num">${String(i+1).padStart(3,'0')}</td>
+      <td style="font-weight:600;letter-spacing:.5px">${esc(l.name)}</td>
+      <td><span class="uid-tag">${esc(l.uid)}</span></td>
+      <td class="ts-cell">${esc(fmtTs(l.ts))}</td>
+    </tr>`).join('');
+}
+
+// ── UPTIME ───────────────────────────────────────────
+// Dihitung lokal — ESP32 hanya kirim status saat ada perubahan
+function tickUptime(){
+  if(!bootAt) return;
+  const s = Math.max(0, Math.floor((Date.now()-bootAt)/1000));
+  const p = n => String(n).padStart(2,'0');
+  document.getElementById('uptime').textContent =
+    p(Math.floor(s/3600))+':'+p(Math.floor(s/60)%60)+':'+p(s%60);
+}
+
 // ── INIT ─────────────────────────────────────────────
 connectWS();
+setInterval(tickUptime, 1000);
 </script>
 </body>
 </html>
@@ -0,0 +1,482 @@
+#pragma once
+/*
+ * halaman_gz.h — DIBUAT OTOMATIS oleh tools/gzip_page.py, jangan diedit.
+ * Sumber: HTML_PAGE di halaman.h → minify → gzip -9
+ *   asli 34932 B → minify 24698 B → gzip 7509 B
+ */
+
+#define HTML_PAGE_GZ_LEN 7509
+#define HTML_PAGE_ETAG   "\"768c9343aedde97a\""
+
+const uint8_t HTML_PAGE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x72, 0x1b, 0x47,
+  0x76, 0xef, 0xfc, 0x8a, 0x36, 0x64, 0x6b, 0x66, 0x4c, 0x60, 0x08, 0x80, 0x17, 0x91, 0x80, 0x08,
+  0x99, 0x92, 0x28, 0x93, 0x11, 0x29, 0xb1, 0x04, 0xd0, 0x8a, 0x4b, 0x71, 0x45, 0x0d, 0x4c, 0x03,
+  0x18, 0x73, 0x30, 0x33, 0x9e, 0xe9, 0xe1, 0xc5, 0x30, 0x52, 0x79, 0xda, 0xaa, 0x54, 0xe5, 0x6d,
+  0x93, 0xec, 0xcb, 0x3e, 0xe6, 0x17, 0x52, 0x5b, 0x95, 0xca, 0xd3, 0x7e, 0x8a, 0xbf, 0x24, 0xe7,
+  0xf4, 0x65, 0x2e, 0xc0, 0x00, 0x04, 0x65, 0xe5, 0xb2, 0xa9, 0x50, 0x96, 0x30, 0xd3, 0x97, 0xd3,
+  0xa7, 0xcf, 0xfd, 0x9c, 0x6e, 0xc2, 0x4f, 0xbf, 0x78, 0xf9, 0xf6, 0x45, 0xef, 0xfb, 0x8b, 0x63,
+  0x32, 0xe6, 0x13, 0xaf, 0xb3, 0xf1, 0x14, 0x3f, 0x88, 0x47, 0xfd, 0xd1, 0x61, 0xc5, 0x75, 0x2a,
+  0xd8, 0xc0, 0xa8, 0x03, 0x1f, 0x13, 0xc6, 0x29, 0x19, 0x8c, 0x69, 0x14, 0x33, 0x7e, 0x58, 0xb9,
+  0xec, 0xbd, 0xaa, 0xed, 0x57, 0x74, 0xb3, 0x4f, 0x27, 0xec, 0xb0, 0x72, 0xed, 0xb2, 0x9b, 0x30,
+  0x88, 0x78, 0x85, 0x0c, 0x02, 0x9f, 0x33, 0x1f, 0x86, 0xdd, 0xb8, 0x0e, 0x1f, 0x1f, 0x3a, 0xec,
+  0xda, 0x1d, 0xb0, 0x9a, 0x78, 0xa9, 0xba, 0xbe, 0xcb, 0x5d, 0xea, 0xd5, 0xe2, 0x01, 0xf5, 0xd8,
+  0x61, 0x03, 0x61, 0x70, 0x97, 0x7b, 0xac, 0x73, 0xd4, 0x8f, 0x99, 0x1f, 0xbb, 0xe4, 0xd7, 0xbf,
+  0xff, 0x27, 0x72, 0x41, 0x7d, 0xe6, 0x3d, 0xdd, 0x92, 0x1d, 0x1b, 0x4f, 0x63, 0x7e, 0x87, 0x9f,
+  0xdf, 0xb8, 0x13, 0x84, 0x4f, 0x92, 0xc8, 0x33, 0x8d, 0x31, 0xe7, 0x61, 0xdc, 0xda, 0xda, 0x1a,
+  0xc2, 0x5a, 0xb1, 0x3d, 0x0a, 0x82, 0x91, 0xc7, 0x68, 0xe8, 0xc6, 0xf6, 0x20, 0x98, 0x6c, 0x0d,
+  0xe2, 0xb8, 0xf9, 0x6c, 0x48, 0x27, 0xae, 0x77, 0x77, 0xf8, 0x8e, 0xfe, 0xe8, 0x8c, 0xa9, 0xef,
+  0xb6, 0x6e, 0x46, 0x63, 0xfe, 0xcd, 0x4e, 0xbd, 0xde, 0xde, 0x85, 0xbf, 0x7b, 0xf0, 0xf7, 0x49,
+  0xbd, 0xfe, 0x58, 0x0d, 0x7a, 0x11, 0x24, 0x91, 0xcb, 0xa2, 0xcd, 0x8b, 0xc8, 0x9d, 0xb0, 0x6c,
+  0x24, 0x8e, 0x70, 0xdc, 0x38, 0xf4, 0xe8, 0xdd, 0x61, 0x7c, 0x43, 0x43, 0xc3, 0x6a, 0x7f, 0x5d,
+  0xfd, 0xba, 0xd5, 0xea, 0xb3, 0x61, 0x10, 0x31, 0x7c, 0xa2, 0x43, 0xce, 0xa2, 0x69, 0x3f, 0xb8,
+  0xad, 0xc5, 0xee, 0xcf, 0xae, 0x3f, 0x6a, 0xf5, 0x83, 0xc8, 0x61, 0x51, 0x0d, 0x5a, 0xda, 0x13,
+  0x1a, 0x8d, 0x5c, 0xbf, 0x55, 0x6f, 0x87, 0xd4, 0x71, 0xb0, 0xaf, 0x3e, 0x6b, 0x45, 0x41, 0xc0,
+  0xa7, 0xb5, 0x5a, 0x7f, 0xd4, 0x7a, 0x54, 0x3f, 0x80, 0x3f, 0xac, 0x8d, 0x2f, 0x4d, 0x78, 0x63,
+  0x75, 0xd6, 0xd8, 0x83, 0xb7, 0x10, 0xf7, 0xde, 0x7a, 0xd4, 0xc0, 0x9f, 0x03, 0xfd, 0x0e, 0x03,
+  0x1a, 0x7b, 0xf0, 0x67, 0x88, 0xc3, 0xc5, 0x0a, 0xd0, 0xc0, 0x1a, 0xac, 0xc9, 0xd2, 0x06, 0x18,
+  0xd2, 0xa4, 0x4d, 0xba, 0x8d, 0x2d, 0x74, 0xd2, 0xc7, 0x11, 0xc3, 0x3a, 0xc5, 0xbd, 0xaa, 0x77,
+  0x18, 0x30, 0x1c, 0x0e, 0x06, 0x3b, 0x3b, 0xd0, 0x30, 0x8a, 0x18, 0xf3, 0x61, 0xd1, 0x3a, 0xdb,
+  0x7f, 0x42, 0xe1, 0x3d, 0x62, 0x0e, 0xf6, 0x6e, 0xb3, 0x5d, 0x01, 0xd0, 0x4b, 0x58, 0xeb, 0xd1,
+  0x36, 0xeb, 0xef, 0x0f, 0x71, 0xc1, 0x49, 0xc2, 0xb1, 0x7b, 0x07, 0x7e, 0x76, 0x71, 0x30, 0x67,
+  0xb7, 0xbc, 0xf5, 0x68, 0xb0, 0x3f, 0xd8, 0x67, 0x75, 0xf5, 0x0a, 0xb0, 0xf7, 0xe1, 0x87, 0xee,
+  0xe3, 0xf0, 0xc0, 0x0f, 0x5a, 0x86, 0xa2, 0x28, 0x11, 0x14, 0x35, 0xaa, 0xd8, 0x18, 0x87, 0x74,
+  0x80, 0xe0, 0x13, 0xb7, 0x65, 0x68, 0xae, 0x18, 0xd5, 0x98, 0xfa, 0x71, 0x2d, 0x66, 0x91, 0x3b,
+  0x6c, 0xcf, 0x50, 0xf8, 0xa6, 0xf1, 0x20, 0x0a, 0x3c, 0xaf, 0xd6, 0x67, 0x63, 0x7a, 0xed, 0x06,
+  0x51, 0x2b, 0x9e, 0x00, 0xcd, 0xc6, 0xb3, 0x7e, 0xe0, 0xdc, 0x4d, 0x91, 0xdb, 0x35, 0xc9, 0xb3,
+  0xd6, 0x35, 0x8d, 0x4c, 0x04, 0x66, 0xb5, 0xfb, 0x74, 0x70, 0x35, 0x8a, 0x82, 0xc4, 0x77, 0x54,
+  0x63, 0x7f, 0x64, 0xb5, 0x07, 0x81, 0x07, 0x93, 0xe5, 0x3b, 0xa2, 0x68, 0xb5, 0x27, 0xae, 0x5f,
+  0x1b, 0x33, 0x17, 0x98, 0xdb, 0x6a, 0xd4, 0xeb, 0xd7, 0xe3, 0xb6, 0x80, 0xa9, 0xb9, 0x39, 0x55,
+  0x52, 0xdb, 0x32, 0x8c, 0x76, 0x18, 0xc4, 0x20, 0xa5, 0x81, 0xdf, 0x1a, 0xba, 0xb7, 0xcc, 0x69,
+  0xbb, 0x3e, 0x08, 0x3d, 0xf0, 0xf1, 0xe7, 0x9a, 0xeb, 0x3b, 0xec, 0xb6, 0x75, 0x70, 0x70, 0x00,
+  0x43, 0x5c, 0x18, 0x1e, 0xd5, 0xd8, 0x35, 0xcc, 0x89, 0x5b, 0x7e, 0xe0, 0xb3, 0x3c, 0x1e, 0x11,
+  0x0b, 0x19, 0xe5, 0xc0, 0xf4, 0x9a, 0xe7, 0xfa, 0x8c, 0x46, 0x40, 0x71, 0xea, 0xb8, 0x30, 0xd4,
+  0xdc, 0xa8, 0x3b, 0x6c, 0x54, 0xe5, 0x11, 0x6c, 0x3b, 0xa4, 0x11, 0xb4, 0xe4, 0x9f, 0x49, 0x33,
+  0xbc, 0xad, 0x46, 0xa3, 0x3e, 0x35, 0xeb, 0x55, 0xfc, 0x63, 0xd7, 0xf7, 0xac, 0xd2, 0xb6, 0x9d,
+  0xf0, 0x76, 0xc3, 0x02, 0x82, 0x81, 0x72, 0x82, 0xfc, 0xa5, 0xf8, 0xc6, 0xdc, 0x1d, 0x5c, 0xdd,
+  0xb5, 0x79, 0x10, 0xe6, 0xd0, 0x85, 0xcd, 0x2e, 0x92, 0x48, 0x88, 0x15, 0x90, 0x4e, 0x8b, 0x2b,
+  0xe7, 0xc1, 0xa4, 0xd5, 0x08, 0x6f, 0x49, 0x1c, 0x78, 0xae, 0x43, 0x14, 0x1d, 0x45, 0x6f, 0x81,
+  0x72, 0xbb, 0xb0, 0x72, 0x5b, 0xe9, 0x44, 0x6b, 0xe8, 0xb1, 0xdb, 0x36, 0xf5, 0xdc, 0x91, 0x5f,
+  0x73, 0x39, 0x9b, 0xc4, 0xad, 0x01, 0x43, 0xa2, 0xb4, 0x7f, 0x4c, 0x00, 0x91, 0xe1, 0x5d, 0x4d,
+  0x93, 0x54, 0x70, 0x1e, 0x38, 0xca, 0x6f, 0x40, 0xec, 0x32, 0x75, 0x20, 0x8d, 0x3d, 0x00, 0x36,
+  0xa2, 0x21, 0xa0, 0x08, 0x0f, 0xc1, 0x35, 0x8b, 0x86, 0x5e, 0x70, 0xd3, 0x1a, 0xbb, 0x8e, 0x03,
+  0xe3, 0x66, 0xb6, 0x17, 0x8c, 0x82, 0xda, 0x4d, 0x44, 0xc3, 0xe9, 0x7d, 0x2b, 0xa6, 0x40, 0x70,
+  0x40, 0x2d, 0x1e, 0x47, 0xae, 0x7f, 0x05, 0x24, 0x40, 0xc4, 0x85, 0xdd, 0x81, 0x67, 0x05, 0xce,
+  0x05, 0xa4, 0xa6, 0xb2, 0x6d, 0x1b, 0x27, 0xa8, 0x7d, 0x89, 0x67, 0xa5, 0x5a, 0xf3, 0x64, 0x10,
+  0xea, 0x63, 0x3d, 0x78, 0xd7, 0xaa, 0xb9, 0x88, 0xd1, 0xc0, 0x73, 0x43, 0x20, 0x3e, 0xac, 0x1e,
+  0x06, 0xde, 0xdd, 0x28, 0xf0, 0xcd, 0x7d, 0x58, 0xad, 0xfe, 0x55, 0x15, 0xb8, 0xf4, 0x55, 0xfa,
+  0x09, 0xc6, 0x71, 0x60, 0x8a, 0xa7, 0x1a, 0x81, 0x7e, 0xab, 0x3a, 0xdf, 0x40, 0xf0, 0xb9, 0x0a,
+  0xaf, 0xfa, 0x13, 0x1b, 0xf3, 0x5c, 0x56, 0xca, 0xdf, 0x28, 0xec, 0x9b, 0xc4, 0xd7, 0x23, 0xb5,
+  0xf7, 0xc6, 0x6e, 0xb6, 0x77, 0xf1, 0x3c, 0x74, 0x3d, 0xaf, 0x95, 0xdf, 0xaf, 0x9a, 0x87, 0xba,
+  0x53, 0xa2, 0x77, 0xa8, 0xd0, 0x56, 0x5b, 0xb4, 0x83, 0xe5, 0x63, 0xad, 0x46, 0x13, 0x61, 0xe0,
+  0xeb, 0x8d, 0x04, 0x0a, 0xb6, 0xb3, 0xa0, 0x83, 0x8a, 0x88, 0x1e, 0xe3, 0xa8, 0x36, 0x28, 0x11,
+  0x28, 0x03, 0x38, 0x0b, 0x57, 0xa8, 0x09, 0x25, 0x00, 0x3d, 0x9c, 0xb4, 0x92, 0x30, 0x64, 0xd1,
+  0x80, 0xc6, 0xac, 0x7d, 0x33, 0x06, 0xfa, 0x8a, 0xa1, 0x0c, 0x14, 0x0c, 0xe5, 0x40, 0x6f, 0x26,
+  0x4e, 0xfa, 0x6b, 0xe0, 0x04, 0x34, 0x29, 0xa0, 0x20, 0x0c, 0xd9, 0x02, 0x0a, 0xc0, 0x6d, 0x65,
+  0xaa, 0x6b, 0xa8, 0x37, 0xf8, 0x5a, 0xba, 0xb0, 0xd4, 0xb5, 0x5a, 0x84, 0xbb, 0x5b, 0x4b, 0x1e,
+  0xf7, 0x17, 0xc4, 0x71, 0x66, 0xdf, 0xc4, 0xb5, 0x10, 0x08, 0xbd, 0xd6, 0xfc, 0x5d, 0x4d, 0xd1,
+  0x95, 0x9b, 0x3c, 0x28, 0xdf, 0xa4, 0x56, 0x32, 0x50, 0x57, 0x94, 0x8d, 0x65, 0xa2, 0xad, 0x7c,
+  0x47, 0x6a, 0x08, 0xd0, 0x4a, 0x25, 0xb1, 0x60, 0x4b, 0x09, 0x99, 0x4a, 0xe8, 0x22, 0xf8, 0x26,
+  0x8d, 0x8f, 0x02, 0x21, 0x90, 0x21, 0xf6, 0x76, 0x5c, 0x4d, 0x9f, 0xb2, 0x8d, 0xdb, 0xa0, 0x7c,
+  0xf9, 0x71, 0x0a, 0x69, 0xe1, 0x8f, 0x8a, 0x36, 0x5b, 0x36, 0x89, 0x89, 0x0e, 0xf8, 0x4c, 0x29,
+  0xb5, 0x7b, 0x99, 0xd0, 0xee, 0xa5, 0x9b, 0xd2, 0x48, 0xef, 0xd6, 0xbf, 0x9a, 0xa3, 0xf7, 0x82,
+  0xd5, 0x8b, 0x90, 0x34, 0x79, 0x94, 0xd3, 0x01, 0xc4, 0xde, 0x29, 0xa2, 0x49, 0xf4, 0xca, 0x0b,
+  0x40, 0x14, 0xb2, 0xe0, 0xbd, 0x26, 0x54, 0x40, 0x09, 0x81, 0x3e, 0xa4, 0x19, 0x13, 0x06, 0x42,
+  0x0b, 0x36, 0xb7, 0x16, 0x24, 0x9c, 0xb8, 0xfe, 0x10, 0x43, 0x1d, 0xd6, 0x9e, 0x7d, 0x73, 0xc5,
+  0xee, 0x86, 0x11, 0x84, 0x48, 0x31, 0xc1, 0x81, 0x53, 0xa5, 0xe3, 0x32, 0x68, 0x18, 0x53, 0x07,
+  0x0c, 0x5e, 0x9d, 0xc8, 0x3f, 0xca, 0x21, 0xef, 0xd5, 0x67, 0xbb, 0x65, 0x03, 0x40, 0x20, 0x48,
+  0xce, 0x59, 0xcc, 0x66, 0x76, 0x12, 0x72, 0x70, 0xaf, 0x18, 0x6d, 0xac, 0xa3, 0xa2, 0xf5, 0x39,
+  0x51, 0x91, 0x61, 0xc1, 0x1a, 0xb2, 0xa2, 0x8c, 0xc9, 0x76, 0xfd, 0x93, 0xc5, 0x64, 0x66, 0xa3,
+  0x67, 0xc2, 0x50, 0x69, 0xd1, 0x57, 0x37, 0xd7, 0x75, 0x43, 0x8a, 0xf3, 0xcd, 0xbd, 0x12, 0x67,
+  0x71, 0x9f, 0x42, 0x69, 0x04, 0x6a, 0x1e, 0xed, 0x33, 0x6f, 0xba, 0x9e, 0x5e, 0xad, 0xb2, 0x67,
+  0x18, 0x63, 0x2c, 0x6c, 0x46, 0x19, 0xb9, 0x9c, 0x87, 0xcb, 0xb9, 0x18, 0xe4, 0xfa, 0xbd, 0x78,
+  0x96, 0x90, 0x73, 0xde, 0x86, 0xa8, 0x8d, 0x80, 0x24, 0x0c, 0xae, 0xa6, 0xd8, 0xd9, 0x6a, 0xcc,
+  0x93, 0x23, 0x1d, 0xe4, 0xfa, 0x3e, 0x10, 0xbd, 0xb0, 0x28, 0x9a, 0x96, 0xed, 0x66, 0x39, 0x9b,
+  0x3e, 0xd9, 0xdc, 0x94, 0xa0, 0x9d, 0xe9, 0x87, 0xc2, 0x45, 0x06, 0x76, 0xa4, 0x09, 0x9a, 0x22,
+  0x83, 0xa2, 0x72, 0x25, 0x29, 0x8c, 0x06, 0x6d, 0x99, 0x66, 0xae, 0x41, 0x3c, 0x79, 0x94, 0xb3,
+  0xbf, 0x36, 0xeb, 0xd6, 0x4c, 0x68, 0x51, 0x69, 0x67, 0x0d, 0xd4, 0xc7, 0x9a, 0xa5, 0x44, 0x88,
+  0x59, 0x38, 0x2d, 0x71, 0x45, 0x01, 0x22, 0xcb, 0xef, 0x5a, 0xf6, 0xee, 0x6c, 0x42, 0x5d, 0x7f,
+  0x3a, 0xa1, 0xb7, 0x2a, 0x58, 0x38, 0xd8, 0xab, 0x87, 0x59, 0xfc, 0x4e, 0x68, 0xc2, 0x83, 0x94,
+  0xa7, 0x18, 0xb3, 0x10, 0xf4, 0x76, 0x64, 0x1f, 0x07, 0xcd, 0xec, 0x98, 0x53, 0x0e, 0x36, 0xc1,
+  0x75, 0x52, 0x32, 0xe3, 0x4b, 0x1b, 0xff, 0x01, 0xe7, 0x39, 0x09, 0x11, 0x25, 0x34, 0x76, 0xc9,
+  0xc4, 0x8f, 0x55, 0x5c, 0x68, 0x6e, 0x57, 0x1b, 0x43, 0xc0, 0x40, 0x7b, 0x09, 0xe5, 0x7e, 0x94,
+  0xf8, 0x37, 0x73, 0x70, 0x07, 0x34, 0x72, 0xa6, 0xab, 0x83, 0xb7, 0xa5, 0xea, 0x92, 0x62, 0x8c,
+  0x7a, 0x8d, 0xff, 0x94, 0x04, 0x1f, 0x60, 0x56, 0x0a, 0xb1, 0x05, 0xca, 0xab, 0x05, 0x6d, 0xe2,
+  0x15, 0x5f, 0xf4, 0x13, 0x46, 0x19, 0xe2, 0xc3, 0xca, 0xa2, 0xe3, 0x88, 0xc1, 0xde, 0xdc, 0x6b,
+  0x56, 0x08, 0xb3, 0x96, 0x3a, 0x84, 0x66, 0x9c, 0xdf, 0x54, 0x6b, 0x8c, 0x22, 0x5b, 0xe6, 0x0b,
+  0xb4, 0x4b, 0xca, 0x0f, 0x56, 0x79, 0x56, 0x59, 0x88, 0x4e, 0xfb, 0xb0, 0x77, 0x10, 0x42, 0x15,
+  0xf4, 0x46, 0x4a, 0xd5, 0x50, 0xbe, 0x65, 0xa0, 0x93, 0x57, 0x40, 0x34, 0x6e, 0x0b, 0x06, 0x48,
+  0x91, 0x2b, 0x95, 0xa4, 0x5a, 0x00, 0x40, 0x5c, 0x44, 0x1f, 0xd9, 0x91, 0xb5, 0x43, 0xf2, 0x06,
+  0x08, 0x31, 0x73, 0x67, 0x17, 0x22, 0x78, 0x8b, 0xa4, 0xf2, 0x66, 0x82, 0x5d, 0xae, 0xd6, 0x76,
+  0x31, 0x00, 0x53, 0x38, 0x7b, 0x7d, 0x65, 0x61, 0xd2, 0x30, 0x64, 0x5e, 0x3f, 0xec, 0xdd, 0x55,
+  0x81, 0x4f, 0x89, 0x82, 0x15, 0x45, 0x64, 0x2f, 0x93, 0x90, 0x6b, 0xba, 0x8e, 0x35, 0x6b, 0x22,
+  0xfb, 0x51, 0xeb, 0xd2, 0x0c, 0x28, 0xcf, 0xa8, 0xbc, 0xa3, 0xd6, 0x40, 0x6d, 0xa1, 0x25, 0x25,
+  0x7a, 0x93, 0x1b, 0x22, 0x3c, 0xe1, 0xb4, 0xcc, 0x6b, 0xa7, 0x43, 0x30, 0x97, 0x2c, 0x8c, 0xc0,
+  0x06, 0x3d, 0xa0, 0x4f, 0xa3, 0x69, 0x2e, 0xf4, 0xda, 0xcf, 0x58, 0xd5, 0x5c, 0xc5, 0xa9, 0xc5,
+  0x44, 0x41, 0x43, 0xab, 0x61, 0x14, 0x3b, 0xcd, 0xdb, 0xdb, 0x65, 0x26, 0x3a, 0xb7, 0x7b, 0x21,
+  0x27, 0xc4, 0xde, 0x93, 0x0e, 0x1c, 0xa0, 0x01, 0x1b, 0x86, 0xd3, 0xcf, 0x69, 0x0a, 0x95, 0x25,
+  0xa9, 0x09, 0xb3, 0x51, 0x27, 0x42, 0xc1, 0xf3, 0xd9, 0xe8, 0x12, 0xa7, 0x39, 0xbf, 0x4f, 0x21,
+  0x2f, 0x69, 0x23, 0xf3, 0x40, 0x9b, 0x63, 0x57, 0xf0, 0x8c, 0x0d, 0x70, 0x27, 0xd3, 0x39, 0x3b,
+  0x02, 0x3c, 0x17, 0x7d, 0x35, 0x0c, 0x5d, 0xa7, 0xbf, 0x2d, 0x69, 0x13, 0x4e, 0x08, 0xb1, 0x6a,
+  0x09, 0xd4, 0xca, 0x2d, 0x97, 0x50, 0x30, 0x65, 0x76, 0x74, 0x5b, 0x16, 0x50, 0xdc, 0xe7, 0xde,
+  0x25, 0xae, 0xa2, 0xe8, 0xb3, 0x7e, 0x7c, 0x9d, 0x45, 0x37, 0x8d, 0x39, 0x87, 0x8d, 0x25, 0x9e,
+  0x87, 0x64, 0x1b, 0xf3, 0x05, 0x03, 0x08, 0x4b, 0x4a, 0x36, 0xad, 0x34, 0x4f, 0x23, 0x2a, 0x44,
+  0x58, 0x65, 0x93, 0x39, 0x43, 0x53, 0x2a, 0xbe, 0x4a, 0xf2, 0xe6, 0xdd, 0x39, 0xc2, 0xa2, 0x82,
+  0x7f, 0xf1, 0xa2, 0xa3, 0xde, 0xd3, 0xfe, 0x3f, 0xc5, 0x62, 0x66, 0xf7, 0xb9, 0xbf, 0xa4, 0x10,
+  0xf2, 0x30, 0x6a, 0x34, 0x56, 0x51, 0x43, 0x3b, 0x8f, 0x5d, 0xe5, 0xed, 0xda, 0x83, 0x24, 0x8a,
+  0x81, 0x3e, 0xaa, 0xee, 0xb1, 0xe0, 0x7b, 0xf2, 0x0a, 0x45, 0xc1, 0xcb, 0xdb, 0x8d, 0xdd, 0xb8,
+  0xc4, 0x53, 0xcc, 0x8b, 0x74, 0x69, 0xa8, 0x08, 0x1b, 0x5c, 0xcb, 0xe2, 0xeb, 0xba, 0x4c, 0x8e,
+  0xd2, 0x80, 0x25, 0x86, 0xc6, 0x2f, 0x90, 0x97, 0xa9, 0x83, 0x2f, 0x38, 0x25, 0xd5, 0x28, 0x11,
+  0x94, 0x6b, 0x09, 0x57, 0xa4, 0x57, 0x4c, 0xa3, 0x82, 0xfa, 0xbe, 0xec, 0x45, 0xde, 0x5c, 0xb3,
+  0x5c, 0xa0, 0x21, 0x4a, 0x97, 0xa6, 0x7d, 0xf0, 0xc4, 0x12, 0x03, 0x6a, 0xcb, 0x0c, 0x65, 0xbb,
+  0xc4, 0xb9, 0xe9, 0x9e, 0x0c, 0xe3, 0x5c, 0x40, 0xbf, 0x86, 0x7f, 0xde, 0xcb, 0xb9, 0xe7, 0xbd,
+  0x52, 0xef, 0x2c, 0x71, 0x5a, 0x66, 0x99, 0xdb, 0xcb, 0x93, 0xaf, 0x72, 0x9c, 0x24, 0x38, 0xc8,
+  0x9b, 0x0a, 0xc0, 0x44, 0x1e, 0x55, 0x02, 0x4a, 0xb6, 0xaf, 0x00, 0x34, 0x1a, 0x07, 0x31, 0x9f,
+  0x96, 0xa8, 0xda, 0x8a, 0x40, 0x60, 0x29, 0x40, 0xde, 0xf7, 0x64, 0x75, 0xe8, 0x9e, 0x40, 0x68,
+  0xc1, 0x5f, 0x70, 0xda, 0x07, 0x1b, 0xa3, 0xe2, 0x03, 0xe1, 0x25, 0xd2, 0xd5, 0x3d, 0x1a, 0xc6,
+  0xac, 0xa5, 0x1f, 0x66, 0x1c, 0x4d, 0x27, 0xb8, 0xfa, 0x25, 0x31, 0xd8, 0x9a, 0xa9, 0x0b, 0x0c,
+  0xd3, 0x90, 0xc6, 0x9f, 0x98, 0x7a, 0x7c, 0xaa, 0x25, 0x53, 0x4e, 0x49, 0x8c, 0x15, 0x76, 0xb4,
+  0xe5, 0xb1, 0x21, 0x4f, 0xd5, 0xfb, 0x40, 0xab, 0x77, 0x99, 0x22, 0x72, 0xac, 0x8f, 0x8a, 0xcd,
+  0xcb, 0x3d, 0xaa, 0xf2, 0x48, 0x29, 0x8d, 0x97, 0x24, 0xd5, 0x0d, 0x8c, 0xfa, 0x34, 0x1c, 0x1d,
+  0xf3, 0x2d, 0x21, 0x65, 0x3a, 0xce, 0xf6, 0xd9, 0x4d, 0x2d, 0x0a, 0x6e, 0xa6, 0x59, 0x0a, 0x01,
+  0x6f, 0x5d, 0x58, 0x94, 0x11, 0x7b, 0x57, 0xba, 0x69, 0x02, 0x7b, 0xbe, 0x81, 0xd0, 0x30, 0xce,
+  0xa7, 0x0e, 0x7a, 0xd4, 0x74, 0x18, 0x05, 0x93, 0xfc, 0x3a, 0x2a, 0xb1, 0x6e, 0x34, 0xdb, 0xe5,
+  0xf9, 0xc2, 0x0e, 0x06, 0x6f, 0xb9, 0x7c, 0x80, 0x07, 0xd3, 0x25, 0x2a, 0xba, 0x24, 0x19, 0x49,
+  0x27, 0x37, 0x66, 0x33, 0xee, 0x4c, 0x35, 0x79, 0xf7, 0x35, 0x79, 0x73, 0x96, 0x19, 0xfd, 0x04,
+  0x90, 0x01, 0x72, 0x13, 0xea, 0x29, 0x96, 0x4c, 0x40, 0x2e, 0x3d, 0x06, 0x02, 0xed, 0xd4, 0xfc,
+  0x64, 0xf2, 0x29, 0xa9, 0xbc, 0x62, 0x73, 0xae, 0xae, 0x39, 0xb3, 0xa1, 0x1f, 0xbc, 0x82, 0x33,
+  0x5d, 0x64, 0xad, 0xec, 0x03, 0xc3, 0x56, 0x15, 0x0f, 0x0e, 0x24, 0xc4, 0x4a, 0x19, 0xbe, 0x6a,
+  0x97, 0x8d, 0x4e, 0x30, 0x95, 0xa1, 0xa3, 0x4f, 0x41, 0x4c, 0x84, 0x7b, 0x85, 0xc2, 0xa4, 0x3c,
+  0x57, 0xa8, 0x3b, 0x25, 0x65, 0x06, 0xd9, 0xd5, 0xdc, 0x4d, 0xc5, 0x13, 0xe3, 0xa5, 0xbd, 0x5c,
+  0xc1, 0xd9, 0xf5, 0x45, 0x0c, 0xdb, 0xf7, 0x82, 0xc1, 0xd5, 0x92, 0x32, 0x43, 0x5c, 0x1b, 0x40,
+  0x64, 0xf4, 0x5b, 0x68, 0x58, 0x06, 0x96, 0x39, 0x2e, 0x2f, 0xa9, 0x44, 0x6b, 0x17, 0x5d, 0x5a,
+  0x70, 0xc0, 0x63, 0x31, 0x48, 0xc0, 0xc3, 0xfb, 0x9d, 0xf5, 0x76, 0x31, 0x5c, 0x78, 0x54, 0xa7,
+  0x75, 0x94, 0xd5, 0xfb, 0x6a, 0x76, 0x8b, 0x47, 0x1c, 0xf3, 0x95, 0x1c, 0x59, 0x1d, 0x20, 0x0d,
+  0x99, 0xab, 0xe6, 0xd3, 0xb4, 0x20, 0xe1, 0x48, 0x4a, 0x79, 0x70, 0xb1, 0x3a, 0x67, 0xd3, 0xfb,
+  0x68, 0x0d, 0x83, 0x41, 0x12, 0x4f, 0x97, 0x7a, 0xb5, 0x99, 0x3d, 0x76, 0x63, 0x2e, 0x77, 0x8c,
+  0xeb, 0x82, 0x47, 0x92, 0xa9, 0xb3, 0x18, 0x0a, 0x09, 0xfd, 0x98, 0x4d, 0x58, 0xcb, 0xa1, 0xd1,
+  0xd5, 0xcc, 0x16, 0x49, 0x31, 0x8a, 0xd4, 0x82, 0xf7, 0x58, 0x93, 0x71, 0x2a, 0xf0, 0x44, 0x63,
+  0x86, 0x1c, 0x50, 0x6b, 0x4f, 0xf0, 0x20, 0xa7, 0xc0, 0xa1, 0x25, 0x45, 0xf9, 0x34, 0x37, 0xae,
+  0xe3, 0x5c, 0x0f, 0x1c, 0x3c, 0x44, 0x72, 0xce, 0x28, 0x9b, 0xac, 0x24, 0xed, 0xf3, 0xd7, 0x67,
+  0x0b, 0x7e, 0x38, 0x2f, 0xfc, 0xd2, 0x44, 0x6d, 0xd7, 0x0b, 0xc2, 0xff, 0xe4, 0x01, 0x15, 0x36,
+  0xb1, 0x8b, 0xac, 0x56, 0x9a, 0x2b, 0xf0, 0xef, 0x7e, 0x4a, 0xad, 0xb4, 0xbc, 0xcc, 0xd9, 0xb0,
+  0xf7, 0x97, 0x15, 0x3a, 0x6d, 0x36, 0x09, 0xf9, 0x1d, 0x1a, 0x6e, 0x02, 0x26, 0x30, 0xe7, 0x71,
+  0xe6, 0x68, 0x8e, 0xc5, 0x27, 0x79, 0xf4, 0xb3, 0x06, 0xaf, 0x1b, 0x6b, 0x27, 0x59, 0xb3, 0x47,
+  0x3c, 0xa0, 0x10, 0x5c, 0xcc, 0x1d, 0xde, 0x69, 0xc7, 0x8c, 0xeb, 0xa9, 0xe2, 0xc0, 0x9e, 0x20,
+  0xea, 0x50, 0x3d, 0xad, 0x89, 0x44, 0xc9, 0x8a, 0x79, 0x21, 0x92, 0x1b, 0x5a, 0x88, 0x8a, 0x97,
+  0x95, 0x6e, 0xe6, 0x42, 0xd3, 0xa2, 0x43, 0xf9, 0xde, 0x14, 0xa7, 0x39, 0x65, 0x41, 0x6b, 0x33,
+  0xae, 0xa6, 0x13, 0x84, 0x7a, 0x96, 0x9d, 0x43, 0xe6, 0xce, 0x29, 0x0f, 0x34, 0x59, 0xec, 0x78,
+  0x0c, 0x0e, 0x35, 0xf5, 0x52, 0xe5, 0xcb, 0xd6, 0x2d, 0x3d, 0x3a, 0xb8, 0x7a, 0x50, 0xf0, 0xa8,
+  0xa7, 0xb1, 0x28, 0x5a, 0x3b, 0x4e, 0x9c, 0x7d, 0x33, 0x01, 0xab, 0x4a, 0xcd, 0xcc, 0x2a, 0xed,
+  0x36, 0x81, 0x70, 0xd6, 0x54, 0xf1, 0x51, 0x70, 0x48, 0xd8, 0x8f, 0xac, 0x30, 0xb7, 0x8d, 0xa9,
+  0xf3, 0x2c, 0x9d, 0x99, 0xb6, 0xef, 0x62, 0xbb, 0x35, 0x55, 0xc7, 0xa1, 0x69, 0xbc, 0x77, 0xed,
+  0xc6, 0x2e, 0x44, 0x7a, 0xf9, 0x7a, 0x6c, 0x13, 0xf5, 0x3d, 0x57, 0x36, 0xd7, 0xfa, 0x8e, 0x84,
+  0xcb, 0x1d, 0x2e, 0x95, 0x34, 0x67, 0x07, 0x61, 0xab, 0x84, 0x42, 0x96, 0x12, 0x53, 0xc9, 0x10,
+  0xa2, 0x5e, 0x57, 0xc5, 0xc2, 0xf9, 0x8a, 0x8d, 0xac, 0xcc, 0x64, 0x1d, 0xa2, 0xd8, 0x97, 0x4e,
+  0x6d, 0xa8, 0xa9, 0xa5, 0x35, 0xa5, 0x72, 0xbb, 0x90, 0xcb, 0xf6, 0x95, 0x67, 0xca, 0xa2, 0x80,
+  0xc2, 0x8e, 0x1e, 0x79, 0x3d, 0x15, 0x6b, 0x81, 0xaa, 0xb6, 0x7c, 0x3e, 0xae, 0x0d, 0xc6, 0xae,
+  0xe7, 0x98, 0xdb, 0x56, 0x55, 0x77, 0xfd, 0x1d, 0xf9, 0x1a, 0xa2, 0xd5, 0x42, 0x5f, 0x11, 0x46,
+  0x2e, 0xcc, 0x79, 0xa2, 0xdd, 0x4d, 0xe1, 0x38, 0x30, 0x0b, 0x79, 0xf3, 0xe1, 0xd0, 0x3e, 0x22,
+  0x95, 0xba, 0xc6, 0x5c, 0x0c, 0x2e, 0xcc, 0x51, 0x9f, 0xc6, 0x6e, 0xdc, 0xaa, 0xe7, 0x92, 0xdc,
+  0xcc, 0xe4, 0xe7, 0x9d, 0xdb, 0xc1, 0xe2, 0xfe, 0xb1, 0xa4, 0x56, 0x22, 0x1a, 0x3b, 0xf5, 0xbc,
+  0x68, 0x64, 0x92, 0xb0, 0x1f, 0xa6, 0xee, 0x7b, 0xf1, 0x64, 0x58, 0x94, 0xcb, 0x74, 0x29, 0x6a,
+  0xa7, 0x30, 0x22, 0x7f, 0x86, 0x9a, 0x4f, 0xf9, 0xb7, 0x71, 0x94, 0x3e, 0xde, 0x4b, 0x4d, 0x9d,
+  0x8a, 0x5f, 0x0a, 0xc5, 0xc0, 0x39, 0x11, 0xa9, 0xcb, 0x31, 0x79, 0x09, 0x11, 0xd5, 0x64, 0xe5,
+  0x62, 0x4a, 0x85, 0xa6, 0xf1, 0xa4, 0x5c, 0x68, 0x0e, 0x14, 0x81, 0x73, 0xbc, 0xd9, 0x5b, 0x40,
+  0x01, 0x25, 0x6b, 0x91, 0x37, 0x4f, 0xe4, 0xb8, 0x34, 0x08, 0xcd, 0x08, 0x31, 0xcf, 0x8c, 0x83,
+  0x39, 0x5e, 0x20, 0x2e, 0xb3, 0xa7, 0x5b, 0xea, 0x96, 0xce, 0xd3, 0x2d, 0x75, 0x63, 0x08, 0xa5,
+  0x48, 0xdd, 0x1f, 0x62, 0x11, 0x3c, 0x38, 0xee, 0x35, 0x19, 0x78, 0x34, 0x8e, 0x0f, 0x2b, 0xe9,
+  0xb9, 0x7e, 0xa5, 0xa4, 0x1d, 0x89, 0x8c, 0xed, 0x40, 0x67, 0x82, 0x77, 0x8a, 0x9e, 0x07, 0xb7,
+  0x87, 0x15, 0x3c, 0xfe, 0x6a, 0xec, 0xc1, 0x7f, 0x95, 0xce, 0x53, 0x4c, 0x90, 0x89, 0x73, 0x58,
+  0x39, 0x6f, 0x92, 0x9d, 0x71, 0xa3, 0x79, 0xbd, 0x7f, 0xd2, 0xfc, 0xf9, 0x7c, 0x97, 0xec, 0x7c,
+  0xd7, 0x1c, 0xef, 0x5d, 0x37, 0xcf, 0x77, 0xc8, 0x93, 0x71, 0xf3, 0xba, 0x79, 0xb2, 0xf3, 0xf3,
+  0xf9, 0x3e, 0x3c, 0xee, 0x5c, 0x37, 0x4e, 0xf6, 0xe1, 0xe9, 0x60, 0xbc, 0x8d, 0x4f, 0x95, 0xad,
+  0x0e, 0xa0, 0x7a, 0x3d, 0x42, 0x44, 0x61, 0x65, 0xb9, 0x7e, 0x09, 0x16, 0xa8, 0xed, 0x95, 0xce,
+  0xd1, 0xf3, 0xee, 0xf1, 0x9b, 0xee, 0x69, 0x6e, 0x68, 0x61, 0x10, 0x58, 0x8a, 0x4a, 0xe7, 0xb8,
+  0x7b, 0xb1, 0xdd, 0x24, 0x7f, 0xfe, 0x13, 0x79, 0xf7, 0xea, 0xf4, 0x25, 0x7e, 0x5e, 0x1c, 0xbd,
+  0x39, 0x3e, 0xd3, 0x53, 0x8a, 0x1f, 0x39, 0x00, 0xf9, 0xe3, 0xe4, 0x39, 0x32, 0x28, 0x29, 0xaa,
+  0x10, 0xd7, 0xc1, 0x97, 0x0b, 0x7c, 0x5e, 0x18, 0x01, 0x8e, 0x5e, 0x0f, 0x78, 0x09, 0x8f, 0x1d,
+  0xbd, 0x04, 0xa8, 0x83, 0xaf, 0xda, 0xcf, 0xf0, 0xa8, 0xab, 0xd2, 0x79, 0xfb, 0xea, 0xd5, 0xd9,
+  0xe9, 0x9b, 0x63, 0xd8, 0x36, 0x74, 0x95, 0xe2, 0x92, 0xd9, 0x43, 0x09, 0x52, 0xbe, 0x57, 0x3a,
+  0xb5, 0x5a, 0x4b, 0xfc, 0x37, 0xbf, 0x99, 0x32, 0x9e, 0xca, 0xb3, 0x96, 0x4a, 0x59, 0xa3, 0x3c,
+  0x73, 0xab, 0x74, 0xce, 0x4e, 0xbf, 0x3b, 0x2e, 0x59, 0x3d, 0x7f, 0x9e, 0x55, 0x3e, 0x5f, 0x9c,
+  0x62, 0x49, 0xd4, 0x64, 0xcb, 0xa9, 0x68, 0x50, 0xbb, 0xed, 0x74, 0x4f, 0xbb, 0xbd, 0xe3, 0x73,
+  0xa2, 0x98, 0x45, 0x04, 0x43, 0xd2, 0xdd, 0x0a, 0x7a, 0x14, 0xc1, 0xc5, 0x0c, 0x04, 0xef, 0xd7,
+  0x3f, 0xfc, 0xae, 0x30, 0xa6, 0xf3, 0xfe, 0xf8, 0x79, 0xf7, 0xed, 0x8b, 0xd7, 0xc7, 0x3d, 0xf2,
+  0xee, 0xf8, 0xe8, 0xac, 0x77, 0x7a, 0x7e, 0xfc, 0x70, 0x18, 0x67, 0xa7, 0xbd, 0xde, 0xd9, 0xf1,
+  0xab, 0x2e, 0xe9, 0xf6, 0xde, 0xbe, 0x3b, 0xfa, 0xf6, 0x13, 0x20, 0xf4, 0x8e, 0x2e, 0xc8, 0xeb,
+  0xa3, 0x77, 0xbd, 0x4b, 0x29, 0x4e, 0x97, 0x6f, 0x7a, 0x97, 0xaf, 0xe5, 0xce, 0x1e, 0x0e, 0xeb,
+  0xff, 0xe9, 0xb2, 0x00, 0xab, 0x54, 0x2b, 0xd1, 0x1e, 0x17, 0xe5, 0x2e, 0xb5, 0xc2, 0x95, 0x92,
+  0x76, 0xb4, 0xb8, 0x65, 0xed, 0xe0, 0xa1, 0x2b, 0x9d, 0x5e, 0xc0, 0xa9, 0x47, 0x2e, 0x63, 0x16,
+  0x95, 0x48, 0xba, 0xb6, 0xe4, 0x44, 0x24, 0x4c, 0x52, 0xa0, 0xe3, 0xcb, 0x4a, 0xa7, 0xbe, 0x6c,
+  0x6c, 0x9f, 0x82, 0x94, 0x97, 0xb5, 0x8a, 0x83, 0x0e, 0x0d, 0xe0, 0x39, 0x8c, 0x22, 0xc2, 0xfc,
+  0xaa, 0x2b, 0x97, 0xad, 0xfa, 0x57, 0xda, 0x20, 0x2c, 0x37, 0x40, 0xeb, 0xee, 0x45, 0x5c, 0xcc,
+  0x5c, 0xb5, 0x19, 0x11, 0x02, 0x2a, 0x5c, 0xce, 0x7e, 0xc3, 0x66, 0xd4, 0x0e, 0x96, 0x25, 0x22,
+  0xe9, 0xce, 0xd4, 0x4a, 0xcf, 0x05, 0xb8, 0xdf, 0xbc, 0xc9, 0xae, 0x17, 0x70, 0xd2, 0x63, 0x11,
+  0xc4, 0x1d, 0x74, 0xd5, 0x2e, 0xb1, 0x90, 0xa1, 0x96, 0x7e, 0x05, 0x96, 0xf1, 0x73, 0x6f, 0x52,
+  0xd4, 0x49, 0x34, 0xfc, 0xe5, 0x5b, 0x5b, 0x5c, 0x15, 0x0f, 0xab, 0xe4, 0x3c, 0xf9, 0x24, 0x8e,
+  0x25, 0x0e, 0x2b, 0x5b, 0x34, 0x74, 0xb7, 0x26, 0x8c, 0x47, 0xee, 0x20, 0xce, 0x9c, 0x43, 0x1e,
+  0x2f, 0x79, 0x66, 0x54, 0x59, 0x68, 0x15, 0xf1, 0x63, 0x49, 0xb3, 0x00, 0xbc, 0xac, 0x5d, 0xed,
+  0x5b, 0x2e, 0xf3, 0x92, 0x0e, 0x39, 0x8d, 0x84, 0x12, 0x6c, 0x94, 0xaf, 0xac, 0x0f, 0x3c, 0x10,
+  0x5c, 0x3f, 0x81, 0x04, 0x2d, 0x55, 0x5c, 0x08, 0x35, 0x48, 0x5a, 0x54, 0xaf, 0x90, 0xc0, 0x1f,
+  0x78, 0xa0, 0xca, 0x87, 0x95, 0x88, 0xfd, 0x84, 0xf0, 0x62, 0xd3, 0x02, 0x85, 0xfe, 0xdd, 0xbf,
+  0x83, 0x2d, 0x7a, 0xf5, 0xee, 0xb8, 0x7b, 0xf2, 0x74, 0x4b, 0x4e, 0x5f, 0x45, 0x21, 0x5d, 0x26,
+  0x16, 0x77, 0x8d, 0xb1, 0xf2, 0x8b, 0x9f, 0x2a, 0x48, 0xe1, 0x91, 0x78, 0x49, 0x87, 0x8a, 0xd8,
+  0xa7, 0xd2, 0x79, 0xf4, 0x74, 0x8b, 0x8f, 0x45, 0x4f, 0xe7, 0xcd, 0xd1, 0xf9, 0x51, 0xfa, 0xa6,
+  0xc7, 0xa9, 0xa0, 0xba, 0xd2, 0xb9, 0x3c, 0x7d, 0x59, 0xda, 0x09, 0xfb, 0x43, 0x72, 0x94, 0xf4,
+  0x38, 0xe8, 0x09, 0x55, 0xcf, 0x96, 0x58, 0x7e, 0x2b, 0x45, 0x46, 0x04, 0xde, 0xc2, 0x01, 0x8b,
+  0x18, 0x5c, 0x20, 0x1c, 0xe9, 0xc9, 0x69, 0x76, 0x0d, 0xd3, 0xb9, 0x43, 0x00, 0x16, 0xda, 0xb4,
+  0xc3, 0xca, 0x4e, 0xa5, 0xb3, 0xb5, 0x45, 0x26, 0xcc, 0x4f, 0xfc, 0xd1, 0x28, 0x21, 0x57, 0x10,
+  0x9b, 0x5f, 0xc5, 0xae, 0x6d, 0xdb, 0x00, 0xd8, 0xe9, 0xa4, 0x6b, 0xa8, 0x70, 0x6c, 0x4b, 0x53,
+  0x60, 0xb9, 0xca, 0x7c, 0x7e, 0xc1, 0xb8, 0x47, 0xb5, 0x53, 0xc1, 0x39, 0x0b, 0x46, 0x44, 0xdd,
+  0x03, 0x2f, 0x9a, 0xf3, 0xac, 0x40, 0x03, 0x63, 0x17, 0x3a, 0x1c, 0x19, 0xff, 0x28, 0x4f, 0xf3,
+  0xdd, 0xaa, 0x48, 0x67, 0x2d, 0xd9, 0x13, 0x87, 0x14, 0x39, 0xd9, 0x1b, 0x78, 0x8c, 0x46, 0x80,
+  0xdb, 0x77, 0x10, 0x8d, 0x0a, 0xf9, 0xfb, 0xe3, 0x3f, 0x93, 0x17, 0x67, 0xc7, 0x47, 0xef, 0xc8,
+  0x77, 0xa7, 0xc7, 0xef, 0x73, 0x22, 0xb8, 0x9e, 0x28, 0x7b, 0xc1, 0x40, 0x14, 0x54, 0x0e, 0x0d,
+  0xa1, 0xa4, 0x10, 0x49, 0xc6, 0x5b, 0x83, 0xf8, 0xda, 0x40, 0xc1, 0xfe, 0x3d, 0x79, 0xd1, 0xfd,
+  0xee, 0xbf, 0x59, 0xa8, 0x0b, 0x42, 0xdc, 0x79, 0x7f, 0xf4, 0xba, 0x77, 0x79, 0x9f, 0x7c, 0x7a,
+  0x0f, 0x96, 0x4f, 0x08, 0x00, 0x93, 0x09, 0xa1, 0x0e, 0x25, 0xb0, 0x5f, 0x42, 0x25, 0x93, 0xff,
+  0x02, 0x24, 0x54, 0x96, 0x36, 0x53, 0x09, 0x7d, 0xc7, 0xae, 0x68, 0x48, 0x4e, 0x68, 0xe4, 0x92,
+  0x53, 0xdf, 0x25, 0x05, 0x59, 0x4c, 0x7d, 0x8a, 0xb4, 0xe2, 0xc9, 0xe4, 0xd4, 0x1f, 0x06, 0xa9,
+  0x60, 0x7e, 0x36, 0x4b, 0x08, 0x80, 0x27, 0x34, 0xba, 0x3b, 0x0b, 0xa8, 0xf3, 0x3f, 0x6b, 0x0c,
+  0x3b, 0xe7, 0x47, 0xdd, 0xcb, 0xd7, 0xd9, 0xeb, 0xeb, 0xe3, 0xb3, 0xcb, 0xa3, 0x77, 0xd9, 0x3b,
+  0x84, 0x6c, 0xf7, 0xc9, 0x51, 0xfc, 0x00, 0x39, 0xda, 0x9d, 0x93, 0x23, 0x25, 0x43, 0x64, 0x8c,
+  0xcc, 0x70, 0xfd, 0xbf, 0x04, 0x61, 0x92, 0x4e, 0x3e, 0x95, 0x25, 0xf7, 0x86, 0xde, 0x51, 0xbe,
+  0x86, 0x60, 0xc4, 0xcc, 0x03, 0x2c, 0x75, 0xa7, 0x2e, 0x9e, 0x10, 0x5d, 0x6e, 0x97, 0x02, 0x37,
+  0x46, 0xff, 0x08, 0xc0, 0x83, 0x10, 0xe7, 0x11, 0x88, 0x59, 0x12, 0xc0, 0x01, 0x02, 0x9c, 0xe3,
+  0xf3, 0x4b, 0x60, 0x9a, 0x6c, 0x46, 0x69, 0x14, 0xc0, 0x00, 0x2a, 0xcc, 0x4c, 0x56, 0x01, 0xe5,
+  0x77, 0x21, 0x00, 0x70, 0x28, 0x57, 0x71, 0xcf, 0xf8, 0x25, 0x3e, 0xae, 0x2d, 0xa7, 0x08, 0x48,
+  0x08, 0x29, 0x8f, 0xc4, 0xae, 0x7f, 0xfd, 0x47, 0xb0, 0x9a, 0x47, 0xef, 0x4e, 0xff, 0xf7, 0x5b,
+  0xb7, 0xf1, 0x83, 0xad, 0x1b, 0x07, 0xb3, 0xe0, 0x8b, 0xdd, 0x91, 0xc4, 0xe7, 0xc9, 0x15, 0xb8,
+  0xe3, 0x49, 0x42, 0x39, 0x89, 0x24, 0x8b, 0x57, 0x8b, 0x66, 0xbe, 0x28, 0xa0, 0x0f, 0x31, 0x14,
+  0xc5, 0xcf, 0xc5, 0xa3, 0x3c, 0xb6, 0x5e, 0xdb, 0x5d, 0xa5, 0x84, 0x1f, 0x52, 0x2f, 0x16, 0x94,
+  0xff, 0x97, 0xff, 0x20, 0x67, 0xc7, 0xcf, 0x4f, 0x4f, 0xc8, 0x99, 0xa0, 0xcc, 0x12, 0xfa, 0xeb,
+  0x8f, 0x5c, 0x3a, 0x24, 0x32, 0x6e, 0xac, 0xc6, 0xe6, 0xea, 0x0b, 0x83, 0xc8, 0x0d, 0x41, 0x7c,
+  0x8c, 0x24, 0x66, 0x20, 0xe8, 0x10, 0x5f, 0x72, 0xa3, 0xbd, 0x31, 0x00, 0x49, 0xe5, 0xe4, 0xe4,
+  0x6d, 0xb7, 0x47, 0x0e, 0x89, 0x76, 0x70, 0x36, 0x22, 0x86, 0x82, 0xd5, 0xde, 0xf0, 0x18, 0x27,
+  0x37, 0x71, 0x95, 0x44, 0x0c, 0x46, 0xfa, 0xbd, 0x49, 0x24, 0x9b, 0x12, 0x0c, 0xe9, 0x60, 0xc6,
+  0x87, 0x1f, 0xaa, 0xe8, 0x17, 0x72, 0x8f, 0xe8, 0x6b, 0xdf, 0x0e, 0x87, 0x31, 0x0c, 0x3a, 0x24,
+  0x75, 0x39, 0x7a, 0x42, 0x6f, 0x2f, 0xd5, 0x84, 0xdd, 0x7a, 0x9b, 0x10, 0x02, 0x94, 0x77, 0x5c,
+  0x08, 0x7b, 0x41, 0xe9, 0x12, 0x97, 0x38, 0x68, 0x08, 0xd0, 0x08, 0x27, 0xb1, 0x0d, 0x43, 0xc5,
+  0x94, 0x90, 0xf9, 0xce, 0x65, 0x6e, 0x11, 0x7c, 0x3f, 0xd3, 0x0b, 0x69, 0x10, 0x32, 0x5c, 0xbd,
+  0xa3, 0xfe, 0x08, 0x9e, 0x39, 0x7e, 0x00, 0xcc, 0x5a, 0x48, 0x23, 0x2e, 0x91, 0x7c, 0xc7, 0xae,
+  0x61, 0x7c, 0xad, 0x51, 0x25, 0xc9, 0x71, 0x18, 0x0c, 0xc6, 0xe2, 0x05, 0x27, 0xab, 0x1f, 0x80,
+  0x71, 0x8d, 0x09, 0x84, 0x86, 0x84, 0xbb, 0x22, 0x66, 0x18, 0x05, 0x3c, 0xb8, 0x0a, 0x3c, 0x02,
+  0x11, 0x1f, 0xa7, 0x96, 0x00, 0xd5, 0x0f, 0x02, 0x7e, 0x24, 0x77, 0x44, 0x4a, 0x7f, 0x00, 0x14,
+  0x6a, 0x99, 0xed, 0x07, 0x10, 0x69, 0x90, 0x98, 0x82, 0x0c, 0xc9, 0xfa, 0x12, 0xce, 0x24, 0x66,
+  0x7e, 0x8b, 0x49, 0x28, 0x61, 0x22, 0xbb, 0xd5, 0xee, 0xf0, 0xf1, 0x0d, 0xbb, 0xc5, 0x57, 0x3f,
+  0xf1, 0xbc, 0x76, 0x0a, 0x53, 0xc9, 0x21, 0x49, 0x03, 0x0e, 0xb9, 0xdb, 0x38, 0x71, 0xe8, 0x18,
+  0x48, 0x88, 0xb2, 0x2a, 0x60, 0x81, 0x6f, 0x41, 0xde, 0x90, 0xa5, 0x3f, 0x08, 0x8b, 0x0d, 0x23,
+  0x16, 0x8f, 0xe1, 0x13, 0x5d, 0xa1, 0xe3, 0x72, 0xb0, 0x6f, 0x94, 0xc4, 0x4c, 0x02, 0xe3, 0x34,
+  0x54, 0xc2, 0x70, 0xd9, 0x3d, 0xfe, 0xdb, 0xe7, 0xa7, 0x6f, 0x00, 0x97, 0x2f, 0xb6, 0x3e, 0x3c,
+  0x7b, 0xfc, 0xc3, 0x8f, 0x71, 0xe0, 0xff, 0x4d, 0x7f, 0xcb, 0xe6, 0x2c, 0xe6, 0x66, 0x2a, 0x22,
+  0x31, 0x84, 0x56, 0x83, 0xb1, 0xa5, 0x58, 0xf1, 0x0c, 0x07, 0xc1, 0x8c, 0x90, 0x5e, 0xc5, 0x14,
+  0xb5, 0x2a, 0x56, 0xc0, 0x8e, 0x2f, 0xde, 0xbe, 0x38, 0xf9, 0xdb, 0x73, 0x01, 0xae, 0xf1, 0xa4,
+  0xae, 0x7e, 0xb4, 0xdc, 0x85, 0xd4, 0x69, 0xe2, 0x9e, 0xc9, 0x61, 0x87, 0x74, 0x41, 0x24, 0xfd,
+  0x91, 0xe9, 0x5b, 0x36, 0xb4, 0x76, 0x81, 0x1d, 0xdc, 0x6c, 0x56, 0x8d, 0xba, 0x61, 0xb5, 0x37,
+  0x86, 0x89, 0x2f, 0x6c, 0x2a, 0x19, 0x4e, 0x78, 0x2f, 0x36, 0x79, 0x6c, 0x4d, 0x37, 0xdc, 0x21,
+  0x7c, 0x92, 0x43, 0x49, 0x30, 0x0b, 0x36, 0xc5, 0x93, 0xc8, 0x27, 0x06, 0x88, 0xb4, 0xec, 0x79,
+  0x9a, 0x2d, 0x6d, 0x6d, 0xe8, 0xde, 0x4d, 0x63, 0x13, 0x97, 0x34, 0xcf, 0x29, 0x1f, 0xdb, 0x43,
+  0x2f, 0x08, 0x22, 0x18, 0xba, 0xb5, 0xbd, 0x57, 0xaf, 0x5b, 0xd6, 0xa6, 0xd1, 0x2a, 0xed, 0xdd,
+  0xab, 0x5b, 0x5f, 0xc1, 0xdf, 0xac, 0x9b, 0xc7, 0xf8, 0xae, 0xb7, 0xe0, 0x20, 0xfe, 0xec, 0x46,
+  0x70, 0x1f, 0xba, 0xbe, 0x6e, 0xc0, 0xf6, 0xa0, 0x53, 0xad, 0xe8, 0xd8, 0x23, 0xc6, 0x5f, 0x01,
+  0x86, 0xdf, 0x03, 0xb9, 0x4c, 0x00, 0x52, 0x53, 0x40, 0x44, 0xc7, 0x79, 0xe0, 0xf3, 0x31, 0xb4,
+  0x36, 0xe6, 0x3b, 0x04, 0x30, 0x44, 0x09, 0x50, 0xde, 0xc8, 0x9a, 0x4f, 0x82, 0x04, 0x13, 0xa9,
+  0x1c, 0x2e, 0x12, 0x8c, 0xeb, 0x27, 0xc0, 0x9c, 0xc5, 0x8e, 0x2e, 0x2a, 0xad, 0x83, 0x1d, 0xed,
+  0x8d, 0x59, 0x46, 0x45, 0x16, 0x0f, 0x4c, 0x24, 0xa1, 0xc2, 0x51, 0x11, 0x3e, 0xb6, 0x36, 0xec,
+  0x88, 0x85, 0x1e, 0x1d, 0x30, 0x73, 0xeb, 0xf1, 0xd6, 0xa8, 0x6a, 0x3c, 0xa6, 0x93, 0xb0, 0x6d,
+  0xe4, 0x9b, 0x9f, 0x8a, 0x66, 0x8f, 0x17, 0x5b, 0x3b, 0xa2, 0x75, 0x34, 0xd7, 0x5a, 0x11, 0xad,
+  0x3f, 0x25, 0x01, 0xb6, 0x17, 0xd6, 0x9f, 0x84, 0x2f, 0x01, 0x31, 0x87, 0x99, 0x7d, 0x40, 0x42,
+  0x51, 0xf1, 0x3a, 0x23, 0x23, 0x15, 0xe1, 0x7a, 0xdf, 0xee, 0x27, 0xc3, 0x21, 0x8b, 0xaa, 0x04,
+  0x9e, 0xee, 0x38, 0x93, 0x36, 0x45, 0xbf, 0x9d, 0x31, 0x7f, 0xc4, 0xc7, 0x29, 0x13, 0xb8, 0xe6,
+  0x42, 0x0f, 0x94, 0x48, 0x02, 0x07, 0x6a, 0x4b, 0xe3, 0xe3, 0x4a, 0x3b, 0x24, 0x07, 0x82, 0xdd,
+  0xd3, 0xf2, 0x36, 0x25, 0xaa, 0x09, 0x1a, 0xb8, 0x63, 0x3b, 0x0a, 0x25, 0x3b, 0x4e, 0xc0, 0x2a,
+  0x45, 0xf4, 0xce, 0x74, 0xab, 0xc4, 0xdd, 0xf4, 0x81, 0x76, 0x00, 0x62, 0x13, 0x26, 0xb5, 0xb5,
+  0x90, 0xc5, 0x64, 0xa6, 0xe1, 0xc1, 0xc8, 0x79, 0x78, 0x54, 0x99, 0xa8, 0x9b, 0xb1, 0xeb, 0x31,
+  0xd3, 0xaf, 0xd5, 0x2c, 0x42, 0xed, 0x30, 0x89, 0xc7, 0x26, 0x78, 0x76, 0x64, 0x85, 0x06, 0x43,
+  0x33, 0x30, 0x13, 0x50, 0xc8, 0x39, 0x30, 0x01, 0x34, 0x4c, 0x67, 0x79, 0x30, 0xba, 0xe7, 0x0a,
+  0x7a, 0x04, 0xa8, 0x36, 0x09, 0x3e, 0x5c, 0xfd, 0xa0, 0xdf, 0xc8, 0x4c, 0x03, 0x0e, 0x10, 0x70,
+  0x4a, 0x6d, 0xd1, 0xa9, 0xe9, 0x8c, 0x16, 0xa6, 0xff, 0xc1, 0xdd, 0xdc, 0xfc, 0x41, 0xea, 0x09,
+  0xa8, 0x49, 0xfd, 0x76, 0xbf, 0x6e, 0x11, 0x3d, 0x97, 0xe7, 0xda, 0x0f, 0x72, 0xed, 0x80, 0x21,
+  0xb4, 0x3e, 0x26, 0x8d, 0x5d, 0x2b, 0x37, 0x82, 0xe6, 0x46, 0x00, 0x29, 0x4a, 0x46, 0x0c, 0x72,
+  0x23, 0x80, 0xf8, 0x62, 0xc4, 0x76, 0x43, 0x8f, 0xe8, 0x00, 0x6b, 0x6e, 0x59, 0x3d, 0x55, 0x5f,
+  0x4e, 0x6a, 0xa4, 0xb9, 0xbb, 0xd7, 0xde, 0x88, 0x6f, 0x5c, 0x3e, 0x18, 0x9b, 0x1c, 0x11, 0xc7,
+  0x4b, 0x43, 0x08, 0xa8, 0xa5, 0x47, 0x09, 0x13, 0x99, 0xb6, 0x37, 0xd3, 0x76, 0xe1, 0x36, 0xb3,
+  0x8e, 0xed, 0xb4, 0x03, 0x03, 0x99, 0xac, 0x7d, 0x90, 0xb6, 0x6b, 0x4a, 0xe8, 0x1e, 0xa7, 0x25,
+  0x59, 0xdd, 0x4c, 0x79, 0xe4, 0x5c, 0xa3, 0x1e, 0x5d, 0xba, 0x3e, 0x6f, 0xec, 0x99, 0x6e, 0xad,
+  0x69, 0x65, 0x83, 0x99, 0x1a, 0xbc, 0x53, 0x32, 0x78, 0xbb, 0x09, 0x83, 0x77, 0xb2, 0xc1, 0x4e,
+  0x73, 0xc9, 0xe0, 0xd3, 0x92, 0xb1, 0x07, 0xad, 0x3c, 0xc1, 0x24, 0x8e, 0xb9, 0x6e, 0xba, 0x80,
+  0x24, 0x0e, 0x5b, 0x40, 0x34, 0x37, 0x63, 0xb0, 0x30, 0x03, 0x79, 0x55, 0x36, 0x63, 0xb6, 0xc1,
+  0xc7, 0x78, 0x0d, 0x00, 0x55, 0xe9, 0x38, 0x8a, 0xc0, 0x00, 0x1a, 0x93, 0x78, 0x14, 0x42, 0x38,
+  0x0c, 0x70, 0x8c, 0x4d, 0x6e, 0xf3, 0x40, 0x59, 0x8b, 0xc6, 0x9e, 0x1c, 0xaf, 0x00, 0x4a, 0x79,
+  0x84, 0x77, 0xd4, 0x38, 0x11, 0x78, 0x88, 0x50, 0x21, 0x15, 0x42, 0xd1, 0x64, 0x02, 0xac, 0x2a,
+  0x09, 0xae, 0x0e, 0x45, 0x60, 0xa9, 0x45, 0x92, 0x79, 0x20, 0x93, 0x4e, 0x30, 0x48, 0x26, 0xcc,
+  0xe7, 0x88, 0xd2, 0xb1, 0xc7, 0xf0, 0xf1, 0xf9, 0xdd, 0xa9, 0x63, 0x1a, 0x62, 0x22, 0xda, 0x0f,
+  0xe6, 0xd9, 0x78, 0xb4, 0xf3, 0x42, 0x5e, 0x07, 0x81, 0x29, 0x66, 0x70, 0x45, 0x9e, 0x11, 0xe3,
+  0xd7, 0x3f, 0xfe, 0x9e, 0x18, 0xa4, 0x85, 0x0f, 0x7f, 0x20, 0x86, 0x45, 0x36, 0x09, 0xac, 0x02,
+  0x78, 0x5e, 0xe2, 0xad, 0xba, 0x17, 0x40, 0x01, 0x53, 0x4e, 0x16, 0xb1, 0xd7, 0x1b, 0x88, 0x69,
+  0x60, 0xaa, 0x81, 0x67, 0xea, 0x30, 0x6b, 0x53, 0x03, 0x09, 0xae, 0x04, 0x08, 0x16, 0x45, 0xb8,
+  0x94, 0x28, 0x1b, 0xf4, 0xdc, 0x09, 0x0b, 0x12, 0x6e, 0xea, 0xcd, 0x40, 0xbb, 0x7e, 0x04, 0x08,
+  0x60, 0x8a, 0xf4, 0x00, 0xd3, 0x3a, 0xec, 0x4c, 0x89, 0x5e, 0xe1, 0x0c, 0x3c, 0x39, 0xd8, 0xc0,
+  0x49, 0x70, 0xcd, 0x4c, 0xb1, 0x0c, 0xa0, 0x34, 0xab, 0x92, 0xe6, 0xbe, 0xf0, 0x0a, 0x39, 0x23,
+  0x98, 0x84, 0x18, 0xa0, 0x83, 0x9f, 0xe3, 0x71, 0xa6, 0x9e, 0x09, 0x80, 0x16, 0xa1, 0x95, 0xed,
+  0x09, 0x03, 0x07, 0x11, 0x95, 0x08, 0xcb, 0x46, 0x59, 0xc3, 0x10, 0x1a, 0xd2, 0x78, 0xaa, 0x46,
+  0x92, 0xf6, 0xc6, 0x52, 0xda, 0xc5, 0x97, 0x86, 0x35, 0x47, 0xb4, 0x95, 0xc3, 0xcf, 0x16, 0x86,
+  0x7b, 0xab, 0x86, 0xbf, 0x5a, 0x18, 0x3e, 0x5c, 0x89, 0xcc, 0x73, 0x0a, 0xd4, 0xb5, 0x45, 0x8a,
+  0x65, 0xcb, 0xab, 0xfb, 0xc0, 0xc4, 0x64, 0x4b, 0x6f, 0x06, 0x3d, 0x27, 0x38, 0xb0, 0xaf, 0x8c,
+  0x95, 0x28, 0x96, 0x01, 0x11, 0xfe, 0x7a, 0xe2, 0xfa, 0xa6, 0xb7, 0xd5, 0xac, 0x23, 0x98, 0xea,
+  0x3a, 0xa0, 0x5e, 0x95, 0xe2, 0x33, 0x2c, 0xc3, 0x07, 0x6c, 0x55, 0x8e, 0x07, 0x29, 0xb7, 0x80,
+  0xdf, 0x5c, 0xb1, 0xe7, 0x43, 0xae, 0xbf, 0xd6, 0x00, 0x93, 0x22, 0xd9, 0xdb, 0x13, 0xa7, 0x19,
+  0xe6, 0xc7, 0xb3, 0xa3, 0x6e, 0xaf, 0x45, 0xbe, 0x9c, 0xe2, 0x0c, 0x71, 0x86, 0x3e, 0x13, 0x5f,
+  0x97, 0xf0, 0xe5, 0x54, 0x06, 0x34, 0xa2, 0x19, 0xa2, 0x9a, 0xd9, 0x47, 0x21, 0x23, 0x0b, 0x52,
+  0xa2, 0xc0, 0x00, 0xad, 0x23, 0x0a, 0xab, 0xe7, 0xfa, 0x23, 0x08, 0x8b, 0x59, 0xa4, 0x0a, 0xac,
+  0xa9, 0x91, 0xef, 0xaf, 0xd2, 0x28, 0x59, 0xa2, 0x34, 0xa4, 0x09, 0xfe, 0x22, 0x2f, 0x6d, 0x00,
+  0x80, 0xf7, 0x6d, 0x71, 0x66, 0x77, 0xd2, 0x3b, 0x3f, 0x3b, 0x34, 0x3e, 0xa1, 0x48, 0x24, 0x42,
+  0x68, 0xce, 0x22, 0x19, 0x51, 0x67, 0xf9, 0x93, 0xa1, 0x49, 0xa2, 0x24, 0x5e, 0x9b, 0x22, 0x61,
+  0x73, 0x72, 0x8b, 0xa6, 0x0a, 0x80, 0x0e, 0xc7, 0x4c, 0xaa, 0x2e, 0x68, 0xd7, 0x47, 0x9d, 0x3b,
+  0x3a, 0xf3, 0xb9, 0xe3, 0x97, 0x53, 0x65, 0x8e, 0x5c, 0x88, 0xa1, 0xe6, 0xe3, 0xc6, 0x99, 0x58,
+  0x1d, 0xa7, 0x75, 0xca, 0x53, 0x66, 0x99, 0xab, 0xf9, 0x93, 0x2f, 0xa7, 0xee, 0xac, 0xa2, 0xf3,
+  0xee, 0x2f, 0xa7, 0x18, 0x1e, 0x25, 0x82, 0x4b, 0x16, 0x34, 0x83, 0x38, 0x48, 0xea, 0x1c, 0x56,
+  0x1a, 0x07, 0x15, 0x12, 0x87, 0xcc, 0xf3, 0x06, 0x63, 0x86, 0xf9, 0x9a, 0xf0, 0x37, 0xa2, 0x26,
+  0xec, 0x14, 0xb0, 0x4b, 0x8b, 0xcc, 0x85, 0x2a, 0x93, 0xba, 0x8b, 0x89, 0x48, 0xcb, 0x15, 0xa0,
+  0x01, 0x71, 0x14, 0x45, 0xa6, 0x52, 0x18, 0xb2, 0x16, 0xbd, 0x24, 0x77, 0x94, 0x67, 0x37, 0x59,
+  0x71, 0x89, 0x5e, 0x33, 0xb4, 0x6e, 0x26, 0x6e, 0x46, 0x94, 0x3a, 0x7f, 0x9f, 0xe6, 0x8b, 0xa5,
+  0xc0, 0x65, 0x39, 0xbb, 0x1c, 0x78, 0xc4, 0x9c, 0x0a, 0xc4, 0xf5, 0x29, 0x70, 0x18, 0x8b, 0x22,
+  0x26, 0x60, 0x57, 0x8d, 0x22, 0x85, 0x0c, 0x59, 0x57, 0x9d, 0x5f, 0x0c, 0x79, 0xfe, 0xd1, 0xb2,
+  0x7f, 0x0c, 0x40, 0x2d, 0x0d, 0x14, 0xb6, 0x22, 0xf7, 0x37, 0xa4, 0xe0, 0x9e, 0x80, 0xb5, 0x54,
+  0xc2, 0xdb, 0x5e, 0x14, 0xeb, 0x5c, 0xaf, 0x16, 0xed, 0x78, 0xb5, 0xb7, 0x10, 0xa5, 0x14, 0xc3,
+  0xaa, 0x92, 0x41, 0x22, 0xad, 0xb4, 0x67, 0x0b, 0xb6, 0x42, 0x40, 0x01, 0x8f, 0x79, 0x21, 0x33,
+  0xee, 0x29, 0xb7, 0x80, 0x73, 0xd8, 0xc8, 0x04, 0x31, 0x01, 0x21, 0x9c, 0x9b, 0x50, 0xe0, 0x62,
+  0xc6, 0x54, 0x49, 0x94, 0x14, 0x4c, 0x81, 0x04, 0x29, 0x3a, 0xb0, 0x3e, 0x20, 0x58, 0xb2, 0x63,
+  0xcc, 0x70, 0xcd, 0x21, 0x30, 0x63, 0xfc, 0xca, 0x8d, 0x62, 0x7e, 0x28, 0x0b, 0x01, 0xeb, 0xe9,
+  0xb5, 0x97, 0xea, 0xb5, 0x1c, 0xad, 0xee, 0x50, 0x61, 0x34, 0x6a, 0xdb, 0x78, 0x0d, 0x26, 0xfe,
+  0x01, 0x1c, 0x13, 0xe6, 0xbb, 0xe0, 0x12, 0xed, 0x18, 0x38, 0xcb, 0xcc, 0x42, 0xbe, 0xae, 0x2c,
+  0x82, 0x9a, 0xf7, 0x19, 0x6d, 0x42, 0x69, 0xe1, 0xf8, 0x01, 0x06, 0x41, 0x63, 0x24, 0x4c, 0x82,
+  0x97, 0x99, 0x04, 0x59, 0xd1, 0x8e, 0xa4, 0xfa, 0xc2, 0xbf, 0x87, 0x87, 0x87, 0xf5, 0xc7, 0x8f,
+  0x33, 0xf2, 0x3d, 0x33, 0xb4, 0xc2, 0xcb, 0x6b, 0xe9, 0x15, 0xc8, 0x8e, 0x8c, 0xd9, 0x6a, 0x43,
+  0x92, 0xb3, 0xe3, 0xe0, 0x5d, 0xdd, 0x9c, 0x51, 0xd9, 0x9e, 0x33, 0x2a, 0xba, 0x58, 0x78, 0xcf,
+  0x2f, 0xeb, 0xe0, 0xed, 0x26, 0x2d, 0x1e, 0x5e, 0x2a, 0x1e, 0xa9, 0x61, 0x5a, 0x61, 0x21, 0xbc,
+  0xd5, 0x16, 0x42, 0x5d, 0x98, 0xd6, 0xa3, 0x95, 0x27, 0x41, 0x37, 0x92, 0x2e, 0x70, 0x9f, 0x12,
+  0xe6, 0xe4, 0xaf, 0x78, 0x54, 0x32, 0xdd, 0x98, 0xaf, 0xe4, 0xe4, 0xe8, 0xa2, 0x95, 0x57, 0x08,
+  0xab, 0x0e, 0x8b, 0x4c, 0x03, 0x87, 0x0b, 0x56, 0x3b, 0x6e, 0x1f, 0x8b, 0x2a, 0xe3, 0x2b, 0xea,
+  0xcf, 0x25, 0x7e, 0x58, 0x42, 0x62, 0x03, 0xfe, 0xbe, 0x2b, 0x14, 0x3a, 0x1f, 0x65, 0xa5, 0xe5,
+  0x25, 0x98, 0x70, 0x13, 0xab, 0x64, 0xee, 0x3d, 0xeb, 0x77, 0x03, 0xf0, 0x7c, 0x00, 0xfc, 0x06,
+  0xbf, 0x32, 0xc8, 0xd8, 0xc4, 0x3a, 0x15, 0xe4, 0xb8, 0xfb, 0x0d, 0x43, 0x8c, 0xb3, 0xfb, 0xae,
+  0x4f, 0xa3, 0xbb, 0xde, 0x5d, 0x28, 0xa2, 0x3a, 0x91, 0xb6, 0xc9, 0xac, 0xd1, 0x10, 0xdd, 0x81,
+  0x1f, 0x84, 0x0c, 0xcb, 0x12, 0x22, 0x46, 0xd3, 0x35, 0x07, 0xd7, 0x5b, 0x69, 0x43, 0xe4, 0xbd,
+  0x1d, 0x5c, 0x40, 0x7c, 0xa1, 0x40, 0x16, 0xd5, 0x51, 0x07, 0x7a, 0x03, 0xb1, 0xa7, 0x15, 0x93,
+  0xc5, 0xdd, 0x9d, 0x85, 0xc8, 0xc8, 0x78, 0xfb, 0x06, 0xaf, 0xf2, 0x48, 0xb4, 0x40, 0x13, 0x1c,
+  0xf3, 0xaf, 0xba, 0x6f, 0xdf, 0xd8, 0xb1, 0x10, 0x3a, 0x77, 0x78, 0x67, 0x4e, 0x07, 0x13, 0xa7,
+  0x65, 0x70, 0xf1, 0x9d, 0x3b, 0x84, 0x61, 0xb1, 0xaa, 0x95, 0x2b, 0x43, 0x64, 0xa5, 0xa5, 0x2d,
+  0x51, 0x5f, 0xa8, 0x6e, 0xf0, 0x9f, 0x5b, 0xb5, 0xb4, 0xec, 0x60, 0x21, 0x1e, 0x48, 0xca, 0x9f,
+  0x03, 0x5f, 0x25, 0xca, 0xa6, 0x35, 0xb3, 0xa4, 0x42, 0xab, 0x72, 0x8e, 0x45, 0x56, 0xae, 0x0c,
+  0xe2, 0x63, 0x54, 0x81, 0x9c, 0xad, 0x86, 0x98, 0x17, 0xb1, 0x9f, 0xba, 0x77, 0xfe, 0xc0, 0xb4,
+  0xee, 0x41, 0x18, 0xd6, 0x45, 0x31, 0x30, 0xc4, 0xa4, 0xc2, 0x01, 0x07, 0x30, 0x5e, 0xf1, 0x60,
+  0xe0, 0x05, 0x31, 0xfb, 0x5c, 0x4c, 0xd0, 0xa1, 0xf5, 0x27, 0xf3, 0x41, 0xde, 0xa9, 0x32, 0x70,
+  0x8b, 0x4a, 0xe4, 0x8a, 0xe1, 0x7c, 0x2a, 0xa3, 0x55, 0xb2, 0x2d, 0x4b, 0x39, 0x7a, 0x1f, 0x0c,
+  0x13, 0x22, 0xb5, 0x0f, 0x24, 0xa6, 0xd8, 0x97, 0xa2, 0x50, 0xe0, 0x4f, 0x58, 0x1c, 0xd3, 0x91,
+  0xd8, 0x27, 0x13, 0x1b, 0xc5, 0x4c, 0xc8, 0x01, 0xed, 0x88, 0xee, 0xa6, 0xa2, 0x48, 0x84, 0x55,
+  0xf9, 0x60, 0x48, 0x98, 0x8d, 0xa5, 0x4a, 0x30, 0x55, 0x86, 0xa4, 0xa5, 0x01, 0xf9, 0x87, 0x20,
+  0x6d, 0x88, 0x5f, 0xd1, 0x65, 0xca, 0x6e, 0x0b, 0xb2, 0x91, 0xb4, 0x4a, 0x82, 0x6c, 0xc6, 0x34,
+  0x6d, 0xff, 0x48, 0x94, 0x25, 0xd4, 0x08, 0x48, 0x2b, 0x20, 0xc1, 0x83, 0x24, 0x79, 0xaa, 0x93,
+  0xba, 0x19, 0x72, 0xdb, 0xb1, 0x45, 0xf5, 0x5f, 0x80, 0xc7, 0x6a, 0xa3, 0x01, 0x9a, 0x96, 0x16,
+  0x2f, 0x73, 0x15, 0xca, 0x1a, 0x71, 0xec, 0x24, 0x14, 0xd5, 0x2a, 0xc0, 0x11, 0xbc, 0xfc, 0xa5,
+  0xb8, 0x3a, 0x66, 0x4a, 0x99, 0x71, 0xb0, 0x0e, 0x6b, 0xe5, 0xeb, 0xb6, 0xa2, 0xe5, 0x61, 0xb9,
+  0x06, 0x2c, 0x80, 0x93, 0x1f, 0x96, 0x42, 0xe4, 0x52, 0x9b, 0x74, 0xfe, 0x0c, 0xf2, 0x37, 0x90,
+  0xa0, 0xc2, 0xee, 0x44, 0x97, 0x21, 0xeb, 0x80, 0x5f, 0x38, 0x48, 0x3c, 0x6e, 0xcd, 0x15, 0x8d,
+  0x41, 0x76, 0xf4, 0xbb, 0xac, 0xbf, 0x80, 0x1b, 0x34, 0x15, 0xd0, 0x5f, 0x7e, 0xf9, 0xf0, 0x83,
+  0xd2, 0x0f, 0x98, 0x8d, 0x85, 0x7b, 0x00, 0xa5, 0x8b, 0xda, 0xe9, 0xb4, 0xf6, 0x02, 0x44, 0x55,
+  0x52, 0x76, 0xd0, 0x93, 0xb6, 0xb3, 0xaa, 0xb2, 0x63, 0x0b, 0x95, 0xd5, 0x96, 0x31, 0x17, 0xd2,
+  0x94, 0xe1, 0x2e, 0xea, 0xca, 0x0a, 0x77, 0x01, 0xf0, 0x29, 0x49, 0x4b, 0x20, 0xab, 0x4b, 0xb8,
+  0xb1, 0x4f, 0x43, 0x48, 0x2a, 0xb9, 0x72, 0xae, 0xb2, 0xe8, 0x2d, 0x19, 0x26, 0x10, 0xf8, 0xe2,
+  0xf0, 0x50, 0xe1, 0xf4, 0xcb, 0x2f, 0x12, 0x49, 0x6c, 0x81, 0x25, 0x20, 0x3c, 0x9e, 0x66, 0x60,
+  0xd0, 0x29, 0x07, 0x21, 0x86, 0xe9, 0x1e, 0xbb, 0xa1, 0x7c, 0x25, 0x80, 0x0e, 0x4e, 0x47, 0xec,
+  0x52, 0x83, 0x90, 0xf9, 0x69, 0x1a, 0x86, 0xde, 0xdd, 0x4b, 0xdc, 0x8d, 0xe9, 0x58, 0x73, 0xc4,
+  0x59, 0x24, 0xc5, 0x22, 0x21, 0xd0, 0xa9, 0x94, 0xf1, 0x30, 0x2b, 0xf4, 0x6f, 0xe8, 0xd7, 0x3c,
+  0x07, 0x71, 0x5a, 0x19, 0x03, 0xf5, 0x49, 0x84, 0x9e, 0xd3, 0x9e, 0x3f, 0x35, 0x28, 0xf8, 0x2d,
+  0x52, 0xce, 0x1c, 0x0a, 0xde, 0xdb, 0x77, 0x0c, 0xe9, 0x02, 0xd5, 0xb2, 0x53, 0x74, 0xdb, 0x2d,
+  0x47, 0x78, 0xef, 0x2a, 0x01, 0xaf, 0x0c, 0xcf, 0xf0, 0x6f, 0x95, 0xf0, 0x18, 0x9e, 0x78, 0x3c,
+  0xb3, 0x0a, 0x3e, 0x51, 0x94, 0x37, 0xb4, 0x5f, 0x94, 0xb3, 0x36, 0x0d, 0x79, 0xe7, 0x0d, 0x8c,
+  0xbb, 0xea, 0x2d, 0xb8, 0x3f, 0x59, 0xbe, 0x07, 0x9c, 0xe4, 0x43, 0xd1, 0x22, 0xe5, 0xcc, 0x6a,
+  0x95, 0x34, 0x76, 0x55, 0x21, 0x61, 0x11, 0x73, 0x75, 0x69, 0xc8, 0x48, 0xe3, 0xc5, 0xab, 0xbe,
+  0x2e, 0x2a, 0x0a, 0x57, 0x22, 0x0e, 0x34, 0x4d, 0x1f, 0x3c, 0x48, 0x73, 0x07, 0x12, 0xdb, 0xd7,
+  0x80, 0xcb, 0x24, 0x16, 0xf9, 0x16, 0x0e, 0x49, 0xe2, 0xa7, 0x68, 0x0c, 0xc0, 0x1a, 0x25, 0xf1,
+  0xa6, 0xf1, 0xe7, 0x7f, 0x8b, 0xb1, 0x22, 0x62, 0x26, 0xb1, 0x74, 0x38, 0x36, 0x0f, 0x5e, 0xe1,
+  0x6f, 0x65, 0x98, 0x58, 0xaa, 0x9e, 0xc4, 0xab, 0x12, 0x6b, 0xbc, 0xcd, 0x34, 0xaf, 0xd6, 0x1b,
+  0xc6, 0xc9, 0xf1, 0xd1, 0x05, 0x31, 0x36, 0xaf, 0xfa, 0x80, 0xf0, 0x98, 0xd1, 0x10, 0x6b, 0xdb,
+  0x26, 0x1e, 0x0b, 0xe4, 0xda, 0xce, 0x5d, 0x1f, 0x9a, 0xab, 0xe4, 0xf9, 0xd9, 0xdb, 0xd7, 0xba,
+  0x5d, 0xfc, 0xc6, 0x18, 0xb4, 0x5a, 0x84, 0xfc, 0xfa, 0x87, 0xdf, 0x11, 0x72, 0xf6, 0xf6, 0xed,
+  0x05, 0x09, 0x0f, 0x0e, 0xc8, 0xaf, 0xff, 0xf0, 0xaf, 0xc6, 0xe6, 0x24, 0x16, 0xe2, 0x10, 0x84,
+  0x17, 0x07, 0x07, 0xd6, 0xe6, 0x86, 0xa1, 0x06, 0x9d, 0xf4, 0x7a, 0x17, 0xb9, 0x01, 0xf8, 0x95,
+  0x83, 0x62, 0x80, 0xee, 0x7f, 0xdf, 0xcd, 0xf5, 0x82, 0xab, 0xc9, 0xf7, 0xbd, 0x82, 0x5c, 0xfd,
+  0x04, 0x56, 0x77, 0xec, 0x61, 0xfc, 0x1e, 0x5a, 0x7b, 0x97, 0x67, 0xa7, 0x5d, 0x63, 0xb9, 0x11,
+  0x1a, 0x8c, 0x41, 0x05, 0x99, 0x92, 0x62, 0x90, 0xc4, 0x18, 0xbf, 0x61, 0x42, 0x71, 0x5e, 0xd4,
+  0xbb, 0x14, 0xbf, 0x67, 0xe8, 0x47, 0x72, 0xb1, 0x50, 0x41, 0x77, 0xd4, 0xe4, 0x20, 0x14, 0x12,
+  0xe8, 0x80, 0xf8, 0xa9, 0x2c, 0x78, 0x95, 0xf8, 0xcd, 0x44, 0x61, 0x4b, 0xe3, 0x24, 0xe7, 0x82,
+  0x14, 0x02, 0x2a, 0xd8, 0x22, 0xe6, 0x7f, 0x70, 0x6c, 0xd7, 0xb9, 0xfd, 0x41, 0x41, 0x53, 0x6f,
+  0x02, 0x8e, 0xd0, 0x53, 0xf1, 0x30, 0x5b, 0x00, 0xe2, 0xa0, 0xe3, 0x9c, 0x2b, 0x72, 0x28, 0x74,
+  0x82, 0x30, 0xf5, 0x10, 0x00, 0x0a, 0x0c, 0x57, 0xa1, 0x7e, 0x50, 0x58, 0x06, 0x83, 0x46, 0x98,
+  0x3b, 0x57, 0xd0, 0x48, 0xed, 0x88, 0x40, 0xf2, 0x26, 0x7e, 0xfc, 0x18, 0xbc, 0x67, 0xc4, 0xa8,
+  0x73, 0x87, 0x51, 0x29, 0x52, 0xb5, 0x71, 0x4f, 0xa4, 0x12, 0xc3, 0x74, 0xa3, 0x2a, 0x43, 0x24,
+  0x69, 0xab, 0xaa, 0x60, 0x6f, 0x5a, 0x68, 0x7c, 0x66, 0xc2, 0x2b, 0xe6, 0xd7, 0xd2, 0xe9, 0xe3,
+  0xa7, 0x2e, 0x86, 0x15, 0x52, 0xe1, 0x69, 0x24, 0x68, 0x8a, 0x8b, 0x93, 0x74, 0x81, 0x34, 0xe9,
+  0x86, 0xfd, 0xa6, 0x04, 0xf3, 0x27, 0xab, 0x02, 0x1b, 0x7f, 0x62, 0x6c, 0xe2, 0x68, 0x99, 0x08,
+  0xda, 0xb0, 0xdc, 0x44, 0x51, 0xf4, 0x0b, 0x7f, 0x02, 0x78, 0xaa, 0x60, 0x1a, 0x4f, 0xc2, 0x49,
+  0xef, 0xf4, 0xe5, 0xd1, 0x6b, 0xf2, 0xfc, 0xed, 0xd9, 0xf1, 0x09, 0x79, 0xfd, 0x16, 0xd0, 0xfb,
+  0xd6, 0xa8, 0xca, 0x8c, 0xb0, 0x9d, 0xf9, 0x7c, 0x8c, 0x2f, 0xd4, 0xca, 0x68, 0x37, 0xe8, 0x0d,
+  0x75, 0x39, 0x19, 0x32, 0xac, 0x9e, 0xcb, 0x6b, 0x4a, 0x20, 0x12, 0x14, 0xa3, 0xca, 0xe9, 0x06,
+  0x18, 0x88, 0x71, 0x00, 0x9b, 0xba, 0x80, 0x28, 0xda, 0xa8, 0x6e, 0xc8, 0xcb, 0xe0, 0x71, 0x6b,
+  0x6a, 0x28, 0x3d, 0xad, 0x61, 0x20, 0x0d, 0x39, 0x12, 0x8a, 0xa6, 0x2b, 0x8f, 0xf9, 0xb6, 0x6e,
+  0x6b, 0x37, 0x37, 0x37, 0x35, 0xf1, 0xed, 0x2a, 0x09, 0x78, 0x0b, 0x1f, 0x23, 0x12, 0xc7, 0x98,
+  0x55, 0x37, 0xc4, 0x57, 0x30, 0x7e, 0x84, 0xad, 0x1c, 0x42, 0xe6, 0xe5, 0xdc, 0xce, 0x1e, 0x8b,
+  0x2f, 0x13, 0x85, 0x5c, 0x44, 0x0c, 0xb9, 0x7c, 0x77, 0xfa, 0x22, 0x98, 0x84, 0x10, 0x34, 0xf9,
+  0xdc, 0x84, 0x8d, 0xcd, 0x3e, 0x6e, 0xcc, 0x0a, 0x47, 0x66, 0x12, 0xcf, 0xc8, 0xc6, 0x73, 0xc3,
+  0x54, 0xa4, 0x82, 0x2b, 0xab, 0x40, 0x80, 0x97, 0xa7, 0xdd, 0xd3, 0xf3, 0x8b, 0xa3, 0x37, 0x86,
+  0x96, 0x74, 0xfc, 0x51, 0x03, 0xbe, 0x3d, 0xfa, 0xf6, 0xe8, 0x8c, 0xc8, 0x7e, 0x82, 0xa3, 0x53,
+  0xda, 0x6c, 0xcc, 0x54, 0x5c, 0xa4, 0x46, 0xbe, 0x7e, 0xfb, 0xe6, 0xf8, 0x75, 0xf7, 0x94, 0x88,
+  0x19, 0x7a, 0x94, 0xb0, 0xfe, 0x73, 0xec, 0xd4, 0x65, 0x0e, 0xd8, 0x4e, 0x55, 0x7c, 0x37, 0xaa,
+  0x72, 0x4d, 0x80, 0xf5, 0xd0, 0x8d, 0x26, 0xe6, 0xc7, 0x13, 0x0a, 0xfa, 0x28, 0x4b, 0x5c, 0x90,
+  0xff, 0x8b, 0x3a, 0x5e, 0xe5, 0xd9, 0x47, 0x2b, 0xf5, 0xdd, 0xf7, 0x33, 0x03, 0x96, 0x60, 0xfc,
+  0xbf, 0x9e, 0x19, 0x0f, 0xa4, 0xb6, 0xf2, 0x50, 0x2f, 0x4f, 0x4f, 0x8e, 0x2e, 0x2e, 0xbb, 0xcb,
+  0xa9, 0x2d, 0xbb, 0x1f, 0x4e, 0x67, 0x89, 0x08, 0xa4, 0x18, 0x2f, 0xd0, 0x9a, 0x63, 0x2c, 0x2c,
+  0x5c, 0x4e, 0xf1, 0x94, 0x16, 0x3c, 0x4f, 0x7a, 0xbc, 0x0b, 0xae, 0x27, 0x7d, 0x56, 0xa5, 0x8a,
+  0x06, 0x1e, 0x1a, 0xcd, 0xeb, 0x5f, 0x3e, 0xe1, 0x98, 0xde, 0x4f, 0x7d, 0x35, 0xde, 0x48, 0xdd,
+  0x75, 0x57, 0x36, 0x98, 0x45, 0xfa, 0x2c, 0x6e, 0x4d, 0x6e, 0xff, 0x1c, 0x2b, 0x44, 0x78, 0x9b,
+  0xfe, 0xf5, 0xd1, 0x45, 0x61, 0x7f, 0x73, 0x55, 0x1c, 0x0d, 0xd5, 0x59, 0xb3, 0x72, 0x13, 0xa7,
+  0x95, 0x9b, 0xe5, 0x43, 0xe4, 0xa5, 0xb4, 0x05, 0xbf, 0x0a, 0x6c, 0x74, 0xe8, 0xdd, 0x2f, 0xbf,
+  0x18, 0x3f, 0xd2, 0x89, 0x0a, 0x0a, 0x63, 0xd7, 0xbf, 0x8a, 0x30, 0x3d, 0x02, 0x8e, 0xfe, 0xf9,
+  0x4f, 0xc2, 0x93, 0x85, 0x11, 0x03, 0x13, 0xc7, 0xa1, 0x61, 0x4c, 0x1d, 0x37, 0xd2, 0xcd, 0xf8,
+  0xbb, 0x83, 0xd0, 0xc6, 0xf1, 0x3b, 0x3e, 0x88, 0xd9, 0x49, 0xdb, 0x8e, 0xf0, 0xfb, 0x34, 0xc0,
+  0xe5, 0xa6, 0xd7, 0x43, 0xa2, 0xe0, 0x46, 0xe6, 0x00, 0xe2, 0x57, 0x69, 0xed, 0x38, 0x88, 0xb8,
+  0x69, 0xd2, 0x6a, 0x1f, 0xf2, 0x1c, 0x6a, 0x0f, 0xb1, 0xd4, 0x52, 0xeb, 0xcb, 0x4f, 0x65, 0xca,
+  0x70, 0xc2, 0x6f, 0x28, 0x20, 0xad, 0x7f, 0x63, 0xcc, 0xc8, 0x87, 0xa3, 0x73, 0x65, 0x23, 0x81,
+  0xc4, 0xe7, 0x2c, 0x23, 0x7f, 0x42, 0xc5, 0x27, 0x99, 0xaf, 0xf8, 0x2c, 0xaf, 0xde, 0x08, 0xdd,
+  0x80, 0x09, 0x92, 0x8e, 0xd6, 0xec, 0xcb, 0x69, 0x22, 0xb8, 0xf1, 0xcc, 0x28, 0x5e, 0x9c, 0x55,
+  0xbf, 0x80, 0x5d, 0xe9, 0xf4, 0x8e, 0xcf, 0x8e, 0x7a, 0xaa, 0x3a, 0x24, 0x2a, 0x5b, 0xab, 0x16,
+  0x49, 0xec, 0x01, 0x84, 0x7f, 0xbc, 0xd3, 0x78, 0x36, 0xb7, 0x1c, 0xfa, 0x68, 0xcb, 0x6a, 0x19,
+  0xb5, 0xb5, 0xe6, 0x2f, 0xad, 0x2c, 0x2d, 0x18, 0xd3, 0xf4, 0x32, 0x13, 0xca, 0x1e, 0x97, 0x96,
+  0x54, 0x3d, 0x66, 0x37, 0x5f, 0xda, 0xf3, 0x37, 0x5f, 0x88, 0x36, 0x16, 0x3f, 0xa9, 0x1a, 0xd0,
+  0xe5, 0xbb, 0xb3, 0xae, 0xb8, 0x69, 0x72, 0x41, 0x23, 0x0a, 0xf1, 0xda, 0xd4, 0x73, 0x27, 0x2e,
+  0x6f, 0xed, 0xd6, 0x33, 0x03, 0x07, 0xa1, 0xd0, 0x1a, 0x35, 0x61, 0x5d, 0x08, 0x56, 0x46, 0x91,
+  0xde, 0xad, 0x9c, 0x83, 0x99, 0x72, 0x36, 0x07, 0xc3, 0x29, 0xd7, 0xb1, 0xc8, 0x4f, 0x36, 0x56,
+  0x56, 0x44, 0xd8, 0x67, 0x88, 0x40, 0x4c, 0x99, 0x52, 0x7a, 0x97, 0x6a, 0xfa, 0x87, 0xbb, 0xea,
+  0xa4, 0xea, 0x60, 0xf0, 0x03, 0xad, 0x76, 0x0c, 0xb6, 0x1b, 0x26, 0xd4, 0x00, 0x14, 0x0a, 0xe2,
+  0x9b, 0x44, 0x7e, 0x8b, 0x8c, 0x36, 0x88, 0x51, 0x30, 0xc9, 0xdf, 0x1e, 0xb9, 0x83, 0x80, 0x1c,
+  0x2f, 0x2b, 0x39, 0x69, 0x3d, 0x47, 0xd5, 0x7b, 0xda, 0x1b, 0x6a, 0x65, 0x9c, 0x01, 0x2b, 0xe3,
+  0x87, 0x95, 0x36, 0xf2, 0x00, 0x9a, 0x16, 0x81, 0xa0, 0x28, 0x17, 0xc1, 0xe0, 0xd7, 0xc4, 0x09,
+  0x56, 0x09, 0x15, 0x45, 0x5e, 0x90, 0xc7, 0x8f, 0x33, 0x0e, 0x7c, 0xa1, 0xef, 0xd2, 0x28, 0xb8,
+  0xf2, 0x8b, 0x83, 0x8c, 0xec, 0x76, 0x92, 0xb5, 0x86, 0x83, 0xc3, 0xa4, 0xe9, 0x99, 0xb1, 0xf9,
+  0xd3, 0x4a, 0xf7, 0xa3, 0xf8, 0x8f, 0x1f, 0x20, 0x56, 0x3e, 0xd8, 0x5a, 0x53, 0xd9, 0x16, 0xd5,
+  0xa9, 0x24, 0x02, 0x22, 0x54, 0x78, 0xc8, 0x1f, 0x16, 0x98, 0xf7, 0xd9, 0xe6, 0xd3, 0xf7, 0x47,
+  0xdf, 0x1f, 0xf5, 0x56, 0x59, 0x67, 0x09, 0x66, 0x3d, 0xcb, 0x3c, 0xbe, 0xdf, 0x32, 0x8b, 0xab,
+  0x7e, 0xc0, 0x5f, 0x79, 0xd7, 0x4f, 0xed, 0x4a, 0xe2, 0xaf, 0x2e, 0x73, 0x09, 0x72, 0x8b, 0xbd,
+  0xfe, 0xd6, 0x92, 0x3a, 0x77, 0x1d, 0x7a, 0x25, 0x2c, 0xe2, 0xc2, 0xfd, 0xc4, 0x55, 0x86, 0x50,
+  0xac, 0x3d, 0x5f, 0x3c, 0x7f, 0x88, 0x21, 0xfc, 0xbf, 0x50, 0xfa, 0xce, 0xc9, 0x41, 0xbe, 0xdc,
+  0x25, 0x23, 0x3c, 0x59, 0x21, 0xcb, 0xe2, 0xb8, 0xec, 0x66, 0x90, 0x3c, 0x5b, 0xa6, 0xb7, 0x66,
+  0xbd, 0x4a, 0x72, 0x05, 0xd9, 0x5c, 0x45, 0xb6, 0xa6, 0x26, 0xcb, 0x44, 0x39, 0x95, 0xfb, 0x70,
+  0x8d, 0x7b, 0x6d, 0xcb, 0xcf, 0x68, 0x05, 0x76, 0x0b, 0xde, 0x3e, 0xcc, 0x5f, 0x4d, 0x2b, 0xde,
+  0x5b, 0x2b, 0xf6, 0x14, 0xee, 0xac, 0x99, 0xea, 0xbe, 0x9a, 0x30, 0xad, 0xba, 0xfe, 0x8e, 0xa7,
+  0x51, 0x78, 0xfb, 0x84, 0x45, 0x78, 0x75, 0x23, 0xa3, 0x48, 0x95, 0xa8, 0x0b, 0x6c, 0x40, 0x7b,
+  0x75, 0x61, 0xf4, 0xe9, 0x96, 0xbe, 0xf8, 0x2a, 0xfe, 0x57, 0x03, 0xff, 0x09, 0x91, 0xe4, 0x95,
+  0xed, 0x7a, 0x60, 0x00, 0x00,
+};
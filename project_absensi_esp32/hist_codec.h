@@ -0,0 +1,235 @@
+#pragma once
+/*
+ * hist_codec.h — Arsip riwayat tap jangka panjang, blok per kolom
+ * Satu blok = sampai TAPS tap urut waktu, disimpan kolom demi kolom:
+ *   ref : varint — n > 0 = slot kamus UID n-1 (HistKeys, di flash),
+ *         0 = UID tidak ada di kamus (penuh), ditulis di kolom uid
+ *   ts  : selisih dengan tap sebelumnya (zigzag + varint); tap
+ *         pertama relatif ke HistBlockHdr.ts0
+ *   uid : [len][byte UID] untuk ref 0 saja
+ * Tanpa kompresi blok. Diukur dengan tools/hist_bench.cpp (2000
+ * karyawan, 90 hari, 253211 tap): kolom varint 3.07 byte/tap, kolom
+ * + LZ gaya LZ4 3.04 byte/tap — hemat ±1% (±7 KB dari 750 KB), dengan
+ * ongkos buffer blok mentah + tabel hash 2 KB di RAM dan satu salinan
+ * dekode per blok. Tanpa LZ blok dibaca langsung dari payload. Nama tidak
+ * disimpan — di-resolve saat ekspor, jadi rename ikut berlaku ke
+ * riwayat lama.
+ * File: [HistBlockHdr][payload len byte][HistBlockHdr]...
+ * tsMin/tsMax di header → blok di luar rentang ekspor dilewati
+ * tanpa dibaca payload-nya.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host
+ * (tools/hist_bench.cpp).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "user_store.h"
+
+#define HIST_MAGIC 0x43534241UL  // "ABSC"
+
+struct HistBlockHdr {
+  uint32_t magic;
+  uint16_t taps;
+  uint16_t len;          // panjang payload di file
+  uint32_t ts0;          // ts tap pertama
+  uint32_t tsMin, tsMax; // rentang ts di blok (< EPOCH_MIN = tanpa jam)
+  uint16_t refLen, tsLen;// panjang kolom ref & ts (sisanya kolom uid)
+  uint32_t crc;          // crc32 payload
+};
+
+// Slot /hist/keys.bin (kamus UID, lihat HistKeys)
+struct HistKeyRec {
+  UidKey   key;
+  uint32_t crc;          // crc32 key
+};
+
+// ── varint (7 bit per byte, LSB dulu) ────────────────
+inline uint8_t* varPut(uint8_t* p, uint32_t v) {
+  while (v >= 0x80) { *p++ = (uint8_t)(v | 0x80); v >>= 7; }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+inline bool varGet(const uint8_t*& p, const uint8_t* end, uint32_t& v) {
+  v = 0;
+  for (int sh = 0; sh < 35; sh += 7) {
+    if (p >= end) return false;
+    uint8_t b = *p++;
+    v |= (uint32_t)(b & 0x7F) << sh;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+inline uint32_t zigzag(int32_t d)    { return ((uint32_t)d << 1) ^ (uint32_t)(d >> 31); }
+inline int32_t  unzigzag(uint32_t z) { return (int32_t)(z >> 1) ^ -(int32_t)(z & 1); }
+
+// ── Kamus UID di flash ───────────────────────────────
+// keys.bin = tabel hash open addressing SLOTS × HistKeyRec langsung di
+// file, tanpa salinan di RAM (hanya counter). Slot = id permanen
+// (ref = slot + 1), tidak pernah dihapus: blok lama tetap merujuk.
+// Slot kosong / rusak = CRC tidak cocok (file dibuat berisi 0). Load
+// factor <= 0.5 → rata-rata < 2 baca 16 byte per lookup.
+// F = tipe file dengan seek/read/write/flush seperti fs::File,
+// dibuka baca-tulis dengan ukuran FILE_SIZE.
+template <class F, uint32_t SLOTS>
+class HistKeys {
+  static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS harus pangkat 2");
+
+public:
+  static const size_t FILE_SIZE = (size_t)SLOTS * sizeof(HistKeyRec);
+
+  HistKeys() : _n(0) {}
+
+  F&       file()        { return _f; }
+  uint32_t count() const { return _n; }
+  static uint32_t capacity() { return SLOTS / 2; }
+
+  // Hitung slot terisi (boot)
+  void load() {
+    HistKeyRec r[16];
+    _n = 0;
+    _f.seek(0);
+    for (uint32_t s = 0; s < SLOTS; s += 16) {
+      if (_f.read((uint8_t*)r, sizeof(r)) != sizeof(r)) break;
+      for (const HistKeyRec& x : r) _n += valid(x);
+    }
+  }
+
+  // Slot milik k, ditambahkan kalau belum ada. -1 = penuh / gagal
+  // baca-tulis (pemanggil menulis UID inline, ref 0).
+  int add(const UidKey& k) {
+    HistKeyRec r;
+    uint32_t s = uidKeyHash(k) & MASK;
+    for (uint32_t i = 0; i < SLOTS; i++, s = (s + 1) & MASK) {
+      if (!read(s, r)) return -1;
+      if (!valid(r)) break;
+      if (r.key == k) return (int)s;
+    }
+    if (_n >= capacity()) return -1;
+    r.key = k;
+    r.crc = crc32(&r.key, sizeof(r.key));
+    if (!_f.seek(s * sizeof(r)) || _f.write((const uint8_t*)&r, sizeof(r)) != sizeof(r)) return -1;
+    _n++;
+    return (int)s;
+  }
+
+  // Key di slot; false = kosong / rusak
+  bool key(uint32_t slot, UidKey& k) {
+    HistKeyRec r;
+    if (slot >= SLOTS || !read(slot, r) || !valid(r)) return false;
+    k = r.key;
+    return true;
+  }
+
+  void flush() { _f.flush(); }
+
+private:
+  static const uint32_t MASK = SLOTS - 1;
+
+  static bool valid(const HistKeyRec& r) { return r.crc == crc32(&r.key, sizeof(r.key)); }
+
+  bool read(uint32_t s, HistKeyRec& r) {
+    return _f.seek(s * sizeof(r)) && _f.read((uint8_t*)&r, sizeof(r)) == sizeof(r);
+  }
+
+  F        _f;
+  uint32_t _n;
+};
+
+// ── Encoder satu blok ────────────────────────────────
+// Kolom ditulis langsung ke area masing-masing di _buf, dirapatkan
+// saat pack(). RAW_MAX = payload terbesar (buffer baca ekspor).
+template <uint16_t TAPS>
+class HistEncoder {
+public:
+  static const size_t REF_MAX = (size_t)TAPS * 3;            // ref < 2^21
+  static const size_t TS_MAX  = (size_t)TAPS * 5;
+  static const size_t RAW_MAX = (size_t)TAPS * (3 + 5 + 1 + UID_MAX);
+  static_assert(RAW_MAX < 65536, "blok terlalu besar untuk len 16-bit");
+
+  HistEncoder() { clear(); }
+
+  void clear() {
+    _n = 0;
+    _ref = _buf; _ts = _buf + REF_MAX; _uid = _buf + REF_MAX + TS_MAX;
+  }
+
+  uint16_t taps() const { return _n; }
+  bool     full() const { return _n >= TAPS; }
+
+  // ref = index kamus + 1, atau 0 (k ditulis inline)
+  void add(uint32_t ref, const UidKey& k, uint32_t ts) {
+    if (!_n) _ts0 = _prev = _min = _max = ts;
+    _ref = varPut(_ref, ref);
+    _ts  = varPut(_ts, zigzag((int32_t)(ts - _prev)));
+    if (!ref) {
+      uint8_t len = uidKeyBytes(k, _uid + 1);
+      *_uid = len;
+      _uid += 1 + len;
+    }
+    _prev = ts;
+    if (ts < _min) _min = ts;
+    if (ts > _max) _max = ts;
+    _n++;
+  }
+
+  // Kolom dirapatkan, header diisi, encoder kosong lagi. Return
+  // payload (h.len byte di buffer encoder) — valid sampai add() berikutnya.
+  const uint8_t* pack(HistBlockHdr& h) {
+    size_t refLen = _ref - _buf, tsLen = _ts - (_buf + REF_MAX),
+           uidLen = _uid - (_buf + REF_MAX + TS_MAX);
+    memmove(_buf + refLen, _buf + REF_MAX, tsLen);
+    memmove(_buf + refLen + tsLen, _buf + REF_MAX + TS_MAX, uidLen);
+
+    memset(&h, 0, sizeof(h));
+    h.magic = HIST_MAGIC;
+    h.taps = _n;
+    h.len = (uint16_t)(refLen + tsLen + uidLen);
+    h.ts0 = _ts0; h.tsMin = _min; h.tsMax = _max;
+    h.refLen = (uint16_t)refLen; h.tsLen = (uint16_t)tsLen;
+    h.crc = crc32(_buf, h.len);
+    clear();
+    return _buf;
+  }
+
+private:
+  uint8_t   _buf[RAW_MAX];
+  uint8_t  *_ref, *_ts, *_uid;
+  uint16_t  _n;
+  uint32_t  _ts0, _prev, _min, _max;
+};
+
+// Header & payload satu blok utuh?
+inline bool histCheck(const HistBlockHdr& h, const uint8_t* payload) {
+  return h.magic == HIST_MAGIC && h.refLen + h.tsLen <= h.len && crc32(payload, h.len) == h.crc;
+}
+
+// Baca tap satu blok langsung dari payload (sesudah histCheck)
+class HistReader {
+public:
+  HistReader(const HistBlockHdr& h, const uint8_t* payload)
+    : _ref(payload), _refEnd(payload + h.refLen), _ts(_refEnd), _tsEnd(_ts + h.tsLen),
+      _uid(_tsEnd), _uidEnd(payload + h.len), _left(h.taps), _prev(h.ts0) {}
+
+  // ref seperti HistEncoder::add; k hanya diisi kalau ref 0.
+  // false = habis atau kolom rusak.
+  bool next(uint32_t& ref, UidKey& k, uint32_t& ts) {
+    uint32_t z;
+    if (!_left || !varGet(_ref, _refEnd, ref) || !varGet(_ts, _tsEnd, z)) return false;
+    if (!ref) {
+      if (_uid >= _uidEnd || *_uid > UID_MAX || _uid + 1 + *_uid > _uidEnd) return false;
+      k = uidKeyOf(_uid + 1, *_uid);
+      _uid += 1 + *_uid;
+    }
+    ts = _prev += (uint32_t)unzigzag(z);
+    _left--;
+    return true;
+  }
+
+private:
+  const uint8_t *_ref, *_refEnd, *_ts, *_tsEnd, *_uid, *_uidEnd;
+  uint16_t _left;
+  uint32_t _prev;
+};
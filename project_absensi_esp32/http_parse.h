@@ -0,0 +1,216 @@
+#pragma once
+/*
+ * http_parse.h — Request HTTP/1.x inkremental dalam buffer tetap
+ * Byte dari socket ditulis lewat space()/commit() sedikit demi
+ * sedikit (tanpa blocking); READY = header + body (Content-Length)
+ * lengkap. Request diurai di tempat, tanpa alokasi:
+ *   method, path, versi, header (nama → nilai), argumen query dan
+ *   body application/x-www-form-urlencoded (%XX & '+' di-decode).
+ * Header dan body punya jatah sendiri (User-Agent / Accept panjang
+ * tidak memakan jatah form). Body hanya lewat Content-Length:
+ * Transfer-Encoding chunked → 411, encoding lain → 501.
+ * next() menyiapkan request berikutnya di koneksi yang sama
+ * (keep-alive); byte yang sudah ikut terbaca tetap dipakai.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define HTTP_HEAD_MAX 1536       // request line + header (sampai baris kosong)
+#define HTTP_BODY_MAX  512       // body (form rename / delete)
+#define HTTP_REQ_MAX  (HTTP_HEAD_MAX + HTTP_BODY_MAX)
+#define HTTP_HDR_MAX   16        // header disimpan, sisanya diabaikan
+#define HTTP_ARG_MAX   12
+
+enum HttpMethod : uint8_t { HTTP_ANY, HTTP_GET, HTTP_POST, HTTP_HEAD, HTTP_OTHER };
+
+enum HttpParse : uint8_t {
+  HP_MORE,                       // butuh byte lagi
+  HP_READY,                      // request lengkap
+  HP_BAD,                        // bukan HTTP/1.x yang valid
+  HP_HEAD_BIG,                   // header tidak muat HTTP_HEAD_MAX (431)
+  HP_TOO_BIG,                    // body > HTTP_BODY_MAX (413)
+  HP_NO_LENGTH,                  // body chunked tanpa Content-Length (411)
+  HP_UNSUPPORTED                 // Transfer-Encoding lain (501)
+};
+
+struct HttpPair {
+  const char* name;
+  const char* value;
+};
+
+class HttpRequest {
+public:
+  HttpRequest() { clear(); }
+
+  void clear() { _len = 0; reset(); }
+
+  // Baca socket langsung ke buffer: maks room() byte ke space(), lalu commit()
+  char*     space()        { return _buf + _len; }
+  size_t    room() const   { return _state == HP_MORE ? HTTP_REQ_MAX - _len : 0; }
+  HttpParse commit(size_t n) { _len += n; return parse(); }
+
+  HttpParse state()   const { return _state; }
+  bool      pending() const { return _len > 0; }   // ada byte request yang belum selesai dilayani
+
+  // Selesai dilayani → request berikutnya (pipelining / keep-alive)
+  HttpParse next() {
+    if (_state != HP_READY) { clear(); return _state; }
+    _buf[_total] = _saved;
+    size_t rest = _len - _total;
+    memmove(_buf, _buf + _total, rest);
+    _len = rest;
+    reset();
+    return rest ? parse() : HP_MORE;
+  }
+
+  HttpMethod  method()  const { return _method; }
+  const char* path()    const { return _path; }
+  bool        http11()  const { return _http11; }
+  const char* body()    const { return _body; }
+  size_t      bodyLen() const { return _bodyLen; }
+
+  // HTTP/1.1: keep-alive kecuali "Connection: close"; 1.0 sebaliknya
+  bool keepAlive() const {
+    const char* c = header("Connection");
+    if (_http11) return !(c && !strncasecmp(c, "close", 5));
+    return c && !strncasecmp(c, "keep-alive", 10);
+  }
+
+  const char* header(const char* name) const { return find(_hdr, _nHdr, name, true); }
+  const char* arg(const char* name)    const { return find(_arg, _nArg, name, false); }
+
+private:
+  void reset() {
+    _scan = _headLen = _bodyLen = _total = 0;
+    _state = HP_MORE; _nHdr = _nArg = 0;
+    _path = _body = "";
+  }
+
+  HttpParse parse() {
+    if (_state != HP_MORE) return _state;
+    if (!_headLen) {
+      size_t i = _scan > 3 ? _scan - 3 : 0;
+      for (; i + 3 < _len; i++)
+        if (_buf[i] == '\r' && !memcmp(_buf + i, "\r\n\r\n", 4)) break;
+      if (i + 3 >= _len) {
+        _scan = _len;
+        return _state = _len >= HTTP_HEAD_MAX ? HP_HEAD_BIG : HP_MORE;
+      }
+      _headLen = i + 4;
+      if (_headLen > HTTP_HEAD_MAX) return _state = HP_HEAD_BIG;
+      if (!parseHead()) return _state = HP_BAD;
+      const char* te = header("Transfer-Encoding");
+      if (te && strcasecmp(te, "identity"))
+        return _state = strcasestr(te, "chunked") ? HP_NO_LENGTH : HP_UNSUPPORTED;
+      const char* cl = header("Content-Length");
+      _bodyLen = cl ? strtoul(cl, nullptr, 10) : 0;
+      if (_bodyLen > HTTP_BODY_MAX) return _state = HP_TOO_BIG;
+    }
+    if (_len < _headLen + _bodyLen) return HP_MORE;
+
+    // Body diakhiri '\0' di tempat; byte yang tertimpa (awal request
+    // berikutnya) dikembalikan next()
+    _total = _headLen + _bodyLen;
+    _saved = _buf[_total];
+    _buf[_total] = '\0';
+    _body = _buf + _headLen;
+    const char* ct = header("Content-Type");
+    if (_bodyLen && ct && !strncasecmp(ct, "application/x-www-form-urlencoded", 33))
+      parseArgs(_buf + _headLen);
+    return _state = HP_READY;
+  }
+
+  // Potong baris di '\r\n' (sudah pasti ada sebelum _headLen)
+  char* line(char*& p) {
+    char* s = p;
+    char* e = (char*)memchr(p, '\r', _buf + _headLen - p);
+    *e = '\0';
+    p = e + 2;
+    return s;
+  }
+
+  bool parseHead() {
+    char* p = _buf;
+    char* rl = line(p);
+    char* sp1 = strchr(rl, ' ');
+    char* sp2 = sp1 ? strchr(sp1 + 1, ' ') : nullptr;
+    if (!sp1 || !sp2 || sp1[1] != '/') return false;
+    *sp1 = *sp2 = '\0';
+    if      (!strcmp(rl, "GET"))  _method = HTTP_GET;
+    else if (!strcmp(rl, "POST")) _method = HTTP_POST;
+    else if (!strcmp(rl, "HEAD")) _method = HTTP_HEAD;
+    else                          _method = HTTP_OTHER;
+    if      (!strcmp(sp2 + 1, "HTTP/1.1")) _http11 = true;
+    else if (!strcmp(sp2 + 1, "HTTP/1.0")) _http11 = false;
+    else return false;
+
+    _path = sp1 + 1;
+    char* q = strchr(sp1 + 1, '?');
+    if (q) { *q = '\0'; parseArgs(q + 1); }
+    decode(sp1 + 1, false);
+
+    while (p < _buf + _headLen - 2) {
+      char* h = line(p);
+      char* c = strchr(h, ':');
+      if (!c || _nHdr >= HTTP_HDR_MAX) continue;
+      *c++ = '\0';
+      while (*c == ' ' || *c == '\t') c++;
+      _hdr[_nHdr].name = h; _hdr[_nHdr].value = c; _nHdr++;
+    }
+    return true;
+  }
+
+  void parseArgs(char* s) {
+    while (*s && _nArg < HTTP_ARG_MAX) {
+      char* amp = strchr(s, '&');
+      if (amp) *amp = '\0';
+      char* eq = strchr(s, '=');
+      if (eq) *eq = '\0';
+      decode(s, true);
+      if (eq) decode(eq + 1, true);
+      if (*s) { _arg[_nArg].name = s; _arg[_nArg].value = eq ? eq + 1 : ""; _nArg++; }
+      if (!amp) break;
+      s = amp + 1;
+    }
+  }
+
+  static int hexv(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c |= 0x20;
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+  }
+
+  static void decode(char* s, bool plus) {
+    char* o = s;
+    for (; *s; s++) {
+      int hi, lo;
+      if (plus && *s == '+') *o++ = ' ';
+      else if (*s == '%' && (hi = hexv(s[1])) >= 0 && (lo = hexv(s[2])) >= 0) { *o++ = (char)(hi << 4 | lo); s += 2; }
+      else *o++ = *s;
+    }
+    *o = '\0';
+  }
+
+  static const char* find(const HttpPair* p, uint8_t n, const char* name, bool icase) {
+    for (uint8_t i = 0; i < n; i++)
+      if (icase ? !strcasecmp(p[i].name, name) : !strcmp(p[i].name, name)) return p[i].value;
+    return nullptr;
+  }
+
+  char        _buf[HTTP_REQ_MAX + 1];
+  size_t      _len, _scan, _headLen, _bodyLen, _total;
+  char        _saved;
+  HttpParse   _state;
+  HttpMethod  _method;
+  bool        _http11;
+  const char* _path;
+  const char* _body;
+  HttpPair    _hdr[HTTP_HDR_MAX];
+  HttpPair    _arg[HTTP_ARG_MAX];
+  uint8_t     _nHdr, _nArg;
+};
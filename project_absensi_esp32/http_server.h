@@ -0,0 +1,449 @@
+#pragma once
+/*
+ * http_server.h — Server HTTP event-driven, banyak koneksi sekaligus
+ * Pengganti WebServer bawaan (satu client per giliran, request dibaca
+ * blocking sampai timeout):
+ *   - HTTP_CONNS koneksi paralel; tiap handleClient() membaca byte
+ *     yang sudah tersedia saja (http_parse.h), jadi client lambat /
+ *     request setengah jadi tidak menahan client lain
+ *   - keep-alive HTTP/1.1 (Content-Length atau chunked); slot penuh →
+ *     koneksi keep-alive yang paling lama diam dilepas dulu
+ *   - jalur cepat captive portal: Host selain domain / IP sendiri
+ *     langsung dijawab 302 tanpa lewat tabel route
+ *   - respons tidak pernah menunggu socket: handler menulis ke buffer
+ *     kirim koneksi (HTTP_OUT), body statis send_P dikirim langsung
+ *     dari sumbernya, dan body panjang dibuat per langkah oleh
+ *     producer (stream(): fungsi + cursor per koneksi). Tiap
+ *     handleClient() mengirim maks satu potongan per koneksi, hanya
+ *     kalau socket bisa ditulis — client lambat tidak menahan
+ *     koneksi lain, DNS maupun WebSocket di task yang sama
+ *   - HEAD: header saja, tanpa body / framing chunk
+ * API (on, arg, header, send, sendHeader, sendContent, ...) = subset
+ * WebServer yang dipakai sketch. Handler & producer jalan satu per
+ * satu di task yang memanggil handleClient(); arg() / header() tetap
+ * berlaku di producer (request disimpan sampai respons selesai).
+ * Butuh WiFiServer / WiFiClient (Arduino ESP32, fd() untuk select).
+ */
+
+#include <WiFi.h>
+#include <sys/select.h>
+#include "http_parse.h"
+
+#ifndef CONTENT_LENGTH_UNKNOWN
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#endif
+
+#define HTTP_CONNS      6         // koneksi paralel (browser buka s.d. 6 per host)
+#define HTTP_ROUTES    32
+#define HTTP_IDLE_MS 5000UL       // keep-alive diam / request belum lengkap / client berhenti membaca
+#define HTTP_PIECE   1436         // maks byte per write (≈ 1 MSS)
+#define HTTP_OUT     1536         // buffer kirim per koneksi: header, body kecil, satu langkah producer
+#define HTTP_HDR_OUT  320         // header tambahan (sendHeader) per respons
+#define HTTP_CURSOR     4         // word cursor producer per koneksi
+
+class HttpServer {
+public:
+  typedef void (*Handler)();
+  // Satu langkah body: tulis lewat sendContent() maks ±HTTP_OUT byte,
+  // simpan posisi di cur (nol di langkah pertama). false = selesai.
+  typedef bool (*Producer)(uint32_t* cur);
+
+  explicit HttpServer(uint16_t port)
+    : _srv(port), _nRoutes(0), _notFound(nullptr), _cur(nullptr), _hdrLen(0),
+      _length(0), _sent(false), _requests(0), _captive(0), _busy(0), _evicted(0) {
+    _host[0] = _ip[0] = '\0';
+  }
+
+  void begin() { _srv.begin(); _srv.setNoDelay(true); }
+
+  void on(const char* path, HttpMethod m, Handler h) {
+    if (_nRoutes < HTTP_ROUTES) _routes[_nRoutes++] = { path, m, h };
+  }
+  void onNotFound(Handler h) { _notFound = h; }
+
+  // Host selain host / ip → 302 ke http://host/ (jalur cepat captive)
+  void captive(const char* host, const char* ip) {
+    strncpy(_host, host, sizeof(_host) - 1); _host[sizeof(_host) - 1] = '\0';
+    strncpy(_ip,   ip,   sizeof(_ip)   - 1); _ip[sizeof(_ip) - 1]     = '\0';
+  }
+
+  void handleClient() { poll(); }
+
+  // ── Akses request (dalam handler / producer) ──
+  HttpMethod method() const { return _cur ? _cur->req.method() : HTTP_GET; }
+  String     uri()    const { return _cur ? String(_cur->req.path()) : String(); }
+  bool       hasArg(const char* n) const { return _cur && _cur->req.arg(n); }
+  String     arg(const char* n) const    { return str(_cur ? _cur->req.arg(n) : nullptr); }
+  String     header(const char* n) const { return str(_cur ? _cur->req.header(n) : nullptr); }
+  WiFiClient& client() { return _cur->client; }
+
+  // ── Respons ──
+  void sendHeader(const String& name, const String& value, bool first = false) {
+    (void)first;                  // urutan header tidak berpengaruh
+    int n = snprintf(_hdr + _hdrLen, sizeof(_hdr) - _hdrLen, "%s: %s\r\n", name.c_str(), value.c_str());
+    if (n > 0 && _hdrLen + n < sizeof(_hdr)) _hdrLen += n;
+    else _hdr[_hdrLen] = '\0';
+  }
+
+  void setContentLength(size_t n) { _length = n; }
+
+  void send(int code) { send(code, nullptr, "", 0); }
+  void send(int code, const char* type, const char* body) { send(code, type, body, strlen(body)); }
+  void send(int code, const char* type, const String& body) { send(code, type, body.c_str(), body.length()); }
+
+  // Body di flash / statis: tidak disalin, dikirim per potongan dari sumbernya
+  void send_P(int code, const char* type, const char* body) { send_P(code, type, body, strlen(body)); }
+  void send_P(int code, const char* type, const char* body, size_t len) {
+    if (!_cur || _sent) return;
+    _sent = true;
+    head(code, type, len);
+    if (!_cur->head) { _cur->tail = body; _cur->tailLen = len; }
+  }
+
+  // setContentLength(CONTENT_LENGTH_UNKNOWN) sebelumnya → kepala chunked,
+  // body berikutnya lewat sendContent(), diakhiri sendContent("")
+  void send(int code, const char* type, const char* body, size_t len) {
+    if (!_cur || _sent) return;
+    _sent = true;
+    if (_length == CONTENT_LENGTH_UNKNOWN) {
+      head(code, type, CONTENT_LENGTH_UNKNOWN);
+      if (len) sendContent(body, len);
+      return;
+    }
+    head(code, type, len);
+    if (!_cur->head) put(*_cur, body, len);
+  }
+
+  // Respons chunked yang body-nya dibuat step() per langkah, tiap kali
+  // buffer kirim koneksi sudah habis terkirim. done() dipanggil sekali
+  // saat respons berakhir (selesai, client putus, atau HEAD).
+  void stream(int code, const char* type, Producer step, Handler done = nullptr) {
+    if (!_cur || _sent) return;
+    _sent = true;
+    head(code, type, CONTENT_LENGTH_UNKNOWN);
+    Conn& c = *_cur;
+    c.step = c.head ? nullptr : step;
+    c.done = done;
+    memset(c.cur, 0, sizeof(c.cur));
+  }
+
+  void sendContent(const String& s) { sendContent(s.c_str(), s.length()); }
+  void sendContent(const char* s)   { sendContent(s, strlen(s)); }
+  void sendContent(const char* d, size_t n) {
+    if (!_cur || _cur->head) return;
+    Conn& c = *_cur;
+    if (!c.chunked) { put(c, d, n); return; }      // HTTP/1.0: body sampai koneksi ditutup
+    char sz[12];
+    if (!n) { put(c, "0\r\n\r\n", 5); c.chunked = false; return; }
+    put(c, sz, snprintf(sz, sizeof(sz), "%x\r\n", (unsigned)n));
+    put(c, d, n);
+    put(c, "\r\n", 2);
+  }
+
+  // ── Statistik (/api/metrics) ──
+  uint32_t requests() const { return _requests; }
+  uint32_t captiveHits() const { return _captive; }
+  uint32_t busyRejects() const { return _busy; }
+  uint32_t evictions() const { return _evicted; }
+  uint8_t  connections() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < HTTP_CONNS; i++) n += _conn[i].used;
+    return n;
+  }
+  uint8_t  streams() const {      // respons producer yang sedang berjalan
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < HTTP_CONNS; i++) n += _conn[i].step != nullptr;
+    return n;
+  }
+
+private:
+  struct Conn {
+    WiFiClient    client;
+    HttpRequest   req;
+    unsigned long since = 0;       // byte terakhir diterima / terkirim
+    bool          used = false;
+    bool          kept = false;    // sudah dilayani, menunggu request keep-alive
+    // Respons yang sedang dikirim
+    bool          busy = false;
+    bool          head = false;    // request HEAD: body dibuang
+    bool          chunked = false, close = false;
+    bool          gone = false;    // write gagal, sisa respons dibuang
+    char          out[HTTP_OUT];
+    uint16_t      outLen = 0, outOff = 0;
+    const char*   tail = nullptr;  // body send_P sesudah out
+    size_t        tailLen = 0;
+    Producer      step = nullptr;
+    Handler       done = nullptr;
+    uint32_t      cur[HTTP_CURSOR];
+  };
+
+  struct Route {
+    const char* path;
+    HttpMethod  method;
+    Handler     h;
+  };
+
+  static String str(const char* s) { return s ? String(s) : String(); }
+
+  static const char* reason(int code) {
+    switch (code) {
+      case 200: return "OK";
+      case 202: return "Accepted";
+      case 204: return "No Content";
+      case 302: return "Found";
+      case 304: return "Not Modified";
+      case 400: return "Bad Request";
+      case 404: return "Not Found";
+      case 409: return "Conflict";
+      case 411: return "Length Required";
+      case 413: return "Payload Too Large";
+      case 431: return "Request Header Fields Too Large";
+      case 501: return "Not Implemented";
+      case 503: return "Service Unavailable";
+      default:  return code < 400 ? "OK" : "Error";
+    }
+  }
+
+  void poll() {
+    accept();
+    for (uint8_t i = 0; i < HTTP_CONNS; i++) {
+      Conn& c = _conn[i];
+      if (!c.used) continue;
+      if (c.busy) { pump(c); continue; }
+      unsigned long now = millis();        // serve() sebelumnya bisa lama
+      size_t room = c.req.room();
+      int avail = room ? c.client.available() : 0;
+      if (avail > 0) {
+        int n = c.client.read((uint8_t*)c.req.space(), (size_t)avail < room ? avail : room);
+        if (n > 0) { c.req.commit(n); c.since = now; }
+      }
+      switch (c.req.state()) {
+        case HP_READY:
+          if (isCaptive(c.req)) captiveReply(c);
+          else                  serve(c);
+          break;
+        case HP_BAD:         reject(c, 400); break;
+        case HP_HEAD_BIG:    reject(c, 431); break;
+        case HP_TOO_BIG:     reject(c, 413); break;
+        case HP_NO_LENGTH:   reject(c, 411); break;
+        case HP_UNSUPPORTED: reject(c, 501); break;
+        default:
+          if (!c.client.connected() || now - c.since > HTTP_IDLE_MS) drop(c);
+          break;
+      }
+    }
+  }
+
+  void accept() {
+    for (;;) {
+      WiFiClient cl = _srv.available();
+      if (!cl) return;
+      Conn* c = slot();
+      if (!c) {
+        static const char BUSY[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        cl.write((const uint8_t*)BUSY, sizeof(BUSY) - 1);
+        cl.stop();
+        _busy++;
+        continue;
+      }
+      cl.setNoDelay(true);
+      c->client = cl; c->req.clear(); c->since = millis(); c->used = true; c->kept = false;
+    }
+  }
+
+  // Slot kosong, atau keep-alive yang paling lama diam (tanpa request tertunda)
+  Conn* slot() {
+    Conn* idle = nullptr;
+    for (uint8_t i = 0; i < HTTP_CONNS; i++) {
+      Conn& c = _conn[i];
+      if (!c.used) return &c;
+      if (c.kept && !c.busy && !c.req.pending() && (!idle || c.since < idle->since)) idle = &c;
+    }
+    if (idle) { drop(*idle); _evicted++; }
+    return idle;
+  }
+
+  // Respons berakhir (selesai / dibatalkan): done() producer, buffer kosong
+  void release(Conn& c) {
+    if (!c.busy) return;
+    c.busy = false;
+    c.step = nullptr;
+    c.tail = nullptr; c.tailLen = 0;
+    c.outLen = c.outOff = 0;
+    if (c.done) {
+      Handler d = c.done;
+      c.done = nullptr;
+      _cur = &c;
+      d();
+      _cur = nullptr;
+    }
+  }
+
+  void drop(Conn& c) {
+    release(c);
+    c.client.stop();
+    c.req.clear();
+    c.used = false;
+  }
+
+  // Koneksi tetap hidup untuk request berikutnya, atau ditutup
+  void finish(Conn& c, bool keep) {
+    release(c);
+    if (!keep || !c.client.connected()) { drop(c); return; }
+    c.since = millis();
+    c.kept = true;
+    c.req.next();                 // request pipelined dilayani putaran berikutnya
+  }
+
+  // Host "haris.com[:80]" / "192.168.4.1" = milik sendiri; tanpa Host → route biasa
+  bool isCaptive(const HttpRequest& r) const {
+    const char* h = r.header("Host");
+    if (!h || !_host[0]) return false;
+    size_t n = strcspn(h, ":");
+    return !(n == strlen(_host) && !strncasecmp(h, _host, n)) &&
+           !(n == strlen(_ip)   && !strncmp(h, _ip, n));
+  }
+
+  // Jawaban pendek ke koneksi yang belum mengirim apa pun: muat di
+  // buffer kirim socket, tidak menunggu
+  void captiveReply(Conn& c) {
+    bool keep = c.req.keepAlive();
+    char b[160];
+    int n = snprintf(b, sizeof(b),
+                     "HTTP/1.1 302 Found\r\nLocation: http://%s/\r\nContent-Length: 0\r\nConnection: %s\r\n\r\n",
+                     _host, keep ? "keep-alive" : "close");
+    c.client.write((const uint8_t*)b, n);
+    _captive++;
+    finish(c, keep);
+  }
+
+  void reject(Conn& c, int code) {
+    char b[112];
+    int n = snprintf(b, sizeof(b), "HTTP/1.1 %d %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+                     code, reason(code));
+    c.client.write((const uint8_t*)b, n);
+    drop(c);
+  }
+
+  Handler route(const char* path, HttpMethod m) const {
+    if (m == HTTP_HEAD) m = HTTP_GET;
+    for (uint8_t i = 0; i < _nRoutes; i++) {
+      const Route& r = _routes[i];
+      if ((r.method == HTTP_ANY || r.method == m) && !strcmp(r.path, path)) return r.h;
+    }
+    return nullptr;
+  }
+
+  // Handler mengisi buffer kirim; pengiriman lewat pump()
+  void serve(Conn& c) {
+    _cur = &c;
+    _hdrLen = 0; _hdr[0] = '\0';
+    _length = 0; _sent = false;
+    c.busy = true;
+    c.head = c.req.method() == HTTP_HEAD;
+    c.chunked = c.gone = false;
+    c.close = !c.req.keepAlive();
+    c.outLen = c.outOff = 0;
+    c.tail = nullptr; c.tailLen = 0;
+    c.step = nullptr; c.done = nullptr;
+    Handler h = route(c.req.path(), c.req.method());
+    if (h)              h();
+    else if (_notFound) _notFound();
+    if (!_sent) send(404);
+    if (c.chunked && !c.step) c.close = true;  // handler lupa chunk penutup → batas body hanya EOF
+    _requests++;
+    _cur = nullptr;
+    c.since = millis();
+    pump(c);
+  }
+
+  // Satu langkah respons: buffer kosong → langkah producer berikutnya;
+  // lalu maks HTTP_PIECE byte kalau socket bisa ditulis tanpa menunggu
+  void pump(Conn& c) {
+    unsigned long now = millis();
+    if (c.outOff == c.outLen && !c.tailLen && c.step && !c.gone) {
+      c.outOff = c.outLen = 0;
+      _cur = &c;
+      if (!c.step(c.cur)) { c.step = nullptr; sendContent(""); }   // chunk penutup
+      _cur = nullptr;
+    }
+    if (c.gone) { drop(c); return; }
+    bool buffered = c.outOff < c.outLen;
+    if (buffered || c.tailLen) {
+      if (!writable(c)) {
+        if (!c.client.connected() || now - c.since > HTTP_IDLE_MS) drop(c);
+        return;
+      }
+      const char* d = buffered ? c.out + c.outOff : c.tail;
+      size_t n = buffered ? c.outLen - c.outOff : c.tailLen;
+      if (n > HTTP_PIECE) n = HTTP_PIECE;
+      if (c.client.write((const uint8_t*)d, n) != n) { drop(c); return; }   // client hilang
+      if (buffered) c.outOff += n; else { c.tail += n; c.tailLen -= n; }
+      c.since = now;
+      return;
+    }
+    if (!c.step) finish(c, !c.close);
+  }
+
+  // select() tanpa timeout: lwIP melaporkan writable kalau buffer kirim
+  // TCP masih lega (≥ TCP_SNDLOWAT), cukup untuk satu HTTP_PIECE
+  static bool writable(Conn& c) {
+    int fd = c.client.fd();
+    if (fd < 0) return false;
+    fd_set w;
+    FD_ZERO(&w);
+    FD_SET(fd, &w);
+    timeval tv = { 0, 0 };
+    return select(fd + 1, nullptr, &w, nullptr, &tv) > 0;
+  }
+
+  void head(int code, const char* type, size_t len) {
+    Conn& c = *_cur;
+    char b[192 + HTTP_HDR_OUT];
+    int n = snprintf(b, sizeof(b), "HTTP/1.1 %d %s\r\n", code, reason(code));
+    if (type && *type) n += snprintf(b + n, sizeof(b) - n, "Content-Type: %s\r\n", type);
+    if (len == CONTENT_LENGTH_UNKNOWN) {
+      if (c.req.http11()) {
+        n += snprintf(b + n, sizeof(b) - n, "Transfer-Encoding: chunked\r\n");
+        c.chunked = !c.head;      // HEAD: header sama, tanpa body / framing
+      } else if (!c.head) {
+        c.close = true;
+      }
+    } else if (code != 204 && code != 304) {
+      n += snprintf(b + n, sizeof(b) - n, "Content-Length: %u\r\n", (unsigned)len);
+    }
+    n += snprintf(b + n, sizeof(b) - n, "%sConnection: %s\r\n\r\n", _hdr, c.close ? "close" : "keep-alive");
+    put(c, b, n < (int)sizeof(b) ? n : (int)sizeof(b) - 1);
+  }
+
+  // Ke buffer kirim. Langkah yang melebihi HTTP_OUT (body send()
+  // besar) dikirim blocking seperti WebServer — jalur cadangan saja.
+  void put(Conn& c, const char* d, size_t n) {
+    while (n && !c.gone) {
+      if (c.outLen == HTTP_OUT) {
+        size_t k = c.outLen - c.outOff;
+        if (c.client.write((const uint8_t*)c.out + c.outOff, k) != k) c.gone = true;
+        c.outLen = c.outOff = 0;
+        continue;
+      }
+      size_t k = HTTP_OUT - c.outLen;
+      if (k > n) k = n;
+      memcpy(c.out + c.outLen, d, k);
+      c.outLen += k; d += k; n -= k;
+    }
+  }
+
+  WiFiServer  _srv;
+  Conn        _conn[HTTP_CONNS];
+  Route       _routes[HTTP_ROUTES];
+  uint8_t     _nRoutes;
+  Handler     _notFound;
+  Conn*       _cur;               // koneksi yang sedang diisi handler / producer
+  char        _host[40];
+  char        _ip[16];
+  char        _hdr[HTTP_HDR_OUT];
+  size_t      _hdrLen;
+  size_t      _length;
+  bool        _sent;
+  uint32_t    _requests, _captive, _busy, _evicted;
+};
@@ -0,0 +1,88 @@
+#pragma once
+/*
+ * json_stream.h — Penulis JSON/CSV ke buffer tetap
+ * Pengganti String += untuk output besar (log, daftar user):
+ *   - dengan sink  → buffer di-flush ke sink tiap penuh (HTTP chunked),
+ *                    pemakaian memori konstan berapapun ukuran output
+ *   - tanpa sink   → buffer biasa; kalau tidak muat, overflowed() = true
+ * Tidak bergantung Arduino — bisa di-compile di host.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+class JsonBuf {
+public:
+  typedef void (*Sink)(const char* data, size_t len);
+
+  JsonBuf(char* buf, size_t cap, Sink sink = nullptr)
+    : _buf(buf), _cap(cap), _len(0), _sink(sink), _over(false) {}
+
+  JsonBuf& raw(const char* s, size_t n) {
+    while (n) {
+      size_t k = _cap - _len;
+      if (k == 0) {
+        if (!_sink) { _over = true; return *this; }
+        flush();
+        k = _cap;
+      }
+      if (k > n) k = n;
+      memcpy(_buf + _len, s, k);
+      _len += k; s += k; n -= k;
+    }
+    return *this;
+  }
+  JsonBuf& raw(const char* s) { return raw(s, strlen(s)); }
+  JsonBuf& ch(char c)         { return raw(&c, 1); }
+
+  // Isi string JSON tanpa tanda kutip — escape " \ dan karakter kontrol
+  JsonBuf& esc(const char* s) {
+    const char* run = s;
+    for (; *s; s++) {
+      char c = *s;
+      if (c != '"' && c != '\\' && (unsigned char)c >= 0x20) continue;
+      raw(run, s - run);
+      if (c == '"' || c == '\\') { ch('\\'); ch(c); }
+      else                         ch(' ');
+      run = s + 1;
+    }
+    return raw(run, s - run);
+  }
+  JsonBuf& str(const char* s) { ch('"'); esc(s); return ch('"'); }
+
+  // Field CSV (RFC 4180): selalu dikutip, " di dalamnya digandakan.
+  // Koma, CR/LF di nama tetap satu field.
+  JsonBuf& csv(const char* s) {
+    ch('"');
+    for (const char* q; (q = strchr(s, '"')); s = q + 1) raw(s, q + 1 - s).ch('"');
+    raw(s);
+    return ch('"');
+  }
+
+  JsonBuf& unum(unsigned long v) {
+    char t[12]; int i = sizeof(t);
+    do { t[--i] = '0' + v % 10; v /= 10; } while (v);
+    return raw(t + i, sizeof(t) - i);
+  }
+  JsonBuf& num(long v) {
+    if (v < 0) { ch('-'); return unum(0UL - (unsigned long)v); }
+    return unum((unsigned long)v);
+  }
+
+  void flush() {
+    if (_sink && _len) _sink(_buf, _len);
+    _len = 0;
+  }
+  void clear() { _len = 0; _over = false; }
+
+  const char* data()       const { return _buf; }
+  size_t      length()     const { return _len; }
+  size_t      room()       const { return _cap - _len; }
+  bool        overflowed() const { return _over; }
+
+private:
+  char*  _buf;
+  size_t _cap, _len;
+  Sink   _sink;
+  bool   _over;
+};
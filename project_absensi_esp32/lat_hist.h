@@ -0,0 +1,47 @@
+#pragma once
+/*
+ * lat_hist.h — Histogram latensi log2 (µs), O(1) per sampel
+ *   bucket i (i < N-1) : sampel < bound(i) = 2^(i+SHIFT) µs
+ *   bucket N-1         : sisanya (overflow)
+ * Tanpa float, tanpa alokasi; cukup kecil untuk dipasang per tahap.
+ * Tidak bergantung Arduino — bisa di-compile di host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+template <uint8_t N, uint8_t SHIFT>
+struct LatHist {
+  static_assert(N >= 2 && N + SHIFT <= 32, "bucket melebihi 32 bit");
+
+  uint32_t n[N];
+  uint32_t count, max;
+  uint64_t sum;
+
+  LatHist() { clear(); }
+  void clear() { memset(this, 0, sizeof(*this)); }
+
+  void add(uint32_t us) {
+    uint8_t i = 0;
+    if (us >> SHIFT) {
+      i = 32 - __builtin_clz(us >> SHIFT);       // jumlah bit di atas SHIFT
+      if (i > N - 1) i = N - 1;
+    }
+    n[i]++; count++; sum += us;
+    if (us > max) max = us;
+  }
+
+  static uint32_t bound(uint8_t i) { return 1UL << (i + SHIFT); }
+
+  // Batas atas bucket yang memuat sampel ke-permil (mis. 990 = p99);
+  // bucket overflow → max. Resolusi log2, cukup untuk ekor latensi.
+  uint32_t quantile(uint16_t permil) const {
+    if (!count) return 0;
+    uint32_t want = (uint32_t)((uint64_t)count * permil / 1000), seen = 0;
+    for (uint8_t i = 0; i < N - 1; i++) {
+      seen += n[i];
+      if (seen > want) return bound(i) < max ? bound(i) : max;
+    }
+    return max;
+  }
+};
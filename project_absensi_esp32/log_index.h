@@ -0,0 +1,120 @@
+#pragma once
+/*
+ * log_index.h — Indeks jarang (sparse) jurnal absensi
+ * Jurnal dibagi blok LOG_BLOCK record; tiap blok diringkas:
+ *   minTs..maxTs  → rentang epoch record tap di blok
+ *   untimed       → jumlah record yang jamnya belum diketahui
+ *   bloom 128 bit → UID yang (mungkin) ada di blok (2 bit per UID)
+ * Query per rentang waktu / per orang cukup membaca blok yang lolos
+ * ringkasan, bukan seluruh jurnal. BootTable menyimpan offset jam
+ * per boot untuk record yang tercatat sebelum jam sinkron.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include "uid_index.h"
+
+#define LOG_BLOCK 64             // record per blok indeks (1 KB jurnal)
+
+struct LogBlock {
+  uint32_t minTs, maxTs;         // minTs > maxTs = belum ada tap ber-epoch
+  uint32_t untimed;
+  uint32_t bloom[4];
+};
+
+inline void lbReset(LogBlock& b) {
+  b.minTs = 0xFFFFFFFFUL; b.maxTs = 0; b.untimed = 0;
+  b.bloom[0] = b.bloom[1] = b.bloom[2] = b.bloom[3] = 0;
+}
+
+// Dua posisi bit dari satu hash key
+inline void lbAdd(LogBlock& b, const UidKey& k, uint32_t ts, bool timed) {
+  uint32_t h = uidKeyHash(k);
+  b.bloom[h >> 30] |= 1UL << ((h >> 25) & 31);
+  b.bloom[(h >> 23) & 3] |= 1UL << ((h >> 18) & 31);
+  if (!timed)         b.untimed++;
+  else {
+    if (ts < b.minTs) b.minTs = ts;
+    if (ts > b.maxTs) b.maxTs = ts;
+  }
+}
+
+inline bool lbMayHave(const LogBlock& b, const UidKey& k) {
+  uint32_t h = uidKeyHash(k);
+  return (b.bloom[h >> 30] >> ((h >> 25) & 31) & 1) &&
+         (b.bloom[(h >> 23) & 3] >> ((h >> 18) & 31) & 1);
+}
+
+// Record tanpa jam mungkin terselesaikan saat query (BootTable) → ikut dibaca
+inline bool lbMayOverlap(const LogBlock& b, uint32_t from, uint32_t to) {
+  return b.untimed || (b.minTs <= to && b.maxTs >= from);
+}
+
+// ── Offset jam per boot ───────────────────────────────
+// Slot = boot % N; boot lama yang bertabrakan tertimpa (record-nya
+// jadi tak terselesaikan, tetap tampil sebagai detik sejak boot).
+struct BootInfo {
+  uint16_t boot;
+  uint8_t  fmt;                  // JREC_FMT boot itu
+  uint8_t  flags;                // BI_USED | BI_OFFSET
+  uint32_t offset;               // epoch - detik sejak boot
+};
+
+#define BI_USED   1
+#define BI_OFFSET 2
+
+template <uint8_t N>
+class BootTable {
+public:
+  BootTable() { clear(); }
+
+  void clear() { for (uint8_t i = 0; i < N; i++) _e[i].flags = 0; }
+
+  void boot(uint16_t b, uint8_t fmt) {
+    BootInfo& e = slot(b);
+    e.boot = b; e.fmt = fmt; e.flags = BI_USED; e.offset = 0;
+  }
+
+  // Hanya offset pertama per boot — record sebelum sinkron diukur terhadapnya
+  void timeSet(uint16_t b, uint32_t offset) {
+    BootInfo& e = slot(b);
+    if ((e.flags & BI_USED) && e.boot == b && (e.flags & BI_OFFSET)) return;
+    if (!(e.flags & BI_USED) || e.boot != b) { e.boot = b; e.fmt = 1; }
+    e.flags = BI_USED | BI_OFFSET; e.offset = offset;
+  }
+
+  // ts record yang < EPOCH_MIN. true = epoch diketahui (out = epoch),
+  // false = out tetap detik sejak boot (format lama: millis → detik).
+  bool resolve(uint16_t b, uint32_t ts, uint32_t& out) const {
+    const BootInfo& e = _e[b % N];
+    bool known = (e.flags & BI_USED) && e.boot == b;
+    if (known && e.fmt == 0) { out = ts / 1000; return false; }
+    if (known && (e.flags & BI_OFFSET)) { out = ts + e.offset; return true; }
+    out = ts;
+    return false;
+  }
+
+  // Snapshot (mis. dari file indeks) — entri yang lebih baru menimpa
+  void merge(const BootInfo* src) {
+    for (uint8_t i = 0; i < N; i++) if (src[i].flags & BI_USED) _e[i] = src[i];
+  }
+
+  // Boot terbaru yang tercatat (urutan serial, tahan wrap 16-bit);
+  // false = tabel kosong
+  bool latest(uint16_t& out) const {
+    bool any = false;
+    for (uint8_t i = 0; i < N; i++) {
+      if (!(_e[i].flags & BI_USED)) continue;
+      if (!any || (int16_t)(_e[i].boot - out) > 0) out = _e[i].boot;
+      any = true;
+    }
+    return any;
+  }
+
+  const BootInfo* data() const { return _e; }
+  static size_t   bytes()      { return sizeof(BootInfo) * N; }
+
+private:
+  BootInfo& slot(uint16_t b) { return _e[b % N]; }
+  BootInfo  _e[N];
+};
@@ -0,0 +1,68 @@
+#pragma once
+/*
+ * log_ring.h — Ring log absensi terbaru di RAM (untuk dashboard)
+ * Buffer dari pemanggil (ukurannya ditentukan heap saat boot).
+ * Penuh → entri tertua ditimpa (head maju), tanpa geser array.
+ * Salinan persisten ada di jurnal, ring ini hanya tampilan.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "user_store.h"
+
+struct LogEntry {
+  char     name[NAME_SIZE];
+  char     uid[UID_STR];
+  uint32_t ts;           // epoch detik; < epochMin = detik sejak boot
+};
+
+class LogRing {
+public:
+  LogRing() : _e(nullptr), _cap(0), _head(0), _count(0), _seq(0) {}
+
+  void init(LogEntry* buf, int cap) { _e = buf; _cap = buf ? cap : 0; _head = _count = 0; _seq = 0; }
+
+  int capacity() const { return _cap; }
+  int count()    const { return _count; }
+
+  // Nomor urut entri sejak init (tidak bergeser saat ring penuh):
+  // entri ke-i = seq() - count() + i. Dipakai kursor snapshot WS.
+  uint32_t seq()  const { return _seq; }
+  uint32_t oldestSeq() const { return _seq - (uint32_t)_count; }
+
+  // Entri ke-i urut kronologis (0 = tertua)
+  LogEntry& at(int i) {
+    int j = _head + i;
+    return _e[j >= _cap ? j - _cap : j];
+  }
+
+  void add(const char* name, const char* uid, uint32_t ts) {
+    if (!_cap) return;
+    if (_count == _cap) {
+      if (++_head == _cap) _head = 0;
+      _count--;
+    }
+    LogEntry& e = at(_count);
+    strncpy(e.name, name, NAME_SIZE-1);
+    e.name[NAME_SIZE-1] = '\0';
+    strncpy(e.uid, uid, UID_STR-1);
+    e.uid[UID_STR-1] = '\0';
+    e.ts = ts;
+    _count++;
+    _seq++;
+  }
+
+  // Jam pertama kali sinkron: entri sebelum itu (detik sejak boot) → epoch
+  void rebase(uint32_t base, uint32_t epochMin) {
+    for (int i = 0; i < _count; i++) {
+      LogEntry& e = at(i);
+      if (e.ts < epochMin) e.ts += base;
+    }
+  }
+
+private:
+  LogEntry* _e;
+  int       _cap, _head, _count;
+  uint32_t  _seq;
+};
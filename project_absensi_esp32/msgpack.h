@@ -0,0 +1,84 @@
+#pragma once
+/*
+ * msgpack.h — Encoder MessagePack minimal ke buffer tetap
+ * Dipakai untuk frame WebSocket biner (opsional, client yang minta).
+ * Subset: map, array, str, uint/int, bool. Decoder-nya ada di halaman.h.
+ * Tidak bergantung Arduino — bisa di-compile di host.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class MpBuf {
+public:
+  MpBuf(uint8_t* buf, size_t cap) : _buf(buf), _cap(cap), _len(0), _over(false) {}
+
+  MpBuf& map(uint8_t n) {            // n <= 15
+    return put(0x80 | n);
+  }
+  MpBuf& arr(uint8_t n) {            // n <= 15
+    return put(0x90 | n);
+  }
+  // Array yang jumlahnya baru diketahui belakangan → patchArr()
+  size_t arrLater() {
+    size_t at = _len;
+    put(0xDC); put(0); put(0);
+    return at;
+  }
+  void patchArr(size_t at, uint16_t n) {
+    if (at + 3 > _len) return;
+    _buf[at+1] = n >> 8; _buf[at+2] = n & 0xFF;
+  }
+
+  MpBuf& str(const char* s) { return str(s, strlen(s)); }
+  MpBuf& str(const char* s, size_t n) {
+    if      (n < 32)  put(0xA0 | n);
+    else if (n < 256) { put(0xD9); put(n); }
+    else              { put(0xDA); put(n >> 8); put(n & 0xFF); }
+    return raw((const uint8_t*)s, n);
+  }
+  MpBuf& key(const char* k) { return str(k); }
+
+  MpBuf& uint(uint32_t v) {
+    if      (v < 128)    return put(v);
+    else if (v < 256)    { put(0xCC); return put(v); }
+    else if (v < 65536)  { put(0xCD); put(v >> 8); return put(v & 0xFF); }
+    put(0xCE); put(v >> 24); put(v >> 16); put(v >> 8); return put(v & 0xFF);
+  }
+  MpBuf& sint(int32_t v) {
+    if (v >= 0)   return uint(v);
+    if (v >= -32) return put((uint8_t)v);
+    put(0xD2); put(v >> 24); put(v >> 16); put(v >> 8); return put(v & 0xFF);
+  }
+  MpBuf& boolean(bool b) { return put(b ? 0xC3 : 0xC2); }
+
+  // Posisi bool yang nilainya diputuskan belakangan (mis. "more")
+  size_t boolLater()                  { size_t at = _len; put(0xC2); return at; }
+  void   patchBool(size_t at, bool b) { if (at < _len) _buf[at] = b ? 0xC3 : 0xC2; }
+
+  MpBuf& raw(const uint8_t* p, size_t n) {
+    if (_len + n > _cap) { _over = true; return *this; }
+    memcpy(_buf + _len, p, n);
+    _len += n;
+    return *this;
+  }
+
+  void clear() { _len = 0; _over = false; }
+
+  const uint8_t* data()       const { return _buf; }
+  size_t         length()     const { return _len; }
+  size_t         room()       const { return _cap - _len; }
+  bool           overflowed() const { return _over; }
+
+private:
+  MpBuf& put(uint8_t b) {
+    if (_len >= _cap) { _over = true; return *this; }
+    _buf[_len++] = b;
+    return *this;
+  }
+
+  uint8_t* _buf;
+  size_t   _cap, _len;
+  bool     _over;
+};
@@ -6,14 +6,16 @@
  *
  *  HARDWARE:
  *    OLED SH1106 1.3"  │ SDA=21  SCL=22
- *    RFID RC522        │ SCK=18  MOSI=23  MISO=19  SS=5  RST=17
+ *    RFID RC522        │ SCK=18  MOSI=23  MISO=19  SS=5  RST=17  (IRQ opsional, RFID_IRQ)
  *    Buzzer            │ PIN 25
  *    Tombol KIRI       │ PIN 12  (tap=scroll/back | tahan 2dtk=admin)
  *    Tombol KANAN      │ PIN 14  (pilih/konfirmasi)
  *
  *  STORAGE:
- *    LittleFS — /users.json (tidak aus, tahan hapus/tulis berulang)
- *    Format: {"count":N,"users":[{"uid":"AA:BB:CC:DD","name":"..."},...]}
+ *    LittleFS — /users.bin (record biner, edit di tempat, CRC per record)
+ *    /users.json = format import/export:
+ *      {"count":N,"users":[{"uid":"AA:BB:CC:DD","name":"..."},...]}
+ *      ditaruh di LittleFS → diimpor saat boot; ekspor via /api/users.json
  *
  *  WiFi AP:
  *    SSID   : AbsensiESP32
@@ -27,11 +29,39 @@
  *    - WebSockets      → Markus Sattler (arduinoWebSockets)
  *    - ArduinoJson     → Benoit Blanchon (v6 atau v7)
  *    Built-in ESP32:
- *    - WiFi, WebServer, DNSServer, LittleFS
+ *    - WiFi, DNSServer, LittleFS
  *
  *  FILE STRUKTUR:
  *    absensi_esp32.ino   ← file ini
  *    halaman.h           ← HTML dashboard (PROGMEM)
+ *    halaman_gz.h        ← halaman.h versi minify + gzip + ETag
+ *                          (dibuat tools/gzip_page.py — jalankan ulang
+ *                          tiap halaman.h diubah)
+ *    uid_index.h         ← key UID 4/7/10 byte + indeks hash untuk findUser()
+ *    user_store.h        ← users.bin: record, CRC, tambah/hapus di tempat
+ *    log_ring.h          ← ring log terbaru di RAM
+ *    json_stream.h       ← penulis JSON/CSV buffer tetap (streaming)
+ *    msgpack.h           ← encoder MessagePack (frame WS biner, opsional)
+ *    spsc_queue.h        ← antrean lock-free antar task UI ↔ jaringan
+ *    timer_wheel.h       ← penjadwal non-blocking (nada buzzer, animasi, timeout)
+ *    frame_diff.h        ← kirim OLED hanya tile yang berubah
+ *    splash_frames.h     ← keyframe animasi splash (constexpr, dihitung compiler)
+ *    civil_time.h        ← epoch ↔ tanggal (RTC DS3231, kolom CSV)
+ *    log_index.h         ← indeks blok jurnal (rentang waktu + bloom UID)
+ *    day_summary.h       ← rekap harian per user + cooldown tap per UID
+ *    lat_hist.h          ← histogram latensi log2 (tahap baca kartu)
+ *    http_parse.h        ← parser request HTTP inkremental (buffer tetap)
+ *    http_server.h       ← server HTTP non-blocking, keep-alive, banyak koneksi
+ *    ws_queue.h          ← antrean kirim per client WS (status digabung)
+ *    user_repl.h         ← replikasi daftar user antar unit (UDP, LWW)
+ *    hist_codec.h        ← arsip riwayat tap: kamus UID di flash + kolom varint
+ *
+ *  TASK:
+ *    core 1 — loop(): RFID, tombol, OLED, buzzer, users.bin, jurnal
+ *    core 0 — netTask(): DNS, HTTP, WebSocket, ring log RAM, arsip /hist
+ *    UI → net : attendQ  (event absen)
+ *    net → UI : userMutQ (rename / hapus dari dashboard)
+ *    net → UI : replInQ  (record user dari unit lain)
  * ══════════════════════════════════════════════════════════
  */
 
@@ -40,12 +70,32 @@
 #include <U8g2lib.h>
 #include <Wire.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <WiFiUdp.h>
 #include <DNSServer.h>
 #include <WebSocketsServer.h>
 #include <LittleFS.h>
 #include <ArduinoJson.h>
+#include <esp_system.h>
+#include <lwip/sockets.h>
 #include "halaman.h"
+#include "halaman_gz.h"
+#include "http_server.h"
+#include "uid_index.h"
+#include "user_store.h"
+#include "log_ring.h"
+#include "json_stream.h"
+#include "msgpack.h"
+#include "spsc_queue.h"
+#include "timer_wheel.h"
+#include "frame_diff.h"
+#include "splash_frames.h"
+#include "civil_time.h"
+#include "log_index.h"
+#include "day_summary.h"
+#include "lat_hist.h"
+#include "ws_queue.h"
+#include "user_repl.h"
+#include "hist_codec.h"
 
 // ┌──────────────────────────────────────────────────────┐
 //   PIN
@@ -55,6 +105,7 @@
 #define RFID_MISO    19
 #define RFID_SS       5
 #define RFID_RST     17
+#define RFID_IRQ     -1    // pin IRQ RC522 (mis. 4); -1 = polling
 #define BUZZER_PIN   25
 #define BTN_LEFT     14
 #define BTN_RIGHT    12
@@ -62,27 +113,75 @@
 // ┌──────────────────────────────────────────────────────┐
 //   KONFIGURASI
 // └──────────────────────────────────────────────────────┘
-#define MAX_USERS    50
-#define UID_SIZE      4
-#define NAME_SIZE    20
-#define MAX_LOG     200
+#define MAX_USERS  2048         // NAME_SIZE & UID_STR di user_store.h
+#define MIN_LOG     200   // kapasitas ring log minimum
+#define MAX_LOG    2000   // kapasitas ring log maksimum
+#define LOG_HEAP_DIV  8   // ring log boleh pakai 1/8 heap bebas saat boot
+#define UID_SLOTS  4096   // slot indeks hash UID (pangkat 2, >= 2x MAX_USERS)
+
+#define JOURNAL_SEG_RECS  4096     // record per segmen jurnal (96 KB)
+#define JOURNAL_SEGMENTS     4     // segmen disimpan, tertua dihapus (sudah diarsip ke /hist)
+#define JOURNAL_BATCH       16     // flush kalau antrean sebanyak ini...
+#define JOURNAL_FLUSH_MS 5000UL    // ...atau record tertua sudah selama ini
+#define JIDX_BLOCKS (JOURNAL_SEG_RECS / LOG_BLOCK)   // blok indeks per segmen
+#define BOOT_TABLE          32     // offset jam per boot yang diingat indeks
+#define LOG_PAGE_DEF        50     // /api/logs: limit default...
+#define LOG_PAGE_MAX       200     // ...dan maksimum
+#define HTTP_ROW_MAX       192     // satu baris CSV / item JSON terbesar di respons streaming
+#define HIST_BLOCK         256     // tap per blok arsip /hist (hist_codec.h)
+#define HIST_KEY_SLOTS    4096     // slot kamus UID /hist/keys.bin (pangkat 2, >= 2x MAX_USERS, 16 B/slot)
+#define HIST_MAX_KB        640     // total arsip /hist/*.col, file tertua dihapus
+#define HIST_RETRY_MS    60000UL   // arsip segmen gagal → dicoba lagi sesudah ini
 
 #define HOLD_DURATION  2000UL
 #define MENU_TIMEOUT  20000UL
 #define RESULT_TIMEOUT 2500UL
 #define DEBOUNCE_MS     50UL
-#define SCAN_COOLDOWN  2000UL
+#define USER_OPS          64   // riwayat delta user untuk client yang reconnect
+#define SCAN_COOLDOWN  2000UL   // per UID — orang lain boleh langsung tap
+#define COOLDOWN_BITS   1024    // bitmap cooldown UID (pangkat 2)
+#define DAY_SLOTS        512    // UID berbeda per hari di rekap (pangkat 2)
+#define LATE_AFTER       480    // menit sejak 00:00 lokal; masuk sesudahnya = telat (08:00)
+#define TZ_DEFAULT       420    // zona waktu sebelum browser sinkron (menit dari UTC, WIB)
+#define RFID_ARM_MS       30    // mode IRQ: interval REQA ke antena
+#define LAT_BUCKETS       14    // histogram tahap tap: < 32 µs .. >= 262 ms (log2)
+#define METRICS_WS_MS   5000UL  // interval frame "metrics" ke dashboard
+#define WS_QUEUE_BYTES  4096    // antrean kirim per client WS (× WEBSOCKETS_SERVER_CLIENT_MAX)
+#define WS_DRAIN_US     3000    // jatah kirim WS per putaran task net
+#define WS_STALL_MS    4000UL   // socket tak bisa ditulis selama ini (antrean berisi) → putus
+
+#define NET_CORE          0    // task jaringan; loop() (UI) jalan di core 1
+#define NET_STACK      8192
+#define ATTEND_QUEUE     16    // event absen UI → net (pangkat 2)
+#define USER_MUT_QUEUE    8    // rename/hapus net → UI (pangkat 2)
+#define REPL_IN_QUEUE    64    // record replikasi net → UI (pangkat 2, >= REPL_MAX_RECS)
+#define REPL_TOMBS      128    // UID terhapus yang diingat untuk replikasi (/tombs.bin)
+#define REPL_PORT      4210    // UDP replikasi user antar unit
+#define SCHED_TIMERS     16    // timer aktif maksimum di task UI
+#define SPLASH_SKIP_ON_WDT 1   // reset karena watchdog → langsung layar absen
+#define USE_DS3231        0    // 1 = RTC DS3231 di bus I2C OLED (alamat 0x68)
+#define EPOCH_MIN 1700000000UL // ts di bawah ini = detik sejak boot (jam belum sinkron)
 
 const char* AP_SSID   = "AbsensiESP32";
 const char* AP_PASS   = "12345678";
 const char* AP_DOMAIN = "haris.com";
-const char* USERS_FILE = "/users.json";
+const char* SITE_SSID = "";                   // WiFi lokasi untuk replikasi antar unit ("" = unit tunggal)
+const char* SITE_PASS = "";
+const char* SITE_NAME = "absensi";            // unit beda nama lokasi tidak saling replikasi
+const char* SITE_KEY  = "";                   // kunci HMAC replikasi, sama di semua unit ("" = replikasi mati)
+const char* USERS_DB   = "/users.bin";
+const char* USERS_FILE = "/users.json";       // format import/export
+const char* USERS_IMPORTED = "/users.json.imported";
+const char* TOMBS_DB   = "/tombs.bin";
+const char* JOURNAL_DIR = "/log";
+const char* HIST_DIR    = "/hist";
 const byte  DNS_PORT  = 53;
 
 // ┌──────────────────────────────────────────────────────┐
 //   STATE
 // └──────────────────────────────────────────────────────┘
 enum AppMode {
+  MODE_SPLASH,
   MODE_ATTEND,
   MODE_ATTEND_OK,
   MODE_ATTEND_FAIL,
@@ -97,15 +196,155 @@ enum AppMode {
 // ┌──────────────────────────────────────────────────────┐
 //   STRUKTUR DATA
 // └──────────────────────────────────────────────────────┘
-struct User {
-  byte uid[UID_SIZE];
-  char name[NAME_SIZE];
+// User & format users.bin di user_store.h, LogEntry di log_ring.h
+
+// Record jurnal absensi — lihat bagian JURNAL
+#define JREC_BOOT  0xFFFF          // user = penanda boot baru, key.w[0] = JREC_FMT
+#define JREC_TIME  0xFFFE          // user = jam disinkron, key.w[0] = offset epoch - uptime
+#define JREC_FMT   2               // 0 = ts millis, 1 = ts detik (lihat WAKTU),
+                                   // 2 = key 96-bit (segmen 16 byte/record dimigrasi)
+
+struct JournalRec {
+  UidKey   key;
+  uint16_t user;         // index user saat tap, atau JREC_*
+  uint16_t boot;         // nomor boot
+  uint32_t ts;           // nowTs() saat tap: epoch, atau detik sejak boot
+  uint32_t crc;          // crc32 20 byte pertama
 };
 
-struct LogEntry {
-  char name[NAME_SIZE];
-  char uid[14];
-  unsigned long ts;
+struct JournalRecV1 {    // JREC_FMT <= 1: key = UID 4 byte dipak 32-bit
+  uint32_t key;
+  uint16_t user, boot;
+  uint32_t ts, crc;
+};
+
+// File indeks segmen tertutup /log/NNNNNNNN.idx:
+// [JidxHeader][LogBlock × blocks][BootInfo × boots]
+#define JIDX_MAGIC 0x32444A41UL    // "AJD2" (bloom dari key 96-bit)
+
+struct JidxHeader {
+  uint32_t magic;
+  uint32_t recs;         // record terindeks di segmen
+  uint16_t blocks, boots;
+  uint32_t crc;          // crc32 blok + boot
+};
+
+// Filter /api/logs — lihat bagian JURNAL
+struct LogQuery {
+  uint32_t from, to;     // epoch, inklusif
+  bool     ranged;       // from/to diberikan → record tanpa jam dilewati
+  bool     byUser;
+  UidKey   key;
+};
+
+// Perubahan daftar user untuk protokol delta WS — lihat bagian DELTA USER
+enum UserOpType : uint8_t { OP_ADD, OP_RENAME, OP_REMOVE };
+
+struct UserOp {
+  uint32_t   rev;
+  UserOpType op;
+  uint16_t   idx;
+  byte       uid[UID_MAX];
+  byte       uidLen;
+  char       name[NAME_SIZE];
+  ReplStamp  st;         // cap LWW sesudah op (hapus: cap tombstone) — replikasi
+};
+
+// Perubahan user dari dashboard, diterapkan task UI. User dicari
+// lewat key (bukan index) karena index bisa bergeser saat antre.
+struct UserMut {
+  UserOpType op;         // OP_RENAME / OP_REMOVE
+  UidKey     key;
+  char       name[NAME_SIZE];
+};
+
+// Record replikasi net → UI (replInQ); from = unit pengirim, untuk STALE
+struct ReplIn {
+  ReplRec  r;
+  uint32_t from;
+};
+
+// Event absen UI → net (attendQ). tapUs = micros() saat kartu
+// terdeteksi, untuk latensi tap → siaran WS (masuk antrean semua client).
+struct AttendEvent {
+  LogEntry e;
+  UidKey   key;
+  uint32_t tapUs;
+};
+
+// Satu langkah nada buzzer; dur = 0 menutup urutan
+struct ToneStep {
+  uint16_t freq;
+  uint16_t dur;          // ms bunyi
+  uint16_t next;         // ms dari awal langkah ini ke langkah berikutnya
+};
+
+// Latensi kartu terdeteksi → bunyi buzzer (µs) — /api/stats/tap
+struct TapStat {
+  uint32_t count, lastUs, maxUs;
+  uint32_t maxStreamUs;  // maks saat ada download HTTP streaming
+};
+
+// Tahap tap untuk histogram /api/stats/tap:
+// deteksi → UID terbaca → lookup user → buzzer, plus totalnya
+enum TapStage : uint8_t { STAGE_UID, STAGE_LOOKUP, STAGE_FEEDBACK, STAGE_TOTAL, TAP_STAGES };
+
+// Histogram runtime /api/metrics — lihat bagian METRIK.
+// Tiap histogram hanya ditulis satu task.
+enum MetricId : uint8_t {
+  M_LOOP,                // UI : satu putaran loop()
+  M_FIND_USER,           // UI : lookup UID → user
+  M_USER_SAVE,           // UI : tulis users.bin (tambah / rename / hapus)
+  M_OLED_FLUSH,          // UI : kirim frame OLED (pengganti sendBuffer)
+  M_JOURNAL_FLUSH,       // UI : tulis batch jurnal
+  M_HTTP,                // net: server.handleClient() yang melayani request
+  M_WS_SEND,             // net: satu frame WS ditulis ke socket (wsDrain)
+  METRICS
+};
+
+struct WsStat {
+  uint32_t msgs, bytes;  // dihitung per penerima
+};
+
+// Key penggabungan antrean WS: hanya frame terbaru yang dikirim
+enum WsKey : uint8_t { WSK_NONE, WSK_STATUS, WSK_METRICS };
+
+// Snapshot berhalaman yang diminta client (bit WsPeer.want)
+enum WsSnap : uint8_t { SNAP_NONE = 0, SNAP_USERS = 1, SNAP_LOGS = 2 };
+
+// State kirim per client WS — lihat bagian WEBSOCKET. Milik task net.
+struct WsPeer {
+  WsQueue<WS_QUEUE_BYTES> q;
+  unsigned long stallRef;    // antrean terakhir kosong / ada frame terkirim
+  uint32_t opRev;            // delta user terakhir yang sudah diantrekan
+  uint32_t snapRev;          // userRev saat snapshot users dimulai
+  uint32_t snapNext;         // users: index, logs: seq ring berikutnya
+  uint32_t snapEnd;          // logs: seq akhir (tap sesudahnya lewat "attend")
+  uint16_t snapCount, snapPart;
+  uint8_t  want;             // SNAP_* yang menunggu giliran
+  uint8_t  snap;             // SNAP_* yang sedang dikirim
+  uint8_t  snapTries;
+  bool     evict;            // tertinggal terlalu jauh → diputus wsDrain()
+};
+
+// /tombs.bin: [TombsHeader][ReplTomb × count] — lihat REPLIKASI USER
+#define TOMBS_MAGIC    0x32544241UL   // "ABT2"
+#define TOMBS_MAGIC_V1 0x42544241UL   // "ABTB": tanpa floor (dibaca, floor 0)
+
+struct TombsHeader {
+  uint32_t  magic;
+  uint32_t  count;
+  uint32_t  crc;         // crc32 floor + tombstone (v1: tombstone saja)
+  ReplStamp floor;       // v2 — cap tombstone tergusur terbaru
+};
+
+// Socket client untuk cek "bisa ditulis" tanpa blocking
+class WsServer : public WebSocketsServer {
+public:
+  explicit WsServer(uint16_t port) : WebSocketsServer(port) {}
+  int fd(uint8_t num) {
+    return num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[num].tcp ? _clients[num].tcp->fd() : -1;
+  }
 };
 
 // ┌──────────────────────────────────────────────────────┐
@@ -113,18 +352,45 @@ struct LogEntry {
 // └──────────────────────────────────────────────────────┘
 U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
 MFRC522          rfid(RFID_SS, RFID_RST);
-WebServer        server(80);
-WebSocketsServer ws(81);
+HttpServer       server(80);
+WsServer         ws(81);
 DNSServer        dns;
 
-User      users[MAX_USERS];
-int       userCount    = 0;
+UserStore<File, MAX_USERS, UID_SLOTS> userDb;   // users.bin + key UID + indeks hash
+uint32_t  userRev      = 0;           // naik tiap add/rename/remove (delta WS, seq replikasi)
+ReplTombs<REPL_TOMBS> tombs;          // UID terhapus + cap hapus; ditulis UI, dibaca net (dbMutex)
+uint32_t  replClock    = 0;           // jam Lamport cap LWW (task UI)
+uint32_t  unitId       = 0;           // id unit untuk replikasi (dari MAC)
+uint32_t  replJumps    = 0;           // record remote dengan cap terlalu jauh di depan (ditolak)
+uint32_t  replBuried   = 0;           // record hidup di bawah floor tombstone (diabaikan, STALE)
+uint32_t  replSwept    = 0;           // user dihapus rekonsiliasi
+uint8_t   replSeen[MAX_USERS / 8];    // rekonsiliasi: index user yang ada di snapshot peer (task UI)
+bool      replSweep    = false;
+SemaphoreHandle_t dbMutex = nullptr;  // users.bin dibaca net, ditulis UI
 AppMode   currentMode  = MODE_ATTEND;
 int       menuIndex    = 0;
 int       deleteTarget = -1;
 
-LogEntry  logs[MAX_LOG];
-int       logCount     = 0;
+LogRing   logRing;                   // buffer dialokasikan di logInit()
+volatile bool statusDirty = false;    // jumlah user/log berubah → push status di netTask()
+
+volatile uint32_t timeBase = 0;       // epoch - upSec(); 0 = jam belum sinkron
+volatile int16_t  tzMinutes = TZ_DEFAULT;  // zona waktu browser terakhir (menit dari UTC)
+volatile bool     timeSyncPending = false;   // task UI: catat offset ke jurnal
+volatile bool     rtcWritePending = false;   // task UI: tulis jam browser ke RTC
+
+SpscQueue<AttendEvent, ATTEND_QUEUE> attendQ;  // UI → net
+SpscQueue<UserMut, USER_MUT_QUEUE> userMutQ;   // net → UI
+SpscQueue<ReplIn, REPL_IN_QUEUE>   replInQ;    // net → UI
+TapStat       tapStat       = {0, 0, 0, 0};
+LatHist<LAT_BUCKETS, 5> tapHist[TAP_STAGES];   // ditulis task UI, dibaca HTTP
+LatHist<LAT_BUCKETS, 5> bcastHist;             // tap → siaran WS, task net
+LatHist<LAT_BUCKETS, 5> metric[METRICS];       // /api/metrics
+uint32_t      jrnWrites     = 0;               // write flash jurnal + .idx (task UI)
+uint32_t      jrnLost       = 0;               // tap dibuang: antrean jurnal penuh, flash tidak bisa ditulis
+uint32_t      histWrites    = 0;               // write flash arsip /hist (task net)
+volatile bool httpStreaming = false;             // ada respons producer berjalan
+uint8_t       csvExports    = 0;               // ekspor CSV berjalan → histStep() menunggu (task net)
 
 bool          btnLPrev      = HIGH, btnRPrev = HIGH;
 unsigned long btnLTime      = 0,    btnRTime = 0;
@@ -136,85 +402,182 @@ bool          btnLHeld      = false;
 bool          btnRPressed   = false;
 
 int           dotStep    = 0;
-unsigned long lastFrame  = 0;
-unsigned long lastAction = 0;
-unsigned long lastScan   = 0;
+unsigned long modeStart  = 0;
+TapCooldown<COOLDOWN_BITS> tapCool(SCAN_COOLDOWN);
+
+// Penjadwal task UI: 64 slot × 10 ms. Dijalankan di awal loop().
+TimerWheel<SCHED_TIMERS, 64, 10> sched;
+TimerId       toneTmr    = TIMER_NONE;
+TimerId       animTmr    = TIMER_NONE;
+TimerId       modeTmr    = TIMER_NONE;
 
 // ┌──────────────────────────────────────────────────────┐
 //   BUZZER
 // └──────────────────────────────────────────────────────┘
-void beepOK()     { tone(BUZZER_PIN,1000,90);  delay(120); tone(BUZZER_PIN,1600,110); }
-void beepFail()   { tone(BUZZER_PIN,350,380);  }
-void beepClick()  { tone(BUZZER_PIN,900,50);   }
-void beepDelete() { tone(BUZZER_PIN,600,90);   delay(120); tone(BUZZER_PIN,370,180); }
-void beepBoot()   { tone(BUZZER_PIN,800,70);   delay(90);  tone(BUZZER_PIN,1100,70); delay(90); tone(BUZZER_PIN,1500,130); }
+// Urutan nada dimainkan lewat sched, tanpa delay(). Nada baru
+// memotong urutan yang sedang jalan.
+const ToneStep TONE_OK[]     = { {1000,90,120}, {1600,110,0}, {0,0,0} };
+const ToneStep TONE_FAIL[]   = { {350,380,0},   {0,0,0} };
+const ToneStep TONE_CLICK[]  = { {900,50,0},    {0,0,0} };
+const ToneStep TONE_DELETE[] = { {600,90,120},  {370,180,0},  {0,0,0} };
+const ToneStep TONE_BOOT[]   = { {800,70,90},   {1100,70,90}, {1500,130,0}, {0,0,0} };
+
+void toneNext(void* arg) {
+  const ToneStep* st = (const ToneStep*)arg;
+  tone(BUZZER_PIN, st->freq, st->dur);
+  toneTmr = st[1].dur ? sched.after(st->next, toneNext, (void*)(st + 1)) : TIMER_NONE;
+}
+
+void play(const ToneStep* seq) {
+  sched.cancel(toneTmr);
+  toneNext((void*)seq);
+}
+
+void beepOK()     { play(TONE_OK);     }
+void beepFail()   { play(TONE_FAIL);   }
+void beepClick()  { play(TONE_CLICK);  }
+void beepDelete() { play(TONE_DELETE); }
+void beepBoot()   { play(TONE_BOOT);   }
 
 // ┌──────────────────────────────────────────────────────┐
-//   Format /users.json:
+//   USER DB — /users.bin (format & operasi di user_store.h)
+//   Di sini: buka file, migrasi versi lama, impor JSON, dan
+//   efek samping perubahan (delta WS, status dashboard).
+// └──────────────────────────────────────────────────────┘
+// users.bin dipakai dua task (UI tulis, net baca snapshot) —
+// dipasang ke userDb.setLock() saat setup
+void dbLock()   { xSemaphoreTake(dbMutex, portMAX_DELAY); }
+void dbUnlock() { xSemaphoreGive(dbMutex); }
+
+// ── Import / export /users.json ───────────────────────
 //   {"count":2,"users":[
 //     {"uid":"AA:BB:CC:DD","name":"Budi"},
 //     {"uid":"11:22:33:44","name":"Sari"}
 //   ]}
-// └──────────────────────────────────────────────────────┘
-void saveUsers() {
-
-  JsonDocument doc;
-  doc["count"] = userCount;
-  JsonArray arr = doc["users"].to<JsonArray>();
-  for (int i = 0; i < userCount; i++) {
-    JsonObject obj = arr.add<JsonObject>();
-    obj["uid"]  = uidToStr(users[i].uid, UID_SIZE);
-    obj["name"] = users[i].name;
-  }
-
-  File f = LittleFS.open(USERS_FILE, "w");
-  if (!f) {
-    Serial.println("[FS] Gagal buka file untuk write!");
-    return;
-  }
-  serializeJson(doc, f);
-  f.close();
-  Serial.printf("[FS] Saved %d users\n", userCount);
-}
-
-void loadUsers() {
-  if (!LittleFS.exists(USERS_FILE)) {
-    Serial.println("[FS] users.json tidak ditemukan, mulai kosong");
-    userCount = 0;
-    return;
-  }
-
+//   Ekspor: GET /api/users.json (lihat handleApiUsersExport)
+// users.json (mis. dari upload data LittleFS) digabung ke DB saat boot,
+// lalu di-rename supaya tidak diimpor ulang
+void importUsersJson() {
   File f = LittleFS.open(USERS_FILE, "r");
-  if (!f) { userCount = 0; return; }
+  if (!f) return;
 
   JsonDocument doc;
   DeserializationError err = deserializeJson(doc, f);
   f.close();
-
   if (err) {
     Serial.printf("[FS] JSON parse error: %s\n", err.c_str());
-    userCount = 0;
     return;
   }
 
-  userCount = doc["count"] | 0;
-  if (userCount > MAX_USERS) userCount = MAX_USERS;
-
+  int added = 0, renamed = 0;
   JsonArray arr = doc["users"].as<JsonArray>();
-  int idx = 0;
   for (JsonObject obj : arr) {
-    if (idx >= MAX_USERS) break;
+    User u;
+    memset(&u, 0, sizeof(u));
+    u.uidLen = strToUid(obj["uid"] | "", u.uid);
+    if (!u.uidLen) continue;
+    strncpy(u.name, obj["name"] | "Unknown", NAME_SIZE-1);
+    ReplStamp st = replStampNew();           // impor = perubahan lokal, menang atas cap lama
+    u.ver = st.ver; u.origin = st.origin;
+
+    int idx = findUser(u.uid, u.uidLen);
+    if (idx >= 0) {
+      if (userDb.writeUser(idx, u)) renamed++;
+    } else if (userDb.add(u, false) >= 0) {
+      added++;
+    }
+  }
+  userDb.writeHeader();
+  LittleFS.remove(USERS_IMPORTED);
+  LittleFS.rename(USERS_FILE, USERS_IMPORTED);
+  Serial.printf("[FS] Import users.json: +%d baru, %d diperbarui\n", added, renamed);
+}
+
+// File yang ditulis ulang lewat .tmp (close → remove lama → rename).
+// Mati listrik di antara remove & rename: file hilang, .tmp sudah
+// lengkap → pakai .tmp. Keduanya ada → .tmp belum tentu lengkap, buang.
+void fsSettleTmp(const String& path) {
+  String tmp = path + ".tmp";
+  if (!LittleFS.exists(tmp)) return;
+  if (LittleFS.exists(path)) LittleFS.remove(tmp);
+  else                       LittleFS.rename(tmp, path);
+}
+
+// users.bin versi lama → versi sekarang. Record membesar, jadi
+// ditulis ke file baru lalu di-rename.
+//   v1: UID 4 byte, record 28 byte
+//   v2: UID 4/7/10 byte tanpa cap LWW, record 36 byte → cap {0, 0}
+//       (kalah dari perubahan apapun di unit lain)
+bool dbMigrate(DbHeader& h) {
+  String tmp = String(USERS_DB) + ".tmp";
+  File dst = LittleFS.open(tmp, "w+");
+  if (!dst) return false;
+  DbHeader nh = { DB_MAGIC, DB_VERSION, (uint16_t)sizeof(DbRecord), 0, 0 };
+  dst.write((const uint8_t*)&nh, sizeof(nh));
+  File&      src = userDb.file();
+  DbRecordV1 o1;
+  DbRecordV2 o2;
+  DbRecord   r;
+  src.seek(sizeof(DbHeader));
+  for (uint32_t i = 0; i < h.count && i < MAX_USERS; i++) {
+    memset(&r, 0, sizeof(r));
+    if (h.version == 1) {
+      if (src.read((uint8_t*)&o1, sizeof(o1)) != sizeof(o1)) break;
+      if (o1.crc != crc32(&o1, offsetof(DbRecordV1, crc))) continue;
+      memcpy(r.u.uid, o1.uid, sizeof(o1.uid));
+      r.u.uidLen = sizeof(o1.uid);
+      memcpy(r.u.name, o1.name, NAME_SIZE);
+    } else {
+      if (src.read((uint8_t*)&o2, sizeof(o2)) != sizeof(o2)) break;
+      if (o2.crc != crc32(&o2, UID_MAX + 1 + NAME_SIZE)) continue;
+      memcpy(r.u.uid, o2.uid, UID_MAX);
+      r.u.uidLen = o2.uidLen;
+      memcpy(r.u.name, o2.name, NAME_SIZE);
+    }
+    r.crc = crc32(&r.u, sizeof(User));
+    dst.write((const uint8_t*)&r, sizeof(r));
+    nh.count++;
+  }
+  nh.crc = crc32(&nh, offsetof(DbHeader, crc));
+  dst.seek(0);
+  bool ok = dst.write((const uint8_t*)&nh, sizeof(nh)) == sizeof(nh);
+  dst.close();
+  if (!ok) return false;
+  src.close();
+  LittleFS.remove(USERS_DB);
+  LittleFS.rename(tmp, USERS_DB);
+  src = LittleFS.open(USERS_DB, "r+");
+  Serial.printf("[FS] users.bin v%d → v%d: %lu user\n", h.version, DB_VERSION, (unsigned long)nh.count);
+  h = nh;
+  return (bool)src;
+}
 
-    const char* uidStr = obj["uid"] | "";
-    strToUid(uidStr, users[idx].uid);
+void loadUsers() {
+  fsSettleTmp(USERS_DB);                 // migrasi terputus mati listrik
 
-    const char* nm = obj["name"] | "Unknown";
-    strncpy(users[idx].name, nm, NAME_SIZE-1);
-    users[idx].name[NAME_SIZE-1] = '\0';
-    idx++;
+  bool fresh = !LittleFS.exists(USERS_DB);
+  File& f = userDb.file();
+  f = LittleFS.open(USERS_DB, fresh ? "w+" : "r+");
+  if (!f) {
+    Serial.println("[FS] Gagal buka users.bin!");
+    return;
   }
-  userCount = idx;
-  Serial.printf("[FS] Loaded %d users\n", userCount);
+
+  DbHeader h;
+  bool valid = !fresh &&
+               f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+               h.magic == DB_MAGIC && h.crc == crc32(&h, offsetof(DbHeader, crc));
+  if (valid && ((h.version == 1 && h.recSize == sizeof(DbRecordV1)) ||
+                (h.version == 2 && h.recSize == sizeof(DbRecordV2)))) valid = dbMigrate(h);
+  valid = valid && h.version == DB_VERSION && h.recSize == sizeof(DbRecord);
+  if (!fresh && !valid) Serial.println("[FS] Header users.bin rusak, mulai kosong");
+
+  userDb.load(valid ? h.count : 0, !valid);
+  tombsLoad();
+  if (userDb.maxVer() > replClock) replClock = userDb.maxVer();
+
+  if (LittleFS.exists(USERS_FILE)) importUsersJson();
+  Serial.printf("[FS] Loaded %d users\n", userDb.count());
 }
 
 // ┌──────────────────────────────────────────────────────┐
@@ -231,122 +594,1672 @@ String uidToStr(byte* uid, byte size) {
   return s;
 }
 
-void strToUid(const char* str, byte* uid) {
-  for (int i = 0; i < UID_SIZE; i++) {
-    uid[i] = 0;
-    if (str[i*3] == '\0') break;
-    char h[3] = { str[i*3], str[i*3+1], '\0' };
-    uid[i] = (byte)strtol(h, nullptr, 16);
-  }
+// O(1) rata-rata — lewat indeks hash, bukan scan linear. Task UI
+// (pemilik metric[M_FIND_USER]); task net pakai userDb.find().
+int findKey(const UidKey& k) {
+  uint32_t t = micros();
+  int idx = userDb.find(k);
+  metric[M_FIND_USER].add(micros() - t);
+  return idx;
 }
 
-int findUser(byte* uid) {
-  for (int i = 0; i < userCount; i++) {
-    bool ok = true;
-    for (int j = 0; j < UID_SIZE; j++)
-      if (users[i].uid[j] != uid[j]) { ok=false; break; }
-    if (ok) return i;
-  }
-  return -1;
+int findUser(const byte* uid, byte len) {
+  return findKey(uidKeyOf(uid, len));
+}
+
+// "AA:BB:CC:DD" dari key (kebalikan uidKeyOf), out minimal UID_STR
+void uidOfKey(char* out, const UidKey& k) {
+  byte uid[UID_MAX];
+  uidFmt(out, uid, uidKeyBytes(k, uid));
 }
 
-bool addUser(byte* uid) {
-  if (findUser(uid) >= 0 || userCount >= MAX_USERS) return false;
-  memcpy(users[userCount].uid, uid, UID_SIZE);
-  snprintf(users[userCount].name, NAME_SIZE, "User%02d", userCount+1);
-  userCount++;
-  saveUsers();
+// Nama user ber-key k, "?" kalau sudah dihapus. Dipakai task net:
+// index bisa bergeser saat dibaca → UID record dicek ulang.
+void nameOfKey(char* out, const UidKey& k) {
+  User u;
+  if (!userDb.read(userDb.find(k), u) || uidKeyOf(u.uid, u.uidLen) != k) strcpy(u.name, "?");
+  strcpy(out, u.name);
+}
+
+// Perubahan lokal diberi cap baru; hasil replikasi (replApplyIn)
+// membawa cap unit asalnya. Lihat bagian REPLIKASI USER.
+bool addUser(const byte* uid, byte len) {
+  User u;
+  memset(&u, 0, sizeof(u));
+  u.uidLen = len > UID_MAX ? UID_MAX : len;
+  memcpy(u.uid, uid, u.uidLen);
+  snprintf(u.name, NAME_SIZE, "User%02d", userDb.count()+1);
+  ReplStamp st = replStampNew();
+  u.ver = st.ver; u.origin = st.origin;
+  return insertUser(u);
+}
+
+bool insertUser(const User& u) {
+  uint32_t t = micros();
+  int idx = userDb.add(u, true);
+  metric[M_USER_SAVE].add(micros() - t);
+  if (idx < 0) return false;
+  tombDrop(uidKeyOf(u.uid, u.uidLen));
+  statusDirty = true;
+  opPush(OP_ADD, idx, u);
+  return true;
+}
+
+bool renameUser(int idx, const char* name) {
+  return renameUserAt(idx, name, replStampNew());
+}
+
+bool renameUserAt(int idx, const char* name, const ReplStamp& st) {
+  User u;
+  if (!userDb.read(idx, u)) return false;
+  memset(u.name, 0, NAME_SIZE);
+  strncpy(u.name, name, NAME_SIZE-1);
+  u.ver = st.ver; u.origin = st.origin;
+  uint32_t t = micros();
+  bool ok = userDb.writeUser(idx, u);
+  metric[M_USER_SAVE].add(micros() - t);
+  if (!ok) {
+    Serial.printf("[FS] Gagal tulis record #%d\n", idx);
+    return false;
+  }
+  opPush(OP_RENAME, idx, u);
   return true;
 }
 
 bool removeUser(int idx) {
-  if (idx < 0 || idx >= userCount) return false;
-  for (int i = idx; i < userCount-1; i++) users[i] = users[i+1];
-  userCount--;
-  saveUsers();
+  return removeUserAt(idx, replStampNew());
+}
+
+// Swap-remove (user terakhir pindah ke slot idx) — lihat UserStore::remove.
+// UID-nya diingat sebagai tombstone supaya unit lain ikut menghapus.
+bool removeUserAt(int idx, const ReplStamp& st) {
+  if (idx < 0 || idx >= userDb.count()) return false;
+  User u;
+  userDb.read(idx, u);
+  u.ver = st.ver; u.origin = st.origin;
+  if (u.uidLen) tombPut(uidKeyOf(u.uid, u.uidLen), st);
+  if (replSweep) replSeenMove(idx, userDb.count() - 1);
+  opPush(OP_REMOVE, idx, u);
+  uint32_t t = micros();
+  userDb.remove(idx);
+  metric[M_USER_SAVE].add(micros() - t);
+  statusDirty = true;
   return true;
 }
 
 // ┌──────────────────────────────────────────────────────┐
-//   LOG (RAM only — hilang saat restart)
+//   WAKTU — epoch detik tanpa NTP (mode AP, tanpa internet)
+//   Sumber: browser dashboard saat WS connect ({"cmd":"time"})
+//   dan/atau RTC DS3231 (USE_DS3231). Jam disimpan sebagai
+//   offset terhadap uptime 64-bit (esp_timer), jadi tidak ikut
+//   wrap millis() 49 hari. Sebelum sinkron, ts = detik sejak
+//   boot (< EPOCH_MIN) dan dikonversi begitu offset diketahui;
+//   offset juga dicatat di jurnal (JREC_TIME). Format tanggal
+//   dikerjakan browser — ESP32 hanya untuk CSV.
 // └──────────────────────────────────────────────────────┘
-void addLog(const char* name, const char* uid) {
-  if (logCount >= MAX_LOG) {
-    for (int i = 0; i < MAX_LOG-1; i++) logs[i] = logs[i+1];
-    logCount = MAX_LOG-1;
+uint32_t upSec() { return (uint32_t)(esp_timer_get_time() / 1000000LL); }
+
+uint32_t nowTs() {
+  uint32_t base = timeBase;
+  return base ? base + upSec() : upSec();
+}
+
+bool timeSynced() { return timeBase != 0; }
+
+// Task net — dari browser. Beda <= 2 detik diabaikan supaya banyak
+// client tidak saling menggeser jam.
+void timeSet(uint32_t epoch, int tz) {
+  if (epoch < EPOCH_MIN) return;
+  tzMinutes = tz;
+  uint32_t base = epoch - upSec(), cur = timeBase;
+  if (cur && (base > cur ? base - cur : cur - base) <= 2) return;
+  timeBase = base;
+  if (!cur) { logRebase(base); summaryRebase(base); }
+  timeSyncPending = rtcWritePending = true;
+  Serial.printf("[TIME] Sinkron dari browser: %lu (tz %+d menit)\n", (unsigned long)epoch, tz);
+}
+
+#if USE_DS3231
+#define DS3231_ADDR 0x68
+
+uint8_t bcd2bin(uint8_t v) { return (v >> 4) * 10 + (v & 0x0F); }
+uint8_t bin2bcd(uint8_t v) { return ((v / 10) << 4) | (v % 10); }
+
+bool rtcRead(uint32_t& epoch) {
+  Wire.beginTransmission(DS3231_ADDR);
+  Wire.write(0);
+  if (Wire.endTransmission() != 0 || Wire.requestFrom(DS3231_ADDR, 7) != 7) return false;
+  uint8_t r[7];
+  for (int i = 0; i < 7; i++) r[i] = Wire.read();
+  CivilTime t;
+  t.second = bcd2bin(r[0] & 0x7F); t.minute = bcd2bin(r[1] & 0x7F);
+  t.hour   = bcd2bin(r[2] & 0x3F);                       // mode 24 jam
+  t.day    = bcd2bin(r[4] & 0x3F); t.month  = bcd2bin(r[5] & 0x1F);
+  t.year   = 2000 + bcd2bin(r[6]);
+  epoch = epochOf(t);
+  return epoch >= EPOCH_MIN;
+}
+
+bool rtcWrite(uint32_t epoch) {
+  CivilTime t = civilOf(epoch);
+  Wire.beginTransmission(DS3231_ADDR);
+  Wire.write(0);
+  Wire.write(bin2bcd(t.second)); Wire.write(bin2bcd(t.minute)); Wire.write(bin2bcd(t.hour));
+  Wire.write(1);                                         // hari dalam minggu, tidak dipakai
+  Wire.write(bin2bcd(t.day)); Wire.write(bin2bcd(t.month)); Wire.write(bin2bcd(t.year - 2000));
+  return Wire.endTransmission() == 0;
+}
+#endif
+
+// Task UI, sesudah Wire.begin()
+void timeInit() {
+#if USE_DS3231
+  uint32_t epoch;
+  if (rtcRead(epoch)) {
+    timeBase = epoch - upSec();
+    timeSyncPending = true;
+    Serial.printf("[TIME] Dari DS3231: %lu\n", (unsigned long)epoch);
+    return;
   }
-  strncpy(logs[logCount].name, name, NAME_SIZE-1);
-  logs[logCount].name[NAME_SIZE-1] = '\0';
-  strncpy(logs[logCount].uid, uid, 13);
-  logs[logCount].uid[13] = '\0';
-  logs[logCount].ts = millis();
-  logCount++;
+  Serial.println("[TIME] DS3231 tidak ada / belum diset");
+#endif
 }
 
-String formatUptime(unsigned long ms) {
+// Task UI — catat offset baru ke jurnal (dan RTC)
+void timeTick() {
+  if (timeSyncPending) {
+    timeSyncPending = false;
+    journalAppend(uidKeyRaw(timeBase), JREC_TIME, nowTs());
+  }
+#if USE_DS3231
+  if (rtcWritePending) { rtcWritePending = false; rtcWrite(nowTs()); }
+#endif
+}
+
+// "YYYY-MM-DD HH:MM:SS" waktu lokal (zona browser), atau "+HH:MM:SS"
+// sejak boot kalau ts belum tersinkron. Hanya untuk CSV.
+void fmtTs(char* b, size_t n, uint32_t ts) {
+  if (ts < EPOCH_MIN) {
+    snprintf(b, n, "+%02lu:%02lu:%02lu", (unsigned long)(ts / 3600),
+             (unsigned long)(ts / 60 % 60), (unsigned long)(ts % 60));
+    return;
+  }
+  CivilTime t = civilOf(ts + tzMinutes * 60L);
+  snprintf(b, n, "%04u-%02u-%02u %02u:%02u:%02u",
+           t.year, t.month, t.day, t.hour, t.minute, t.second);
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   LOG — ring terbaru di RAM untuk dashboard
+//   (salinan persisten ada di JURNAL)
+// └──────────────────────────────────────────────────────┘
+// Kapasitas ring diambil dari heap bebas saat boot (MIN_LOG..MAX_LOG)
+void logInit() {
+  int cap = ESP.getFreeHeap() / LOG_HEAP_DIV / sizeof(LogEntry);
+  cap = constrain(cap, MIN_LOG, MAX_LOG);
+  LogEntry* buf;
+  while (cap > 0 && !(buf = (LogEntry*)malloc(cap * sizeof(LogEntry)))) cap /= 2;
+  logRing.init(cap > 0 ? buf : nullptr, cap);
+  Serial.printf("[LOG] Ring RAM %d entri (%u byte)\n", logRing.capacity(),
+                (unsigned)(logRing.capacity() * sizeof(LogEntry)));
+}
+
+// O(1). Hanya dipanggil task net (dari attendQ), pembaca ring juga di task net.
+void addLog(const char* name, const char* uid, uint32_t ts) {
+  logRing.add(name, uid, ts);
+  statusDirty = true;
+}
+
+// Jam pertama kali sinkron: entri yang tercatat sebelum itu (detik
+// sejak boot) diubah ke epoch. Task net (pemilik ring).
+void logRebase(uint32_t base) { logRing.rebase(base, EPOCH_MIN); }
+
+void fmtUptime(char* b, size_t n, unsigned long ms) {
   unsigned long s = ms/1000;
   int h = s/3600; s %= 3600;
   int m = s/60;   s %= 60;
-  char b[12]; snprintf(b, sizeof(b), "%02d:%02d:%02d", h, m, (int)s);
+  snprintf(b, n, "%02d:%02d:%02d", h, m, (int)s);
+}
+
+String formatUptime(unsigned long ms) {
+  char b[12]; fmtUptime(b, sizeof(b), ms);
   return String(b);
 }
 
 // ┌──────────────────────────────────────────────────────┐
-//   WEBSOCKET — broadcast JSON ke semua client
+//   JURNAL — /log/NNNNNNNN.bin, append-only, persisten
+//   Record JournalRec 24 byte fixed, segmen dirotasi tiap
+//   JOURNAL_SEG_RECS record. Tap ditampung di RAM dan
+//   di-flush sekaligus (1 write flash per burst tap).
+//   Boot: segmen terakhir dicek CRC-nya, ekor yang rusak
+//   (mati listrik saat write) dipotong.
+//   Indeks: ringkasan tiap LOG_BLOCK record (log_index.h)
+//   untuk semua segmen ada di RAM; segmen yang ditutup juga
+//   disimpan ke NNNNNNNN.idx supaya boot tidak scan ulang.
 // └──────────────────────────────────────────────────────┘
-String jsonEsc(const char* s) {
-  String out;
-  while (*s) {
-    char c = *s++;
-    if      (c == '"')  out += "\\\"";
-    else if (c == '\\') out += "\\\\";
-    else                out += c;
+File       jrnFile;
+uint32_t   jrnFirstSeq = 1, jrnSeq = 1;   // segmen tertua & aktif
+uint32_t   jrnSegRecs  = 0;               // record di segmen aktif
+uint16_t   bootNo      = 0;
+uint32_t   jrnBootPos  = 0;               // posisi global record pertama boot ini
+JournalRec jrnPending[JOURNAL_BATCH];
+int        jrnPendingN = 0;
+unsigned long jrnPendingSince = 0;       // millis() record tertua di antrean
+
+LogBlock   jrnIdx[JOURNAL_SEGMENTS][JIDX_BLOCKS];   // slot = seq % JOURNAL_SEGMENTS
+uint32_t   jrnIdxRecs[JOURNAL_SEGMENTS];            // record terindeks per slot
+BootTable<BOOT_TABLE> jrnBoots;
+volatile uint32_t histDone = 0;           // segmen terakhir yang sudah diarsip (ARSIP, task net)
+SemaphoreHandle_t jrnMutex = nullptr;    // flush/rotasi (UI) vs /api/logs (net)
+
+void jrnLock()   { xSemaphoreTake(jrnMutex, portMAX_DELAY); }
+void jrnUnlock() { xSemaphoreGive(jrnMutex); }
+
+String journalPath(uint32_t seq) {
+  char b[24]; snprintf(b, sizeof(b), "%s/%08lu.bin", JOURNAL_DIR, (unsigned long)seq);
+  return String(b);
+}
+
+String journalIdxPath(uint32_t seq) {
+  char b[24]; snprintf(b, sizeof(b), "%s/%08lu.idx", JOURNAL_DIR, (unsigned long)seq);
+  return String(b);
+}
+
+// Segmen tertua yang indeksnya ada di RAM. Segmen lebih tua (belum
+// diarsip, jadi belum boleh dihapus) slotnya sudah dipakai segmen lain.
+uint32_t journalIdxFirst() {
+  return jrnSeq >= JOURNAL_SEGMENTS ? max(jrnFirstSeq, jrnSeq - JOURNAL_SEGMENTS + 1) : jrnFirstSeq;
+}
+
+// ts = epoch, return false kalau jam record tidak diketahui
+// (ts = detik sejak boot)
+bool journalEpoch(const JournalRec& r, uint32_t& ts) {
+  if (r.ts >= EPOCH_MIN) { ts = r.ts; return true; }
+  return jrnBoots.resolve(r.boot, r.ts, ts);
+}
+
+void journalIdxClear(uint32_t seq) {
+  uint32_t slot = seq % JOURNAL_SEGMENTS;
+  for (int b = 0; b < JIDX_BLOCKS; b++) lbReset(jrnIdx[slot][b]);
+  jrnIdxRecs[slot] = 0;
+}
+
+// Record ke-pos segmen seq masuk ringkasan bloknya
+void journalIndex(uint32_t seq, uint32_t pos, const JournalRec& r) {
+  uint32_t slot = seq % JOURNAL_SEGMENTS;
+  if (r.user == JREC_BOOT)      jrnBoots.boot(r.boot, (uint8_t)r.key.w[0]);
+  else if (r.user == JREC_TIME) jrnBoots.timeSet(r.boot, r.key.w[0]);
+  else {
+    uint32_t ts;
+    bool timed = journalEpoch(r, ts);
+    lbAdd(jrnIdx[slot][pos / LOG_BLOCK], r.key, ts, timed);
+  }
+  jrnIdxRecs[slot] = pos + 1;
+}
+
+// Segmen yang baru ditutup → NNNNNNNN.idx (ringkasan + tabel boot)
+void journalIdxSave(uint32_t seq) {
+  uint32_t slot = seq % JOURNAL_SEGMENTS;
+  JidxHeader h = { JIDX_MAGIC, jrnIdxRecs[slot], JIDX_BLOCKS, BOOT_TABLE, 0 };
+  h.crc = crc32(jrnBoots.data(), jrnBoots.bytes(), crc32(jrnIdx[slot], sizeof(jrnIdx[slot])));
+  File f = LittleFS.open(journalIdxPath(seq), "w");
+  if (!f) return;
+  f.write((const uint8_t*)&h, sizeof(h));
+  f.write((const uint8_t*)jrnIdx[slot], sizeof(jrnIdx[slot]));
+  f.write((const uint8_t*)jrnBoots.data(), jrnBoots.bytes());
+  f.close();
+  jrnWrites++;
+}
+
+// Boot: ringkasan segmen tertutup dibaca dari .idx. Tidak ada /
+// rusak (mis. jurnal dari firmware lama) → segmen di-scan sekali
+// dan .idx-nya ditulis.
+void journalIdxLoad(uint32_t seq) {
+  uint32_t slot = seq % JOURNAL_SEGMENTS;
+  JidxHeader h;
+  BootInfo   boots[BOOT_TABLE];
+  File f = LittleFS.open(journalIdxPath(seq), "r");
+  bool ok = f && f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+            h.magic == JIDX_MAGIC && h.blocks == JIDX_BLOCKS && h.boots == BOOT_TABLE &&
+            h.recs <= JOURNAL_SEG_RECS &&
+            f.read((uint8_t*)jrnIdx[slot], sizeof(jrnIdx[slot])) == sizeof(jrnIdx[slot]) &&
+            f.read((uint8_t*)boots, sizeof(boots)) == sizeof(boots) &&
+            h.crc == crc32(boots, sizeof(boots), crc32(jrnIdx[slot], sizeof(jrnIdx[slot])));
+  if (f) f.close();
+  if (ok) {
+    jrnIdxRecs[slot] = h.recs;
+    jrnBoots.merge(boots);
+    return;
+  }
+
+  journalIdxClear(seq);
+  f = LittleFS.open(journalPath(seq), "r");
+  if (!f) return;
+  JournalRec r;
+  uint32_t pos = 0;
+  for (; pos < JOURNAL_SEG_RECS && f.read((uint8_t*)&r, sizeof(r)) == sizeof(r); pos++)
+    if (r.crc == crc32(&r, offsetof(JournalRec, crc))) journalIndex(seq, pos, r);
+  f.close();
+  jrnIdxRecs[slot] = pos;
+  journalIdxSave(seq);
+  Serial.printf("[LOG] Indeks segmen %lu dibangun ulang (%lu record)\n",
+                (unsigned long)seq, (unsigned long)pos);
+}
+
+bool journalOpenSeg() {
+  jrnFile = LittleFS.open(journalPath(jrnSeq), "a");
+  if (!jrnFile) Serial.printf("[LOG] Gagal buka segmen %lu\n", (unsigned long)jrnSeq);
+  return (bool)jrnFile;
+}
+
+void journalRotate() {
+  jrnFile.close();
+  journalIdxSave(jrnSeq);
+  jrnSeq++; jrnSegRecs = 0;
+  // Hanya segmen yang sudah masuk arsip yang dihapus; arsip macet
+  // (flash penuh) → jurnal memanjang sampai arsip jalan lagi
+  while (jrnSeq - jrnFirstSeq + 1 > JOURNAL_SEGMENTS && jrnFirstSeq <= histDone) {
+    LittleFS.remove(journalPath(jrnFirstSeq));
+    LittleFS.remove(journalIdxPath(jrnFirstSeq));
+    jrnFirstSeq++;
+  }
+  if (jrnSeq - jrnFirstSeq + 1 > JOURNAL_SEGMENTS)
+    Serial.printf("[LOG] Segmen %lu..%lu belum diarsip, tidak dihapus\n",
+                  (unsigned long)jrnFirstSeq, (unsigned long)(jrnSeq - JOURNAL_SEGMENTS));
+  journalIdxClear(jrnSeq);
+  journalOpenSeg();
+}
+
+// Write pendek (flash penuh) → file dibuka ulang "r+" di akhir record
+// utuh, sisa antrean tetap di jrnPending dan ditulis ulang di flush
+// berikutnya (JOURNAL_FLUSH_MS kemudian). Record yang sempat masuk
+// ditimpa dengan isi yang sama, potongan setengah jadi ikut tertimpa.
+void journalFlush() {
+  uint32_t t = micros();
+  jrnLock();
+  int i = 0;
+  if (!jrnFile) journalOpenSeg();
+  while (i < jrnPendingN && jrnFile) {
+    if (jrnSegRecs >= JOURNAL_SEG_RECS) { journalRotate(); continue; }
+    int n = jrnPendingN - i;
+    if (n > (int)(JOURNAL_SEG_RECS - jrnSegRecs)) n = JOURNAL_SEG_RECS - jrnSegRecs;
+    size_t len = n * sizeof(JournalRec);
+    if (jrnFile.write((const uint8_t*)&jrnPending[i], len) != len) {
+      Serial.printf("[LOG] Write jurnal gagal, %d tap ditahan\n", jrnPendingN - i);
+      jrnFile.close();
+      jrnFile = LittleFS.open(journalPath(jrnSeq), "r+");
+      if (jrnFile && !jrnFile.seek(jrnSegRecs * sizeof(JournalRec))) jrnFile.close();
+      break;
+    }
+    for (int k = 0; k < n; k++) journalIndex(jrnSeq, jrnSegRecs + k, jrnPending[i + k]);
+    jrnSegRecs += n; i += n;
+    jrnWrites++;
   }
-  return out;
+  if (jrnFile) jrnFile.flush();
+  jrnPendingN -= i;
+  if (jrnPendingN) {
+    memmove(jrnPending, jrnPending + i, jrnPendingN * sizeof(JournalRec));
+    jrnPendingSince = millis();
+  }
+  jrnUnlock();
+  metric[M_JOURNAL_FLUSH].add(micros() - t);
 }
 
-void wsBroadcastStatus() {
-  String msg = "{\"type\":\"status\","
-               "\"uptime\":\"" + formatUptime(millis()) + "\","
-               "\"users\":"    + String(userCount) + ","
-               "\"logs\":"     + String(logCount)  + "}";
-  ws.broadcastTXT(msg);
+// ts = nowTs(). Boot ber-key JREC_FMT >= 1: ts record boot itu dalam
+// detik; yang < EPOCH_MIN dikonversi dengan key JREC_TIME pertama
+// sesudahnya di boot yang sama (epoch = ts + offset).
+void journalAppend(const UidKey& key, uint16_t user, uint32_t ts) {
+  if (jrnPendingN >= JOURNAL_BATCH) journalFlush();        // flush sebelumnya gagal
+  if (jrnPendingN >= JOURNAL_BATCH) { jrnLost++; return; }
+  JournalRec& r = jrnPending[jrnPendingN];
+  r.key = key; r.user = user; r.boot = bootNo; r.ts = ts;
+  r.crc = crc32(&r, offsetof(JournalRec, crc));
+  if (jrnPendingN++ == 0) jrnPendingSince = millis();
+  if (jrnPendingN >= JOURNAL_BATCH) journalFlush();
 }
 
-void wsBroadcastAttend(const char* name, const char* uid) {
-  String msg = "{\"type\":\"attend\","
-               "\"name\":\""  + jsonEsc(name) + "\","
-               "\"uid\":\""   + jsonEsc(uid)  + "\","
-               "\"time\":\""  + formatUptime(millis()) + "\"}";
-  ws.broadcastTXT(msg);
+// Dipanggil dari loop() — flush antrean yang sudah terlalu lama
+void journalTick(unsigned long now) {
+  if (jrnPendingN && now - jrnPendingSince >= JOURNAL_FLUSH_MS) journalFlush();
 }
 
-void wsBroadcastUsers() {
-  String msg = "{\"type\":\"users\",\"count\":" + String(userCount) + ",\"users\":[";
-  for (int i = 0; i < userCount; i++) {
-    if (i) msg += ",";
-    msg += "{\"name\":\"" + jsonEsc(users[i].name)
-        + "\",\"uid\":\""  + uidToStr(users[i].uid, UID_SIZE) + "\"}";
+// ── Query /api/logs (task net) ────────────────────────
+JournalRec jrnReadBuf[LOG_BLOCK];        // buffer baca blok, hanya task net
+
+// Blok b segmen seq dibaca hanya kalau ringkasannya lolos filter.
+// Return jumlah record di out; ts diganti epoch hasil resolve
+// (atau tetap detik sejak boot), record rusak / penanda diberi
+// user = JREC_BOOT supaya dilewati pemanggil. Lock per blok →
+// flush task UI paling lama menunggu satu baca 1 KB. Segmen di luar
+// jendela indeks (arsip tertinggal) dibaca blok penuh tanpa saring.
+int journalReadBlock(uint32_t seq, int b, const LogQuery& q, JournalRec* out) {
+  int n = 0;
+  jrnLock();
+  uint32_t slot = seq % JOURNAL_SEGMENTS, at = (uint32_t)b * LOG_BLOCK;
+  const LogBlock& blk = jrnIdx[slot][b];
+  bool indexed = seq >= journalIdxFirst();
+  if (seq >= jrnFirstSeq && seq <= jrnSeq &&
+      (!indexed || (at < jrnIdxRecs[slot] &&
+                    (!q.byUser || lbMayHave(blk, q.key)) &&
+                    (!q.ranged || lbMayOverlap(blk, q.from, q.to))))) {
+    n = indexed ? min((uint32_t)LOG_BLOCK, jrnIdxRecs[slot] - at) : LOG_BLOCK;
+    File f = LittleFS.open(journalPath(seq), "r");
+    if (f && f.seek(at * sizeof(JournalRec)))
+      n = f.read((uint8_t*)out, n * sizeof(JournalRec)) / sizeof(JournalRec);
+    else
+      n = 0;
+    if (f) f.close();
+    for (int i = 0; i < n; i++) {
+      JournalRec& r = out[i];
+      if (r.crc != crc32(&r, offsetof(JournalRec, crc))) { r.user = JREC_BOOT; continue; }
+      if (r.user != JREC_BOOT && r.user != JREC_TIME) journalEpoch(r, r.ts);
+    }
   }
-  msg += "]}";
-  ws.broadcastTXT(msg);
+  jrnUnlock();
+  return n;
 }
 
-String buildLogsJson() {
-  String l = "{\"type\":\"logs\",\"count\":" + String(logCount) + ",\"logs\":[";
-  for (int i = 0; i < logCount; i++) {
-    if (i) l += ",";
-    l += "{\"name\":\"" + jsonEsc(logs[i].name)
-      + "\",\"uid\":\""  + String(logs[i].uid)
-      + "\",\"time\":\"" + formatUptime(logs[i].ts) + "\"}";
+// Segmen JREC_FMT <= 1 (16 byte/record, key 32-bit) → format sekarang.
+// Dikenali dari CRC record pertama, jadi aman diulang kalau mati
+// listrik di tengah (segmen yang sudah dikonversi lolos CRC baru).
+// Mati listrik di antara remove & rename → .tmp dipakai saat boot
+// berikutnya (fsSettleTmp di journalRecover).
+void journalMigrate(uint32_t seq) {
+  String path = journalPath(seq);
+  File src = LittleFS.open(path, "r");
+  if (!src) return;
+  JournalRecV1 o;
+  JournalRec   r;
+  bool old = src.read((uint8_t*)&o, sizeof(o)) == sizeof(o) &&
+             o.crc == crc32(&o, offsetof(JournalRecV1, crc));
+  if (old && src.seek(0) && src.read((uint8_t*)&r, sizeof(r)) == sizeof(r) &&
+      r.crc == crc32(&r, offsetof(JournalRec, crc))) old = false;
+  if (!old) { src.close(); return; }
+
+  String tmp = path + ".tmp";
+  File dst = LittleFS.open(tmp, "w");
+  bool ok = (bool)dst;
+  uint32_t n = 0;
+  src.seek(0);
+  while (ok && src.read((uint8_t*)&o, sizeof(o)) == sizeof(o)) {
+    if (o.crc != crc32(&o, offsetof(JournalRecV1, crc))) continue;
+    if (o.user == JREC_BOOT || o.user == JREC_TIME) {
+      r.key = uidKeyRaw(o.key);
+    } else {
+      byte uid[4] = { (byte)(o.key >> 24), (byte)(o.key >> 16), (byte)(o.key >> 8), (byte)o.key };
+      r.key = uidKeyOf(uid, sizeof(uid));
+    }
+    r.user = o.user; r.boot = o.boot; r.ts = o.ts;
+    r.crc  = crc32(&r, offsetof(JournalRec, crc));
+    ok = dst.write((const uint8_t*)&r, sizeof(r)) == sizeof(r);
+    n++;
+  }
+  src.close();
+  if (dst) dst.close();
+  if (!ok) {                             // flash penuh: segmen lama dibiarkan, coba lagi boot berikutnya
+    LittleFS.remove(tmp);
+    Serial.printf("[LOG] Migrasi segmen %lu gagal\n", (unsigned long)seq);
+    return;
   }
-  l += "]}";
-  return l;
+  LittleFS.remove(path);
+  LittleFS.rename(tmp, path);
+  LittleFS.remove(journalIdxPath(seq));
+  Serial.printf("[LOG] Segmen %lu dimigrasi ke format %d (%lu record)\n",
+                (unsigned long)seq, JREC_FMT, (unsigned long)n);
+}
+
+// Ekor rusak dibuang: prefix valid disalin ke .tmp, salinan dibaca
+// ulang (ukuran + crc isi) sebelum file asli dihapus. Mati listrik di
+// antara remove & rename → fsSettleTmp memakai .tmp saat boot berikutnya;
+// sebelum remove → .tmp dibuang, file asli utuh. false = salinan gagal
+// (flash penuh), file asli tidak disentuh.
+bool journalCutTail(uint32_t seq, uint32_t valid) {
+  String path = journalPath(seq), tmp = path + ".tmp";
+  File src = LittleFS.open(path, "r"), dst = LittleFS.open(tmp, "w");
+  bool ok = src && dst;
+  JournalRec b[16];
+  uint32_t crc = 0;
+  for (uint32_t i = 0; ok && i < valid; ) {
+    uint32_t n = valid - i < 16 ? valid - i : 16;
+    size_t len = n * sizeof(JournalRec);
+    ok = src.read((uint8_t*)b, len) == len && dst.write((const uint8_t*)b, len) == len;
+    crc = crc32(b, len, crc);
+    i += n;
+  }
+  if (src) src.close();
+  if (dst) dst.close();
+  if (ok) {
+    File chk = LittleFS.open(tmp, "r");
+    ok = chk && chk.size() == valid * sizeof(JournalRec);
+    uint32_t c = 0;
+    for (size_t k; ok && (k = chk.read((uint8_t*)b, sizeof(b))) > 0; ) c = crc32(b, k, c);
+    if (chk) chk.close();
+    ok = ok && c == crc;
+  }
+  if (!ok) { LittleFS.remove(tmp); return false; }
+  LittleFS.remove(path);
+  return LittleFS.rename(tmp, path);
+}
+
+// Cek segmen aktif: record valid = prefix dengan CRC benar.
+// Ekor yang rusak dibuang (journalCutTail). Tidak ada ruang untuk
+// salinan → segmen dibuka "r+" di akhir prefix, ekor ditimpa tap baru.
+void journalRecover() {
+  unsigned long t0 = millis();
+  if (!LittleFS.exists(JOURNAL_DIR)) LittleFS.mkdir(JOURNAL_DIR);
+
+  uint32_t lo = 0, hi = 0;
+  File dir = LittleFS.open(JOURNAL_DIR);
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    const char* nm = strrchr(f.name(), '/');
+    nm = nm ? nm+1 : f.name();
+    char* end;
+    uint32_t seq = strtoul(nm, &end, 10);
+    if (!seq || (strcmp(end, ".bin") && strcmp(end, ".bin.tmp"))) continue;   // bukan .idx
+    if (!lo || seq < lo) lo = seq;
+    if (seq > hi) hi = seq;
+  }
+  dir.close();
+  if (hi) { jrnFirstSeq = lo; jrnSeq = hi; }
+  for (uint32_t s = lo; hi && s <= hi; s++) fsSettleTmp(journalPath(s));   // migrasi / potong ekor terputus
+  for (uint32_t s = jrnFirstSeq; s <= jrnSeq; s++) journalMigrate(s);
+  for (uint32_t s = jrnFirstSeq; s < jrnSeq; s++) journalIdxLoad(s);   // tabel boot dari yang tertua
+  histCatchUp();
+  journalIdxClear(jrnSeq);
+
+  uint32_t valid = 0, total = 0;
+  JournalRec r, last; bool haveLast = false;
+  memset(&last, 0, sizeof(last));
+  File f = LittleFS.open(journalPath(jrnSeq), "r");
+  if (f) {
+    total = f.size() / sizeof(JournalRec);
+    while (f.read((uint8_t*)&r, sizeof(r)) == sizeof(r) &&
+           r.crc == crc32(&r, offsetof(JournalRec, crc))) {
+      journalIndex(jrnSeq, valid, r);
+      last = r; haveLast = true; valid++;
+    }
+    bool torn = valid < total || f.size() % sizeof(JournalRec);
+    f.close();
+
+    if (torn && journalCutTail(jrnSeq, valid)) {
+      Serial.printf("[LOG] Segmen %lu: %lu record rusak dibuang\n",
+                    (unsigned long)jrnSeq, (unsigned long)(total - valid));
+    } else if (torn) {
+      jrnFile = LittleFS.open(journalPath(jrnSeq), "r+");
+      if (jrnFile && !jrnFile.seek(valid * sizeof(JournalRec))) jrnFile.close();
+      Serial.printf("[LOG] Segmen %lu: salinan gagal, ekor ditimpa di tempat\n", (unsigned long)jrnSeq);
+    }
+  }
+  jrnSegRecs = valid;
+  jrnBootPos = jrnSeq * JOURNAL_SEG_RECS + valid;
+  // Segmen aktif kosong / robek seluruhnya: nomor boot tetap dari
+  // tabel boot segmen tertutup, jangan mulai lagi dari 0
+  uint16_t newest = 0;
+  bootNo = haveLast ? last.boot + 1 : 0;
+  if (jrnBoots.latest(newest) && (int16_t)(newest + 1 - bootNo) > 0) bootNo = newest + 1;
+
+  if (!jrnFile) journalOpenSeg();
+  journalAppend(uidKeyRaw(JREC_FMT), JREC_BOOT, nowTs());
+  journalFlush();                        // nomor boot terpakai walau mati sebelum tap pertama
+  Serial.printf("[LOG] Jurnal seg %lu..%lu, %lu record aktif, boot #%u, recover %lu ms\n",
+                (unsigned long)jrnFirstSeq, (unsigned long)jrnSeq, (unsigned long)valid,
+                bootNo, millis() - t0);
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   ARSIP — /hist/NNNNNNNN.col, riwayat jangka panjang
+//   Segmen jurnal yang sudah ditutup dikompak task net ke
+//   format kolom (hist_codec.h): ref kamus UID + selisih ts
+//   varint, per blok HIST_BLOCK tap — ±3 byte/tap vs 24
+//   byte di jurnal (tools/hist_bench.cpp). Penanda boot/jam
+//   tidak ikut: ts sudah di-resolve ke epoch saat diarsip,
+//   jadi tidak bergantung tabel boot lagi.
+//   Kamus UID /hist/keys.bin = tabel hash di flash (HistKeys,
+//   64 KB), tidak disalin ke RAM; penuh (MAX_USERS UID) →
+//   UID ditulis inline. Nama tidak disimpan — di-resolve saat
+//   ekspor CSV.
+//   Ditulis ke .tmp lalu di-rename: .col selalu utuh, boot
+//   membuang .tmp dan mengulang segmen itu.
+//   Total > HIST_MAX_KB → .col tertua dihapus.
+// └──────────────────────────────────────────────────────┘
+HistKeys<File, HIST_KEY_SLOTS> histKeys;      // task UI saat boot, sesudahnya task net
+HistEncoder<HIST_BLOCK> histEnc;
+uint8_t  histBuf[HistEncoder<HIST_BLOCK>::RAW_MAX];   // payload blok saat ekspor
+File     histIn, histOut;
+uint32_t histFirst = 0;                 // .col tertua (histDone di JURNAL)
+uint32_t histSeg   = 0;                 // segmen yang sedang diarsip (0 = tidak ada)
+bool     histOk    = false;             // baca/tulis segmen itu lancar sejauh ini
+uint32_t histFails = 0;                 // segmen gagal diarsip (dicoba ulang)
+unsigned long histFailAt = 0;
+uint32_t histBytes = 0;                 // total ukuran .col
+
+String histPath(uint32_t seq, const char* ext) {
+  char b[28]; snprintf(b, sizeof(b), "%s/%08lu%s", HIST_DIR, (unsigned long)seq, ext);
+  return String(b);
+}
+
+String histKeysPath() { return String(HIST_DIR) + "/keys.bin"; }
+
+// keys.bin dibuat sekali dengan ukuran tetap (slot kosong = 0). Ukuran
+// lain (pembuatan terputus) → dibuat ulang; belum ada blok yang merujuk.
+void histKeysLoad() {
+  String path = histKeysPath();
+  File f = LittleFS.open(path, "r");
+  size_t size = f ? f.size() : 0;
+  if (f) f.close();
+  if (size != histKeys.FILE_SIZE) {
+    uint8_t zero[256] = {};
+    f = LittleFS.open(path, "w");
+    for (size_t at = 0; f && at < histKeys.FILE_SIZE; at += sizeof(zero))
+      if (f.write(zero, sizeof(zero)) != sizeof(zero)) break;
+    if (f) f.close();
+    Serial.printf("[HIST] keys.bin dibuat (%u slot)\n", HIST_KEY_SLOTS);
+  }
+  histKeys.file() = LittleFS.open(path, "r+");
+  histKeys.load();
+}
+
+// Boot (task UI, sebelum netTask): rentang .col, kamus, sisa .tmp
+void histInit() {
+  if (!LittleFS.exists(HIST_DIR)) LittleFS.mkdir(HIST_DIR);
+  uint32_t stale = 0;
+  File dir = LittleFS.open(HIST_DIR);
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    const char* nm = strrchr(f.name(), '/');
+    nm = nm ? nm+1 : f.name();
+    uint32_t seq = strtoul(nm, nullptr, 10);
+    size_t len = strlen(nm);
+    if (!seq || len < 4) continue;
+    if (!strcmp(nm + len - 4, ".tmp")) { stale = seq; continue; }   // mati listrik saat mengarsip
+    if (strcmp(nm + len - 4, ".col")) continue;
+    if (!histFirst || seq < histFirst) histFirst = seq;
+    if (seq > histDone) histDone = seq;
+    histBytes += f.size();
+  }
+  dir.close();
+  if (stale) LittleFS.remove(histPath(stale, ".tmp"));
+  histKeysLoad();
+  Serial.printf("[HIST] Arsip %lu..%lu, %lu KB, kamus %u UID\n", (unsigned long)histFirst,
+                (unsigned long)histDone, (unsigned long)(histBytes / 1024), (unsigned)histKeys.count());
+}
+
+void histFlushBlock() {
+  if (!histEnc.taps()) return;
+  HistBlockHdr h;
+  const uint8_t* p = histEnc.pack(h);
+  histKeys.flush();                      // blok tidak pernah merujuk key yang belum tersimpan
+  if (histOut.write((const uint8_t*)&h, sizeof(h)) != sizeof(h) ||
+      histOut.write(p, h.len) != h.len) histOk = false;
+  histWrites++;
+}
+
+void histAdd(const UidKey& k, uint32_t ts) {
+  histEnc.add(histKeys.add(k) + 1, k, ts);   // -1 → ref 0, UID inline
+  if (histEnc.full()) histFlushBlock();
+}
+
+// Segmen yang tidak ada lagi di jurnal dianggap kosong (selesai)
+void histBegin(uint32_t seq) {
+  histSeg = seq;
+  histIn  = LittleFS.open(journalPath(seq), "r");
+  histOut = LittleFS.open(histPath(seq, ".tmp"), "w");
+  histOk  = histOut && (histIn || !LittleFS.exists(journalPath(seq)));
+}
+
+// Maks LOG_BLOCK record berikutnya dari segmen → arsip. Return jumlah
+// yang terbaca (0 = habis). Penanda & record rusak dilewati; ts
+// di-resolve seperti /api/logs (tetap detik sejak boot kalau tidak bisa).
+int histFeed() {
+  if (!histIn) return 0;
+  int n = histIn.read((uint8_t*)jrnReadBuf, sizeof(jrnReadBuf)) / sizeof(JournalRec);
+  jrnLock();
+  for (int i = 0; i < n; i++) {
+    JournalRec& r = jrnReadBuf[i];
+    if (r.crc != crc32(&r, offsetof(JournalRec, crc))) { r.user = JREC_BOOT; continue; }
+    if (r.user != JREC_BOOT && r.user != JREC_TIME) journalEpoch(r, r.ts);
+  }
+  jrnUnlock();
+  for (int i = 0; i < n; i++) {
+    const JournalRec& r = jrnReadBuf[i];
+    if (r.user != JREC_BOOT && r.user != JREC_TIME) histAdd(r.key, r.ts);
+  }
+  return n;
+}
+
+void histTrim() {
+  while (histBytes > HIST_MAX_KB * 1024UL && histFirst && histFirst < histDone) {
+    String p = histPath(histFirst, ".col");
+    File f = LittleFS.open(p, "r");
+    if (f) {
+      histBytes -= min((uint32_t)f.size(), histBytes);
+      f.close();
+      LittleFS.remove(p);
+    }
+    histFirst++;
+  }
+}
+
+// Segmen selesai: .tmp → .col. Segmen tanpa tap tidak punya .col.
+// histDone hanya maju kalau berhasil — sebelum itu segmen jurnalnya
+// tidak dihapus (journalRotate / histCatchUp). Return false = gagal.
+bool histEnd() {
+  histFlushBlock();
+  if (histIn) histIn.close();
+  size_t size = histOut ? histOut.size() : 0;
+  if (histOut) histOut.close();
+  String tmp = histPath(histSeg, ".tmp");
+  bool ok = histOk && (!size || LittleFS.rename(tmp, histPath(histSeg, ".col")));
+  if (ok && size) {
+    histBytes += size;
+    if (!histFirst) histFirst = histSeg;
+  } else {
+    LittleFS.remove(tmp);
+  }
+  histEnc.clear();
+  if (ok) {
+    histDone = histSeg;
+  } else {
+    histFails++;
+    histFailAt = millis();
+    Serial.printf("[HIST] Segmen %lu gagal diarsip, dicoba lagi\n", (unsigned long)histSeg);
+  }
+  histSeg = 0;
+  histTrim();
+  return ok;
+}
+
+// Task net: maju LOG_BLOCK record per putaran (1 KB baca flash),
+// mulai dari segmen tertutup tertua yang belum diarsip. Berhenti
+// selama ekspor CSV berjalan — jurnal menunggu seperti arsip macet.
+void histStep() {
+  if (csvExports) return;                // ekspor CSV membaca histDone / histFirst
+  if (!histSeg) {
+    if (histFails && millis() - histFailAt < HIST_RETRY_MS) return;
+    uint32_t first = jrnFirstSeq, s = max(histDone + 1, first);
+    if (s >= jrnSeq) return;              // segmen aktif belum ditutup
+    if (histDone && histDone + 1 < first)
+      Serial.printf("[HIST] Segmen %lu..%lu terhapus sebelum diarsip\n",
+                    (unsigned long)(histDone + 1), (unsigned long)(first - 1));
+    histBegin(s);
+  }
+  if (!histOk || !histFeed()) histEnd();
+}
+
+// Boot (dari journalRecover): segmen di luar jendela JOURNAL_SEGMENTS
+// (jurnal firmware lama / arsip tertinggal) diarsip dulu, baru dihapus.
+// Arsip gagal → berhenti; sisanya tetap di jurnal (dibaca tanpa
+// indeks) dan dicoba lagi oleh histStep(). Slot indeksnya tertimpa
+// segmen lain → indeks jendela dimuat ulang.
+void histCatchUp() {
+  if (jrnSeq - jrnFirstSeq + 1 <= JOURNAL_SEGMENTS) return;
+  while (jrnSeq - jrnFirstSeq + 1 > JOURNAL_SEGMENTS) {
+    if (jrnFirstSeq > histDone) {
+      histBegin(jrnFirstSeq);
+      while (histOk && histFeed()) {}
+      if (!histEnd()) break;
+    }
+    LittleFS.remove(journalPath(jrnFirstSeq));
+    LittleFS.remove(journalIdxPath(jrnFirstSeq));
+    jrnFirstSeq++;
+  }
+  for (uint32_t s = journalIdxFirst(); s < jrnSeq; s++) journalIdxLoad(s);
+}
+
+// Ekspor CSV: satu blok .col di offset at, mulai tap ke-tap. Blok di
+// luar from/to dilewati tanpa baca payload; payload yang masih ada di
+// histBuf (langkah sebelumnya) tidak dibaca ulang. true = .col habis.
+uint32_t histBufSeq = 0, histBufAt = 0;
+
+// Payload blok (header h di offset at, f tepat sesudah header) ke
+// histBuf — dipakai ekspor CSV dan /api/logs. false = blok rusak.
+bool histLoad(File& f, uint32_t seq, uint32_t at, const HistBlockHdr& h) {
+  if (histBufSeq == seq && histBufAt == at) return true;
+  histBufSeq = 0;
+  if (h.len > sizeof(histBuf) || f.read(histBuf, h.len) != h.len || !histCheck(h, histBuf)) {
+    Serial.printf("[HIST] Blok rusak di %lu.col\n", (unsigned long)seq);
+    return false;
+  }
+  histBufSeq = seq; histBufAt = at;
+  return true;
+}
+
+bool histExportBlock(uint32_t seq, uint32_t& at, uint32_t& tap, const LogQuery& q, uint32_t& no) {
+  File f = LittleFS.open(histPath(seq, ".col"), "r");
+  HistBlockHdr h;
+  if (!f || !f.seek(at) || f.read((uint8_t*)&h, sizeof(h)) != sizeof(h) || h.magic != HIST_MAGIC) return true;
+  if (!q.ranged || (h.tsMax >= q.from && h.tsMin <= q.to)) {
+    if (!histLoad(f, seq, at, h)) return true;
+    HistReader rd(h, histBuf);
+    uint32_t ref, ts;
+    UidKey   k;
+    for (uint32_t i = 0; rd.next(ref, k, ts); i++) {
+      if (i < tap) continue;
+      if (!httpFits(HTTP_ROW_MAX)) { tap = i; return false; }
+      if (ref && !histKeys.key(ref - 1, k)) continue;   // slot kamus rusak
+      if (logMatch(q, k, ts)) csvRow(++no, k, ts);
+    }
+  }
+  at += sizeof(h) + h.len;
+  tap = 0;
+  return false;
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   REKAP HARIAN — masuk pertama / keluar terakhir per user
+//   Milik task net: diperbarui dari attendQ (O(1) per tap),
+//   dibaca /api/summary. Hari = tanggal lokal (tzMinutes).
+//   Tap hari ini dari boot sebelumnya diambil sekali dari
+//   jurnal (lewat indeks) begitu tanggal diketahui.
+// └──────────────────────────────────────────────────────┘
+DaySummary<DAY_SLOTS> daySum;
+
+uint32_t localDay(uint32_t ts)  { return (ts + tzMinutes * 60L) / 86400UL; }
+uint32_t dayStart(uint32_t day) { return day * 86400UL - tzMinutes * 60L; }
+
+bool lateAt(uint32_t ts) {
+  return ts >= EPOCH_MIN && (ts + tzMinutes * 60L) % 86400UL > LATE_AFTER * 60UL;
+}
+
+void summaryTap(const UidKey& k, uint32_t ts) {
+  if (ts >= EPOCH_MIN && daySum.day()) {
+    uint32_t d = localDay(ts);
+    if (d < daySum.day()) return;            // tap kemarin yang masih antre
+    if (d > daySum.day()) daySum.clear(d);
+  }
+  DayAgg* a = daySum.tap(k, ts);
+  if (a) a->late = lateAt(a->first);
+}
+
+// Jam pertama kali sinkron: tap sebelum itu (detik sejak boot) → epoch
+void summaryRebase(uint32_t base) {
+  for (uint16_t s = 0; s < daySum.slots(); s++) {
+    DayAgg& a = daySum.at(s);
+    if (!a.count) continue;
+    if (a.first < EPOCH_MIN) a.first += base;
+    if (a.last  < EPOCH_MIN) a.last  += base;
+    a.late = lateAt(a.first);
+  }
+}
+
+// Tap hari ini dari boot-boot sebelumnya; boot ini sudah lewat attendQ
+void summaryRebuild(uint32_t day) {
+  LogQuery q = { dayStart(day), dayStart(day + 1) - 1, true, false, uidKeyRaw(0) };
+  uint32_t n = 0;
+  for (uint32_t seq = jrnFirstSeq; seq <= jrnSeq; seq++) {
+    for (int b = 0; b < JIDX_BLOCKS; b++) {
+      uint32_t base = seq * JOURNAL_SEG_RECS + b * LOG_BLOCK;
+      if (base >= jrnBootPos) break;
+      int got = journalReadBlock(seq, b, q, jrnReadBuf);
+      for (int i = 0; i < got && base + i < jrnBootPos; i++) {
+        const JournalRec& r = jrnReadBuf[i];
+        if (r.user == JREC_BOOT || r.user == JREC_TIME || r.ts < q.from || r.ts > q.to) continue;
+        summaryTap(r.key, r.ts);
+        n++;
+      }
+    }
+  }
+  Serial.printf("[REKAP] %lu tap hari ini dari jurnal, %u user\n", (unsigned long)n, daySum.used());
+}
+
+// Task net, tiap putaran: tanggal baru diketahui / ganti hari tanpa tap
+void summaryTick() {
+  if (!timeSynced()) return;
+  uint32_t today = localDay(nowTs());
+  if (daySum.day() == today) return;
+  if (!daySum.day()) { daySum.setDay(today); summaryRebuild(today); }
+  else if (today > daySum.day()) daySum.clear(today);
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   WEBSOCKET — antrean kirim per client, siaran JSON / biner
+// └──────────────────────────────────────────────────────┘
+// ── Format per client ─────────────────────────────────
+// Default JSON teks. Client yang kirim {"cmd":"fmt","bin":1} dapat
+// frame biner MessagePack dengan key yang sama (decoder di halaman.h).
+uint32_t wsClients    = 0;    // bitmask client terkoneksi
+uint32_t wsBinClients = 0;    // bitmask client yang minta biner
+
+bool wsWantsTxt(int num) {
+  return num >= 0 ? !((wsBinClients >> num) & 1) : (wsClients & ~wsBinClients) != 0;
+}
+bool wsWantsBin(int num) {
+  return num >= 0 ? ((wsBinClients >> num) & 1) : wsBinClients != 0;
+}
+
+// ── Statistik kirim — pesan & byte per menit (/api/stats/ws) ──
+WsStat        wsStatTotal  = {0, 0};
+WsStat        wsStatMinute = {0, 0};   // menit berjalan
+WsStat        wsStatLast   = {0, 0};   // menit penuh terakhir
+unsigned long wsStatRef    = 0;
+
+void wsCount(uint32_t clients, size_t len) {
+  uint32_t n = __builtin_popcount(clients);
+  wsStatMinute.msgs += n; wsStatMinute.bytes += n * len;
+  wsStatTotal.msgs  += n; wsStatTotal.bytes  += n * len;
+}
+
+void wsStatTick(unsigned long now) {
+  if (now - wsStatRef < 60000UL) return;
+  wsStatRef   += 60000UL;
+  wsStatLast   = wsStatMinute;
+  wsStatMinute = {0, 0};
+}
+
+// ── Antrean per client ────────────────────────────────
+// Semua kirim lewat antrean WsPeer; wsDrain() menulis ke socket hanya
+// kalau socket bisa ditulis tanpa menunggu, dalam jatah WS_DRAIN_US
+// per putaran task net. Satu client di sinyal lemah tidak menahan
+// yang lain: antrean penuh / macet WS_STALL_MS → diputus, dan saat
+// reconnect ia sync ulang (delta rev + getLogs) seperti biasa.
+// Snapshot users/logs & delta user tidak diantrekan sekaligus, tapi
+// dibuat per halaman oleh wsRefill() selama antrean masih muat.
+WsPeer   wsPeer[WEBSOCKETS_SERVER_CLIENT_MAX];
+uint32_t wsEvictions = 0;
+
+void wsPeerReset(uint8_t num) {
+  WsPeer& p = wsPeer[num];
+  p.q.clear();
+  p.stallRef = millis();
+  p.opRev = __atomic_load_n(&userRev, __ATOMIC_ACQUIRE);
+  p.want = p.snap = SNAP_NONE;
+  p.evict = false;
+}
+
+void wsEvict(uint8_t num) {
+  if (!wsPeer[num].evict) wsEvictions++;
+  wsPeer[num].evict = true;
+}
+
+// Antre ke client num (< 0 = semua) sesuai formatnya. Buffer untuk
+// format yang tidak diminta siapa pun boleh kosong. key != WSK_NONE
+// menggantikan frame key sama yang belum terkirim (status, metrics).
+void wsDeliver(int num, const char* txt, size_t tl, const uint8_t* bin, size_t bl, WsKey key) {
+  for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) {
+    if (num >= 0 ? c != num : !((wsClients >> c) & 1)) continue;
+    WsPeer& p = wsPeer[c];
+    if (p.evict) continue;
+    bool b = wsWantsBin(c);
+    if (!p.q.push(b ? bin : (const uint8_t*)txt, b ? bl : tl, b, key)) wsEvict(c);
+  }
+}
+
+// select() tanpa timeout: lwIP melaporkan writable kalau buffer kirim
+// TCP masih lega (≥ TCP_SNDLOWAT), cukup untuk satu frame ≤ WS_PAGE_SIZE
+bool wsWritable(uint8_t num) {
+  int fd = ws.fd(num);
+  if (fd < 0) return true;
+  fd_set w;
+  FD_ZERO(&w);
+  FD_SET(fd, &w);
+  timeval tv = { 0, 0 };
+  return select(fd + 1, nullptr, &w, nullptr, &tv) > 0;
+}
+
+// Task net: satu frame per client bergiliran sampai antrean habis,
+// tidak ada socket yang siap, atau jatah waktu habis
+void wsDrain(uint32_t budgetUs) {
+  uint32_t t0 = micros();
+  unsigned long now = millis();
+  bool sent = true;
+  while (sent && micros() - t0 < budgetUs) {
+    sent = false;
+    for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) {
+      if (!((wsClients >> c) & 1)) continue;
+      WsPeer& p = wsPeer[c];
+      if (p.evict) {
+        Serial.printf("[WS] Client #%d tertinggal (antrean %u B) - diputus\n", c, p.q.bytes());
+        ws.disconnect(c);
+        wsClients    &= ~(1UL << c);
+        wsBinClients &= ~(1UL << c);
+        continue;
+      }
+      wsRefill(c);
+      const uint8_t* d; uint16_t n; bool bin;
+      if (!p.q.front(d, n, bin)) { p.stallRef = now; continue; }
+      if (!wsWritable(c)) {
+        if (now - p.stallRef > WS_STALL_MS) wsEvict(c);
+        continue;
+      }
+      uint32_t t = micros();
+      if (bin) ws.sendBIN(c, d, n); else ws.sendTXT(c, d, n);
+      metric[M_WS_SEND].add(micros() - t);
+      wsCount(1, n);
+      p.q.pop();
+      p.stallRef = now;
+      sent = true;
+    }
+  }
+}
+
+// Status hanya dikirim saat berubah (statusDirty) atau client baru
+// connect. "up" = detik sejak boot (esp_timer, tidak ikut wrap millis()
+// 49 hari); uptime berjalan dihitung sendiri oleh browser.
+void writeStatus(JsonBuf& j, uint32_t up) {
+  j.raw("{\"type\":\"status\",\"up\":").unum(up)
+   .raw(",\"users\":").num(userDb.count()).raw(",\"max\":").num(MAX_USERS)
+   .raw(",\"logs\":").num(logRing.count()).ch('}');
+}
+
+void mpStatus(MpBuf& m, uint32_t up) {
+  m.map(5).key("type").str("status").key("up").uint(up)
+   .key("users").uint(userDb.count()).key("max").uint(MAX_USERS).key("logs").uint(logRing.count());
+}
+
+void wsSendStatus(int num) {
+  char    jb[128]; JsonBuf j(jb, sizeof(jb));
+  uint8_t mb[64];  MpBuf   m(mb, sizeof(mb));
+  uint32_t up = upSec();
+  if (wsWantsTxt(num)) writeStatus(j, up);
+  if (wsWantsBin(num)) mpStatus(m, up);
+  wsDeliver(num, jb, j.length(), mb, m.length(), WSK_STATUS);
+}
+
+void wsBroadcastStatus() { wsSendStatus(-1); }
+
+// Notifikasi singkat (toast) ke semua client
+void wsBroadcastToast(const char* msg) {
+  char    jb[96]; JsonBuf j(jb, sizeof(jb));
+  uint8_t mb[64]; MpBuf   m(mb, sizeof(mb));
+  if (wsWantsTxt(-1))
+    j.raw("{\"type\":\"userchange\",\"msg\":").str(msg).ch('}');
+  if (wsWantsBin(-1))
+    m.map(2).key("type").str("userchange").key("msg").str(msg);
+  wsDeliver(-1, jb, j.length(), mb, m.length(), WSK_NONE);
+}
+
+void writeAttend(JsonBuf& j, const LogEntry& e) {
+  j.raw("{\"type\":\"attend\",\"name\":").str(e.name).raw(",\"uid\":").str(e.uid)
+   .raw(",\"ts\":").unum(e.ts).ch('}');
+}
+
+void mpAttend(MpBuf& m, const LogEntry& e) {
+  m.map(4).key("type").str("attend").key("name").str(e.name)
+   .key("uid").str(e.uid).key("ts").uint(e.ts);
+}
+
+void wsBroadcastAttend(const LogEntry& e) {
+  char    jb[160]; JsonBuf j(jb, sizeof(jb));
+  uint8_t mb[128]; MpBuf   m(mb, sizeof(mb));
+  if (wsWantsTxt(-1)) writeAttend(j, e);
+  if (wsWantsBin(-1)) mpAttend(m, e);
+  wsDeliver(-1, jb, j.length(), mb, m.length(), WSK_NONE);
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   STREAMING — output besar lewat buffer tetap, tanpa
+//   String raksasa. Memori puncak konstan berapapun jumlah
+//   user / log.
+//   WS   : array dipecah jadi beberapa pesan
+//          {"type":T,"count":N,"part":k,"more":bool,"<key>":[...]}
+//          part 0 = daftar baru, more:false = pesan terakhir
+//   HTTP : chunked, body dibuat per langkah oleh producer
+//          (HttpServer::stream) saat socket bisa ditulis
+// └──────────────────────────────────────────────────────┘
+#define WS_PAGE_SIZE  1024
+#define WS_PAGE_TAIL    20   // ruang untuk ],"more":false}
+#define WS_OP_MAX      192   // frame delta user terbesar (lihat wsSendOp)
+
+// Satu halaman dipakai bergantian oleh encoder JSON / MessagePack
+uint8_t wsPageMem[WS_PAGE_SIZE];
+uint8_t wsItemMem[128];
+JsonBuf wsPage((char*)wsPageMem, sizeof(wsPageMem));
+JsonBuf wsItem((char*)wsItemMem, sizeof(wsItemMem));
+MpBuf   mpPage(wsPageMem, sizeof(wsPageMem));
+MpBuf   mpItem(wsItemMem, sizeof(wsItemMem));
+int         wsPageNum, wsPagePart, wsPageItems, wsPageCount;
+long        wsPageRev;      // >= 0 → header bawa rev & epoch (snapshot user)
+bool        wsPageBin;
+size_t      mpMoreAt, mpArrAt;
+const char* wsPageType;
+const char* wsPageKey;
+
+void wsPageOpen() {
+  wsPageItems = 0;
+  if (wsPageBin) {
+    mpPage.clear();
+    mpPage.map(wsPageRev >= 0 ? 7 : 5).key("type").str(wsPageType).key("count").uint(wsPageCount);
+    if (wsPageRev >= 0) mpPage.key("rev").uint(wsPageRev).key("epoch").uint(bootNo);
+    mpPage.key("part").uint(wsPagePart).key("more");
+    mpMoreAt = mpPage.boolLater();
+    mpPage.key(wsPageKey);
+    mpArrAt = mpPage.arrLater();
+    return;
+  }
+  wsPage.clear();
+  wsPage.raw("{\"type\":\"").raw(wsPageType).raw("\",\"count\":").num(wsPageCount);
+  if (wsPageRev >= 0) wsPage.raw(",\"rev\":").num(wsPageRev).raw(",\"epoch\":").unum(bootNo);
+  wsPage.raw(",\"part\":").num(wsPagePart).raw(",\"").raw(wsPageKey).raw("\":[");
+}
+
+void wsPageSend(bool more) {
+  if (wsPageBin) {
+    mpPage.patchBool(mpMoreAt, more);
+    mpPage.patchArr(mpArrAt, wsPageItems);
+    wsDeliver(wsPageNum, nullptr, 0, mpPage.data(), mpPage.length(), WSK_NONE);
+  } else {
+    wsPage.raw("],\"more\":").raw(more ? "true" : "false").ch('}');
+    wsDeliver(wsPageNum, wsPage.data(), wsPage.length(), nullptr, 0, WSK_NONE);
+  }
+  wsPagePart++;
+}
+
+// Halaman ke-part untuk satu client (format sesuai pilihannya)
+void wsPageBegin(uint8_t num, const char* type, const char* key, int count, long rev, int part) {
+  wsPageNum = num; wsPageType = type; wsPageKey = key; wsPageCount = count;
+  wsPageRev = rev; wsPageBin = wsWantsBin(num);
+  wsPagePart = part;
+  wsPageOpen();
+}
+
+// Item di wsItem / mpItem masih muat? Halaman kosong selalu menerima satu item.
+bool wsPageFits() {
+  if (!wsPageItems) return true;
+  if (wsPageBin) return mpPage.room() >= mpItem.length();
+  return wsPage.room() >= wsItem.length() + 1 + WS_PAGE_TAIL;
+}
+
+// Pindahkan satu item dari wsItem / mpItem ke halaman
+void wsPageAdd() {
+  if (wsPageBin) {
+    mpPage.raw(mpItem.data(), mpItem.length());
+    mpItem.clear();
+  } else {
+    if (wsPageItems) wsPage.ch(',');
+    wsPage.raw(wsItem.data(), wsItem.length());
+    wsItem.clear();
+  }
+  wsPageItems++;
+}
+
+void wsPageEnd() { wsPageSend(false); }
+
+void writeUserItem(JsonBuf& o, const User& u) {
+  char uid[UID_STR]; uidFmt(uid, u.uid, u.uidLen);
+  o.raw("{\"name\":").str(u.name).raw(",\"uid\":\"").raw(uid).raw("\"}");
+}
+
+void mpUserItem(MpBuf& o, const User& u) {
+  char uid[UID_STR]; uidFmt(uid, u.uid, u.uidLen);
+  o.map(2).key("name").str(u.name).key("uid").str(uid);
+}
+
+// ts mentah — tanggal/jam diformat di browser
+void writeLogItem(JsonBuf& o, const LogEntry& e) {
+  o.raw("{\"name\":").str(e.name).raw(",\"uid\":").str(e.uid)
+   .raw(",\"ts\":").unum(e.ts).ch('}');
+}
+
+void mpLogItem(MpBuf& o, const LogEntry& e) {
+  o.map(3).key("name").str(e.name).key("uid").str(e.uid).key("ts").uint(e.ts);
+}
+
+// Snapshot diminta client → dibuat per halaman oleh wsRefill()
+void wsSendUsers(uint8_t num) { wsPeer[num].want |= SNAP_USERS; }
+void wsSendLogs(uint8_t num)  { wsPeer[num].want |= SNAP_LOGS; }
+
+// Users: rev & epoch ikut di header supaya client bisa lanjut dengan
+// delta. Logs: hanya entri ring sampai saat mulai; tap sesudahnya
+// sampai lewat "attend".
+void wsSnapStart(uint8_t num, uint8_t kind) {
+  WsPeer& p = wsPeer[num];
+  p.snap = kind;
+  p.snapPart = 0;
+  if (kind == SNAP_USERS) {
+    p.snapRev   = __atomic_load_n(&userRev, __ATOMIC_ACQUIRE);
+    p.snapNext  = 0;
+    p.snapCount = userDb.count();
+  } else {
+    p.snapNext  = logRing.oldestSeq();
+    p.snapEnd   = logRing.seq();
+    p.snapCount = logRing.count();
+  }
+}
+
+// Satu halaman snapshot ke antrean client num; kursor di WsPeer.
+// Nama user dibaca berurutan dari users.bin. Task UI bisa mengubah
+// daftar di tengah jalan → kirim ulang kalau rev berubah (part 0
+// membuat client membuang snapshot sebelumnya).
+void wsSnapStep(uint8_t num) {
+  WsPeer& p = wsPeer[num];
+  bool users = p.snap == SNAP_USERS;
+  wsPageBegin(num, users ? "users" : "logs", users ? "users" : "logs", p.snapCount,
+              users ? (long)p.snapRev : -1, p.snapPart);
+  while (users ? p.snapNext < p.snapCount : (int32_t)(p.snapEnd - p.snapNext) > 0) {
+    if (users) {
+      User u;
+      userDb.read(p.snapNext, u);
+      if (wsPageBin) mpUserItem(mpItem, u); else writeUserItem(wsItem, u);
+    } else {
+      uint32_t oldest = logRing.oldestSeq();
+      if (p.snapNext - oldest >= (uint32_t)logRing.count()) { p.snapNext = oldest; continue; }   // sudah tertimpa
+      const LogEntry& e = logRing.at(p.snapNext - oldest);
+      if (wsPageBin) mpLogItem(mpItem, e); else writeLogItem(wsItem, e);
+    }
+    if (!wsPageFits()) {          // item dibuat ulang di halaman berikutnya
+      mpItem.clear(); wsItem.clear();
+      wsPageSend(true);
+      p.snapPart++;
+      return;
+    }
+    wsPageAdd();
+    p.snapNext++;
+  }
+  wsPageEnd();
+  if (users && __atomic_load_n(&userRev, __ATOMIC_ACQUIRE) != p.snapRev && ++p.snapTries < 3) {
+    wsSnapStart(num, SNAP_USERS);
+    return;
+  }
+  if (users) p.opRev = p.snapRev;  // delta sesudah snapshot menyusul
+  p.snap = SNAP_NONE;
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   DELTA USER — protokol WS berversi
+//   Tiap add/rename/remove menaikkan userRev dan disiarkan
+//   sebagai {"type":"delta","epoch":E,"rev":R,"op":..}
+//     add : +name,uid  → client push
+//     ren : +idx,name  → client ganti nama
+//     del : +idx       → client swap-remove (sama dgn server)
+//   Client reconnect kirim {"cmd":"sync","epoch":E,"rev":R}:
+//   op yang hilang dikirim ulang dari ring USER_OPS, atau
+//   snapshot kalau terlalu jauh / epoch (nomor boot) beda.
+// └──────────────────────────────────────────────────────┘
+UserOp   userOps[USER_OPS];
+
+void wsSendOp(int num, const UserOp& o) {
+  static const char* OP_NAMES[] = { "add", "ren", "del" };
+  char uid[UID_STR]; uidFmt(uid, o.uid, o.uidLen);
+  char    jb[192]; JsonBuf j(jb, sizeof(jb));
+  uint8_t mb[128]; MpBuf   m(mb, sizeof(mb));
+  if (wsWantsTxt(num)) {
+    j.raw("{\"type\":\"delta\",\"epoch\":").unum(bootNo).raw(",\"rev\":").unum(o.rev)
+     .raw(",\"op\":\"").raw(OP_NAMES[o.op]).ch('"');
+    if (o.op != OP_ADD)    j.raw(",\"idx\":").unum(o.idx);
+    if (o.op != OP_REMOVE) j.raw(",\"name\":").str(o.name);
+    if (o.op == OP_ADD)    j.raw(",\"uid\":\"").raw(uid).ch('"');
+    j.ch('}');
+  }
+  if (wsWantsBin(num)) {
+    m.map(o.op == OP_REMOVE ? 5 : 6).key("type").str("delta").key("epoch").uint(bootNo)
+     .key("rev").uint(o.rev).key("op").str(OP_NAMES[o.op]);
+    if (o.op != OP_ADD)    m.key("idx").uint(o.idx);
+    if (o.op != OP_REMOVE) m.key("name").str(o.name);
+    if (o.op == OP_ADD)    m.key("uid").str(uid);
+  }
+  wsDeliver(num, jb, j.length(), mb, m.length(), WSK_NONE);
+}
+
+// Dipanggil task UI: op ditulis dulu, baru userRev dinaikkan (release).
+// Diantrekan per client oleh wsRefill() di task net.
+void opPush(UserOpType op, int idx, const User& u) {
+  uint32_t rev = userRev + 1;
+  UserOp& o = userOps[rev % USER_OPS];
+  o.rev = rev; o.op = op; o.idx = idx;
+  memcpy(o.uid, u.uid, UID_MAX);
+  o.uidLen = u.uidLen;
+  memcpy(o.name, u.name, NAME_SIZE);
+  o.st.ver = u.ver; o.st.origin = u.origin;
+  __atomic_store_n(&userRev, rev, __ATOMIC_RELEASE);
+}
+
+// Task net, per client sebelum kirim: halaman snapshot (hanya kalau
+// satu halaman penuh muat di antrean), lalu delta user yang belum
+// diantrekan. Delta ditahan selama snapshot users belum selesai.
+void wsRefill(uint8_t num) {
+  WsPeer& p = wsPeer[num];
+  while (p.snap || p.want) {
+    if (!p.snap) {
+      uint8_t kind = (p.want & SNAP_USERS) ? SNAP_USERS : SNAP_LOGS;
+      p.want &= ~kind;
+      p.snapTries = 0;
+      wsSnapStart(num, kind);
+    }
+    if (!p.q.fits(WS_PAGE_SIZE)) return;
+    wsSnapStep(num);
+  }
+  uint32_t rev = __atomic_load_n(&userRev, __ATOMIC_ACQUIRE);
+  // Tertinggal lebih dari ring: op lama sudah tertimpa, client akan
+  // melihat celah rev dan minta sync sendiri
+  if (rev - p.opRev > USER_OPS) p.opRev = rev - USER_OPS;
+  while (p.opRev != rev && p.q.fits(WS_OP_MAX)) {
+    p.opRev++;
+    wsSendOp(num, userOps[p.opRev % USER_OPS]);
+  }
+}
+
+void wsSyncUsers(uint8_t num, long epoch, long rev) {
+  bool canDelta = epoch == bootNo && rev >= 0 && (uint32_t)rev <= userRev &&
+                  userRev - (uint32_t)rev < USER_OPS;
+  if (!canDelta) { wsSendUsers(num); return; }
+  wsPeer[num].opRev = rev;       // op sesudahnya menyusul lewat wsRefill()
+}
+
+char httpBuf[1024];
+void httpSink(const char* d, size_t n) { server.sendContent(d, n); }
+JsonBuf httpOut(httpBuf, sizeof(httpBuf), httpSink);
+
+// Body panjang dibuat per langkah oleh producer (HttpServer::stream):
+// tiap langkah menulis ke httpOut selama httpFits() lalu ditutup
+// httpStep() — satu langkah ≈ satu chunk ≤ httpBuf, state di cursor
+// koneksi, jadi client lambat tidak menahan task net.
+bool httpFits(size_t n) { return httpOut.length() + n <= sizeof(httpBuf); }
+
+bool httpStep(bool more) {
+  httpOut.flush();
+  return more;
+}
+
+// Body kecil dari JsonBuf tanpa sink: dikirim sepanjang length(), bukan
+// sampai '\0'. Buffer kurang = bug ukuran, jangan kirim JSON terpotong.
+void sendJson(const JsonBuf& j) {
+  if (j.overflowed()) { server.send(500, "application/json", "{\"ok\":false}"); return; }
+  server.send(200, "application/json", j.data(), j.length());
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   REPLIKASI USER — beberapa unit satu lokasi (user_repl.h)
+//   Aktif kalau SITE_SSID diisi: unit ikut WiFi lokasi (AP
+//   dashboard tetap jalan, channel-nya mengikuti router) dan
+//   bertukar perubahan user lewat UDP broadcast REPL_PORT.
+//   Log perubahan = ring userOps (seq = userRev), jadi yang
+//   dikirim hanya delta; unit baru / tertinggal lebih dari
+//   USER_OPS dapat snapshot users.bin + tombstone.
+//   net: ReplNode (terima, kirim, PULL ulang) di netTask()
+//   UI : replApplyIn() — cap LWW dibandingkan, yang menang
+//        ditulis lewat insertUser / renameUserAt / removeUserAt
+//        (jadi ikut delta WS & dikirim ulang ke unit lain)
+//   Paket ditandatangani HMAC dengan SITE_KEY; cap yang melompat
+//   lebih dari REPL_VER_JUMP di depan replClock ditolak.
+//   Tombstone tergusur (> REPL_TOMBS hapus) → floor; record hidup
+//   di bawahnya tidak menghidupkan user lagi, pengirimnya diminta
+//   rekonsiliasi (STALE → snapshot ber-penanda → replMarker()).
+// └──────────────────────────────────────────────────────┘
+WiFiUDP  replUdp;
+ReplNode repl;
+bool     replOn = false;
+volatile uint32_t replStaleTo = 0;      // UI → net: unit yang dikirimi STALE (0 = tidak ada)
+
+// 4 byte MAC terakhir (2 byte pertama = OUI Espressif, sama di semua unit)
+uint32_t replUnitId() {
+  uint32_t id = (uint32_t)(ESP.getEfuseMac() >> 16);
+  return id ? id : 1;            // 0 = slot peer kosong
+}
+
+// Task UI — jam Lamport naik tiap perubahan lokal
+ReplStamp replStampNew() {
+  ReplStamp st = { ++replClock, unitId };
+  return st;
+}
+
+// ── Tombstone (/tombs.bin) ────────────────────────────
+// Ditulis utuh tiap berubah (≤ REPL_TOMBS × 20 byte; hapus jarang)
+void tombsSave() {
+  File f = LittleFS.open(TOMBS_DB, "w");
+  if (!f) return;
+  dbLock();
+  TombsHeader h = { TOMBS_MAGIC, tombs.count(), 0, tombs.floor() };
+  h.crc = crc32(tombs.data(), h.count * sizeof(ReplTomb), crc32(&h.floor, sizeof(h.floor)));
+  f.write((const uint8_t*)&h, sizeof(h));
+  f.write((const uint8_t*)tombs.data(), h.count * sizeof(ReplTomb));
+  dbUnlock();
+  f.close();
+}
+
+void tombsLoad() {
+  File f = LittleFS.open(TOMBS_DB, "r");
+  if (!f) return;
+  TombsHeader h;
+  memset(&h, 0, sizeof(h));
+  const size_t v1 = offsetof(TombsHeader, floor);
+  bool ok = f.read((uint8_t*)&h, v1) == v1 &&
+            (h.magic == TOMBS_MAGIC_V1 ||
+             (h.magic == TOMBS_MAGIC && f.read((uint8_t*)&h.floor, sizeof(h.floor)) == sizeof(h.floor))) &&
+            h.count <= REPL_TOMBS &&
+            f.read((uint8_t*)tombs.data(), h.count * sizeof(ReplTomb)) == h.count * sizeof(ReplTomb) &&
+            h.crc == crc32(tombs.data(), h.count * sizeof(ReplTomb),
+                           h.magic == TOMBS_MAGIC ? crc32(&h.floor, sizeof(h.floor)) : 0);
+  f.close();
+  if (!ok) memset(&h, 0, sizeof(h));
+  tombs.setCount(h.count);
+  tombs.setFloor(h.floor);
+  if (h.floor.ver > replClock) replClock = h.floor.ver;
+  for (uint16_t i = 0; i < tombs.count(); i++)
+    if (tombs.at(i).st.ver > replClock) replClock = tombs.at(i).st.ver;
+  if (!ok) Serial.println("[FS] tombs.bin rusak, tombstone dikosongkan");
+}
+
+void tombPut(const UidKey& k, const ReplStamp& st) {
+  dbLock(); tombs.put(k, st); dbUnlock();
+  tombsSave();
+}
+
+void tombDrop(const UidKey& k) {
+  if (tombs.find(k) < 0) return;   // pembaca lain hanya task net → aman tanpa kunci
+  dbLock(); tombs.erase(k); dbUnlock();
+  tombsSave();
+}
+
+// ── ReplIo: dipanggil ReplNode di task net ────────────
+void replSend(uint32_t ip, uint16_t port, const uint8_t* d, size_t n) {
+  replUdp.beginPacket(ip ? IPAddress(ip) : WiFi.broadcastIP(), port);
+  replUdp.write(d, n);
+  replUdp.endPacket();
+}
+
+uint32_t replSeq() { return __atomic_load_n(&userRev, __ATOMIC_ACQUIRE); }
+
+// Slot seq+USER_OPS bisa sedang ditulis task UI → sisakan 1 slot
+bool replChange(uint32_t seq, ReplRec& r) {
+  if (replSeq() - seq >= USER_OPS - 1) return false;
+  UserOp o = userOps[seq % USER_OPS];
+  if (o.rev != seq || replSeq() - seq >= USER_OPS - 1) return false;
+  memset(&r, 0, sizeof(r));
+  memcpy(r.uid, o.uid, UID_MAX);
+  r.uidLen  = o.uidLen;
+  r.deleted = o.op == OP_REMOVE;
+  memcpy(r.name, o.name, NAME_SIZE);
+  r.st = o.st;
+  return true;
+}
+
+// Snapshot: users.bin lalu tombstone. Record yang gagal dibaca
+// dikirim dengan uidLen 0 (dilewati penerima) supaya index jalan terus.
+bool replSnap(uint32_t i, ReplRec& r) {
+  memset(&r, 0, sizeof(r));
+  uint32_t n = userDb.count();
+  if (i < n) {
+    User u;
+    if (userDb.read(i, u)) {
+      memcpy(r.uid, u.uid, UID_MAX);
+      r.uidLen = u.uidLen;
+      memcpy(r.name, u.name, NAME_SIZE);
+      r.st.ver = u.ver; r.st.origin = u.origin;
+    }
+    return true;
+  }
+  dbLock();
+  bool ok = i - n < tombs.count();
+  if (ok) {
+    const ReplTomb& t = tombs.at(i - n);
+    r.uidLen  = uidKeyBytes(t.key, r.uid);
+    r.deleted = 1;
+    r.st      = t.st;
+  }
+  dbUnlock();
+  return ok;
+}
+
+// Semua atau tidak sama sekali — ReplNode mengulang paket yang ditolak
+bool replDeliver(uint32_t from, const ReplRec* r, uint8_t n) {
+  if (REPL_IN_QUEUE - replInQ.size() < n) return false;
+  for (uint8_t i = 0; i < n; i++) replInQ.push({ r[i], from });
+  return true;
+}
+
+const ReplIo REPL_IO = { replSend, replSeq, replChange, replSnap, replDeliver };
+
+// Setup, sesudah WiFi.begin() — epoch acak: seq (userRev) mulai 0 tiap boot
+void replStart() {
+  static_assert(REPL_IN_QUEUE >= REPL_MAX_RECS + 2, "replInQ harus muat satu paket + penanda");
+  if (!SITE_KEY[0]) {
+    Serial.println("[REPL] SITE_KEY kosong — replikasi tidak diaktifkan");
+    return;
+  }
+  replUdp.begin(REPL_PORT);
+  repl.begin(unitId, crc32(SITE_NAME, strlen(SITE_NAME)), esp_random() | 1, REPL_PORT, REPL_IO,
+             SITE_KEY, strlen(SITE_KEY));
+  replOn = true;
+  Serial.printf("[REPL] Unit %08lX, lokasi \"%s\", UDP %d\n", (unsigned long)unitId, SITE_NAME, REPL_PORT);
+}
+
+// Task net — beberapa datagram per putaran, lalu kirim yang perlu
+void replPoll(unsigned long now) {
+  if (!replOn || WiFi.status() != WL_CONNECTED) return;
+  static uint8_t buf[sizeof(ReplHdr) + REPL_MAX_RECS * sizeof(ReplRec) + REPL_TAG];
+  for (int k = 0; k < 8 && replUdp.parsePacket() > 0; k++) {
+    int n = replUdp.read(buf, sizeof(buf));
+    if (n > 0) repl.onPacket((uint32_t)replUdp.remoteIP(), replUdp.remotePort(), buf, n, now);
+  }
+  uint32_t to = __atomic_exchange_n(&replStaleTo, 0, __ATOMIC_ACQ_REL);
+  if (to) {
+    dbLock(); ReplStamp floor = tombs.floor(); dbUnlock();
+    repl.stale(to, floor, now);
+  }
+  repl.tick(now);
+}
+
+// Task UI: satu record dari unit lain, diterapkan kalau cap-nya lebih baru
+void replApply(ReplRec& r, uint32_t from) {
+  if (!replSane(r.st, replClock)) { replJumps++; return; }
+  if (r.st.ver > replClock) replClock = r.st.ver;
+  r.name[NAME_SIZE-1] = '\0';
+  UidKey k   = uidKeyOf(r.uid, r.uidLen);
+  int    idx = findKey(k);
+  if (idx >= 0) {
+    User u; userDb.read(idx, u);
+    ReplStamp cur = { u.ver, u.origin };
+    if (!replNewer(r.st, cur)) return;
+    if (!r.deleted) { renameUserAt(idx, r.name, r.st); return; }
+    if (currentMode == MODE_ADMIN_DEL_CONFIRM) { deleteTarget = -1; goTo(MODE_ADMIN_DELETE); }
+    removeUserAt(idx, r.st);
+    return;
+  }
+  int t = tombs.find(k);
+  if (t >= 0 && !replNewer(r.st, tombs.at(t).st)) return;
+  if (t < 0 && tombs.buried(r.st)) {         // tombstone-nya mungkin sudah tergusur
+    if (!r.deleted) { replBuried++; replStaleTo = from; }
+    return;
+  }
+  if (r.deleted) { tombPut(k, r.st); return; }
+  User u;
+  memset(&u, 0, sizeof(u));
+  memcpy(u.uid, r.uid, r.uidLen);
+  u.uidLen = r.uidLen;
+  memcpy(u.name, r.name, NAME_SIZE);
+  u.ver = r.st.ver; u.origin = r.st.origin;
+  insertUser(u);
+}
+
+// ── Rekonsiliasi (sesudah STALE ke unit ini) ──────────
+// BEGIN … snapshot penuh peer … END, st = floor peer. User yang tidak
+// ada di snapshot dengan cap ≤ floor sudah dihapus di peer (tombstone-
+// nya tergusur) → dihapus di sini dengan cap baru, ikut tersebar.
+// Jam dinaikkan ke floor saat BEGIN: user yang ditambah selama sweep
+// selalu lebih baru dari floor.
+void replMarker(const ReplRec& r) {
+  if (!replSane(r.st, replClock)) { replJumps++; replSweep = false; return; }
+  if (r.st.ver > replClock) replClock = r.st.ver;
+  if (r.deleted == REPL_MARK_BEGIN) {
+    memset(replSeen, 0, sizeof(replSeen));
+    replSweep = true;
+    return;
+  }
+  if (r.deleted != REPL_MARK_END || !replSweep) return;
+  replSweep = false;
+  uint32_t n = 0;
+  for (int i = userDb.count() - 1; i >= 0; i--) {
+    User u;
+    if (replSeen[i >> 3] & (1 << (i & 7)) || !userDb.read(i, u)) continue;
+    ReplStamp st = { u.ver, u.origin };
+    if (replNewer(st, r.st)) continue;
+    if (currentMode == MODE_ADMIN_DEL_CONFIRM) { deleteTarget = -1; goTo(MODE_ADMIN_DELETE); }
+    removeUserAt(i, replStampNew());
+    n++;
+  }
+  replSwept += n;
+  Serial.printf("[REPL] Rekonsiliasi: %lu user di bawah floor %lu dihapus\n", (unsigned long)n,
+                (unsigned long)r.st.ver);
+}
+
+// Swap-remove memindah user terakhir ke idx: tanda "ada di snapshot" ikut
+void replSeenMove(int idx, int last) {
+  bool seen = replSeen[last >> 3] & (1 << (last & 7));
+  replSeen[last >> 3] &= ~(1 << (last & 7));
+  if (seen) replSeen[idx >> 3] |= 1 << (idx & 7);
+  else      replSeen[idx >> 3] &= ~(1 << (idx & 7));
+}
+
+void replApplyIn() {
+  ReplIn in;
+  while (replInQ.pop(in)) {
+    ReplRec& r = in.r;
+    if (!r.uidLen) { if (r.deleted) replMarker(r); continue; }
+    if (r.uidLen > UID_MAX) continue;
+    replApply(r, in.from);
+    if (!replSweep) continue;
+    int idx = findKey(uidKeyOf(r.uid, r.uidLen));
+    if (idx >= 0) replSeen[idx >> 3] |= 1 << (idx & 7);
+  }
+}
+
+// ≈ 400 byte kepala + ≤ 140 byte per peer
+void handleApiRepl() {
+  char b[512 + REPL_PEERS * 160]; JsonBuf j(b, sizeof(b));
+  const ReplStats& st = repl.stats();
+  unsigned long now = millis();
+  j.raw("{\"on\":").raw(replOn ? "true" : "false")
+   .raw(",\"unit\":").unum(unitId).raw(",\"site\":").str(SITE_NAME)
+   .raw(",\"epoch\":").unum(repl.epoch()).raw(",\"seq\":").unum(replSeq())
+   .raw(",\"clock\":").unum(replClock).raw(",\"tombs\":").unum(tombs.count())
+   .raw(",\"pushes\":").unum(st.pushes).raw(",\"pulls\":").unum(st.pulls)
+   .raw(",\"fulls\":").unum(st.fulls).raw(",\"records\":").unum(st.records)
+   .raw(",\"gaps\":").unum(st.gaps).raw(",\"busy\":").unum(st.busy)
+   .raw(",\"forged\":").unum(st.forged).raw(",\"jumps\":").unum(replJumps)
+   .raw(",\"floor\":").unum(tombs.floor().ver).raw(",\"buried\":").unum(replBuried)
+   .raw(",\"stales\":").unum(st.stales).raw(",\"swept\":").unum(replSwept)
+   .raw(",\"peers\":[");
+  bool first = true;
+  for (uint8_t i = 0; i < ReplNode::peerSlots(); i++) {
+    const ReplPeer& p = repl.peer(i);
+    if (!p.unit) continue;
+    if (!first) j.ch(',');
+    first = false;
+    j.raw("{\"unit\":").unum(p.unit).raw(",\"ip\":\"").raw(IPAddress(p.ip).toString().c_str())
+     .raw("\",\"epoch\":").unum(p.epoch).raw(",\"known\":").unum(p.known)
+     .raw(",\"adv\":").unum(p.adv).raw(",\"synced\":").raw(p.synced && p.epoch == p.advEpoch ? "true" : "false")
+     .raw(",\"ageMs\":").unum(now - p.heard).ch('}');
+  }
+  j.raw("]}");
+  sendJson(j);
 }
 
 // ┌──────────────────────────────────────────────────────┐
 //   DISPLAY HELPERS
 // └──────────────────────────────────────────────────────┘
+// Pengganti sendBuffer(): frame dibandingkan dengan yang terakhir
+// dikirim, hanya rentang tile berubah yang lewat I2C. Update bar
+// 50 ms cuma mengirim beberapa tile di page 6-7, bukan 1 KB.
+FrameDiff<16, 8> oledDiff;               // 128x64 = 16x8 tile
+uint32_t         oledBytes = 0;          // total byte tile terkirim
+
+void oledArea(uint8_t tx, uint8_t ty, uint8_t tw) { u8g2.updateDisplayArea(tx, ty, tw, 1); }
+
+void oledFlush() {
+  uint32_t t = micros();
+  oledBytes += oledDiff.flush(u8g2.getBufferPtr(), oledArea);
+  metric[M_OLED_FLUSH].add(micros() - t);
+}
+
 void drawHeader(const char* title) {
   u8g2.setDrawColor(1);
   u8g2.drawBox(0, 0, 128, 14);
@@ -369,10 +2282,22 @@ void drawCenter(const uint8_t* font, int y, const char* str) {
 }
 
 // ── Layar Attend ──────────────────────────────────────
-void displayAttend() {
-  unsigned long sec = millis()/1000;
-  char upBuf[10];  snprintf(upBuf,  sizeof(upBuf),  "%02lu:%02lu", (sec/60)%60, sec%60);
-  char cntBuf[14]; snprintf(cntBuf, sizeof(cntBuf), "%d/%d user", userCount, MAX_USERS);
+// Digambar ulang hanya kalau teks berubah; force = layar baru dimasuki
+void displayAttend(bool force) {
+  static char lastUp[10], lastCnt[20];
+  // Jam lokal HH:MM kalau sudah sinkron, selain itu uptime mm:ss
+  char upBuf[10];
+  if (timeSynced()) {
+    uint32_t loc = nowTs() + tzMinutes * 60L;
+    snprintf(upBuf, sizeof(upBuf), "%02lu:%02lu",
+             (unsigned long)(loc / 3600 % 24), (unsigned long)(loc / 60 % 60));
+  } else {
+    unsigned long sec = upSec();
+    snprintf(upBuf, sizeof(upBuf), "%02lu:%02lu", (sec/60)%60, sec%60);
+  }
+  char cntBuf[20]; snprintf(cntBuf, sizeof(cntBuf), "%d/%d user", userDb.count(), MAX_USERS);
+  if (!force && !strcmp(upBuf, lastUp) && !strcmp(cntBuf, lastCnt)) return;
+  strcpy(lastUp, upBuf); strcpy(lastCnt, cntBuf);
   u8g2.clearBuffer();
   drawHeader(" SISTEM ABSENSI ");
   u8g2.drawRFrame(3, 18, 26, 18, 2);
@@ -384,7 +2309,7 @@ void displayAttend() {
   u8g2.drawStr(3, 51, cntBuf);
   u8g2.drawStr(125 - u8g2.getStrWidth(upBuf), 51, upBuf);
   drawFooter("[<] hold=Admin", "");
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Absen OK ────────────────────────────────────
@@ -397,14 +2322,14 @@ void displayAttendOK(const char* name) {
   u8g2.drawStr(32, 32, name);
   drawCenter(u8g2_font_5x7_tf, 46, "Absen Tercatat!");
   u8g2.drawFrame(3, 52, 122, 6);
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 void updateAttendOKBar(unsigned long elapsed) {
   int w = (int)(122.0f * (float)elapsed / (float)RESULT_TIMEOUT);
   if (w > 122) w = 122;
   u8g2.drawBox(3, 52, w, 6);
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Absen Fail ──────────────────────────────────
@@ -414,9 +2339,13 @@ void displayAttendFail(const char* uidStr) {
   u8g2.drawLine(6, 26, 18, 38); u8g2.drawLine(7, 26, 19, 38);
   u8g2.drawLine(18, 26, 6, 38); u8g2.drawLine(19, 26, 7, 38);
   u8g2.setFont(u8g2_font_6x10_tf); u8g2.drawStr(26, 30, "Tdk terdaftar");
-  u8g2.setFont(u8g2_font_5x7_tf);  u8g2.drawStr(26, 42, uidStr);
+  if (strlen(uidStr) <= 20) {                            // s.d. UID 7 byte
+    u8g2.setFont(u8g2_font_5x7_tf);  u8g2.drawStr(26, 42, uidStr);
+  } else {
+    drawCenter(u8g2_font_4x6_tf, 45, uidStr);            // UID 10 byte: 116 px
+  }
   drawCenter(u8g2_font_5x7_tf, 54, "Hubungi admin");
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Admin Menu ──────────────────────────────────
@@ -442,7 +2371,7 @@ void displayAdminMenu() {
     }
   }
   drawFooter("[<] Scroll", "[>] Pilih");
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Scan Admin ──────────────────────────────────
@@ -457,7 +2386,7 @@ void displayAdminScan(const char* title) {
     else              u8g2.drawCircle(dx, 55, 2);
   }
   drawFooter("[<] Kembali", "");
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Konfirmasi Hapus ────────────────────────────
@@ -465,11 +2394,12 @@ void displayDeleteConfirm(int idx) {
   u8g2.clearBuffer();
   drawHeader(" KONFIRMASI HAPUS ");
   drawCenter(u8g2_font_6x10_tf, 27, "Hapus user ini?");
-  int nw = u8g2.getStrWidth(users[idx].name);
+  User u; userDb.read(idx, u);
+  int nw = u8g2.getStrWidth(u.name);
   u8g2.drawRFrame((128-nw-10)/2, 30, nw+10, 14, 2);
-  drawCenter(u8g2_font_7x13_tf, 41, users[idx].name);
+  drawCenter(u8g2_font_7x13_tf, 41, u.name);
   drawFooter("[<] Batal", "[>] HAPUS");
-  u8g2.sendBuffer();
+  oledFlush();
 }
 
 // ── Layar Result Admin ────────────────────────────────
@@ -483,21 +2413,141 @@ void displayResult(bool ok, const char* l1, const char* l2="", const char* l3=""
     u8g2.drawLine(5, 26, 17, 38); u8g2.drawLine(6, 26, 18, 38);
     u8g2.drawLine(17, 26, 5, 38); u8g2.drawLine(18, 26, 6, 38);
   }
-  u8g2.setFont(u8g2_font_6x10_tf);
-  u8g2.drawStr(30, 28, l1);
-  if (strlen(l2)) u8g2.drawStr(30, 40, l2);
-  if (strlen(l3)) { u8g2.setFont(u8g2_font_5x7_tf); u8g2.drawStr(30, 52, l3); }
-  u8g2.sendBuffer();
+  u8g2.setFont(u8g2_font_6x10_tf);
+  u8g2.drawStr(30, 28, l1);
+  if (strlen(l2)) u8g2.drawStr(30, 40, l2);
+  if (strlen(l3)) { u8g2.setFont(u8g2_font_5x7_tf); u8g2.drawStr(30, 52, l3); }
+  oledFlush();
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   SPLASH — 100 frame dari tabel SPLASH (splash_frames.h)
+//   Dimajukan animFrame() tiap 33 ms seperti animasi lain;
+//   sesudah frame terakhir: kilat invert → layar kosong →
+//   MODE_ATTEND. Tap kartu / tombol memotong splash.
+// └──────────────────────────────────────────────────────┘
+bool splashBeeped = false;
+
+void drawSplashCard(int cx, int cy, float scale) {
+  int w = (int)(40*scale), h = (int)(26*scale);
+  int x0 = cx - w/2, y0 = cy - h/2;
+  int r = (int)(3*scale); if (r < 1) r = 1;
+  u8g2.drawRFrame(x0, y0, w, h, r);
+  int chipX = x0 + (int)(8*scale), chipY = y0 + (int)(7*scale);
+  int chipW = (int)(11*scale); if (chipW < 3) chipW = 3;
+  int chipH = (int)(8*scale);  if (chipH < 2) chipH = 2;
+  u8g2.drawRFrame(chipX, chipY, chipW, chipH, 1);
+  if (scale > 0.4f) {
+    int lineY = y0 + (int)(13*scale);
+    u8g2.drawHLine(x0 + (int)(22*scale), lineY, (int)(14*scale));
+  }
+}
+
+void drawSplash(const SplashFrame& f) {
+  float scale = f.cardS / 100.0f;
+  u8g2.clearBuffer();
+  if (f.big) {
+    drawSplashCard(64, 31, scale);
+    for (int i = 0; i < f.rings; i++)
+      u8g2.drawCircle(44, 31, 10 + i*9, U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_LEFT);
+  } else {
+    if (f.lineY >= 0) u8g2.drawHLine(0, f.lineY, 128);
+    drawSplashCard(f.cardCX, f.cardCY, scale);
+    if (f.titleY > 0) drawCenter(u8g2_font_9x15_tf, f.titleY, "ABSENSI");
+    if (f.subY > 0)   drawCenter(u8g2_font_6x10_tf, f.subY, "ESP32  v2.0");
+    if (f.bar) {
+      u8g2.drawRFrame(4, 56, 120, 7, 2);
+      if (f.barW) u8g2.drawBox(5, 57, f.barW, 5);
+      if (f.dot && 5 + f.barW < 122) u8g2.drawDisc(5 + f.barW, 59, 2);
+    }
+    if (f.info) {
+      char info[30];
+      snprintf(info, sizeof(info), "%d user  |  %s", userDb.count(), AP_DOMAIN);
+      drawCenter(u8g2_font_4x6_tf, 53, info);
+    }
+  }
+  oledFlush();
+  if (f.bar && !splashBeeped) { beepBoot(); splashBeeped = true; }
+}
+
+void splashStep(unsigned long elapsed) {
+  unsigned long k = elapsed / SPLASH_FRAME_MS;
+  if (k < SPLASH_FRAMES) { drawSplash(SPLASH.f[k]); return; }
+  switch (k - SPLASH_FRAMES) {
+    case 0: case 1:                        // ~60 ms frame terakhir di-invert
+      drawSplash(SPLASH.f[SPLASH_FRAMES-1]);
+      u8g2.setDrawColor(2); u8g2.drawBox(0, 0, 128, 64); u8g2.setDrawColor(1);
+      oledFlush();
+      break;
+    case 2:                                // ~40 ms kosong
+      u8g2.clearBuffer(); oledFlush();
+      break;
+    default:
+      goTo(MODE_ATTEND);
+  }
 }
 
 // ┌──────────────────────────────────────────────────────┐
 //   STATE TRANSITION
 // └──────────────────────────────────────────────────────┘
-void goTo(AppMode mode) {
+// Batas waktu diam tiap layar (0 = tanpa batas)
+unsigned long modeTimeout(AppMode m) {
+  switch (m) {
+    case MODE_ATTEND_OK:
+    case MODE_ATTEND_FAIL:
+    case MODE_RESULT_OK:
+    case MODE_RESULT_FAIL:       return RESULT_TIMEOUT;
+    case MODE_ADMIN_MENU:
+    case MODE_ADMIN_REGISTER:
+    case MODE_ADMIN_DELETE:
+    case MODE_ADMIN_DEL_CONFIRM: return MENU_TIMEOUT;
+    default:                     return 0;
+  }
+}
+
+void modeExpired(void*) {
+  modeTmr = TIMER_NONE;
+  if (currentMode == MODE_RESULT_OK || currentMode == MODE_RESULT_FAIL) goTo(MODE_ADMIN_MENU);
+  else                                                                  goTo(MODE_ATTEND);
+}
+
+// Ada aktivitas → hitung ulang batas waktu layar
+void touchMode() {
+  sched.cancel(modeTmr);
+  unsigned long t = modeTimeout(currentMode);
+  modeTmr = t ? sched.after(t, modeExpired) : TIMER_NONE;
+}
+
+// Frame animasi layar yang sedang aktif
+void animFrame(void*) {
+  switch (currentMode) {
+    case MODE_SPLASH:         splashStep(millis() - modeStart); break;
+    case MODE_ATTEND:         displayAttend(false); break;
+    case MODE_ATTEND_OK:      updateAttendOKBar(millis() - modeStart); break;
+    case MODE_ADMIN_REGISTER: dotStep = (dotStep+1) % 3; displayAdminScan("   REGISTER   "); break;
+    case MODE_ADMIN_DELETE:   dotStep = (dotStep+1) % 3; displayAdminScan("  HAPUS KARTU  "); break;
+    default: break;
+  }
+}
+
+// Ganti mode tanpa menggambar layar (pemanggil yang menggambar)
+void setMode(AppMode mode) {
   currentMode = mode;
-  lastAction  = millis();
+  modeStart   = millis();
+  sched.cancel(animTmr);
+  unsigned long frame = mode == MODE_SPLASH    ? SPLASH_FRAME_MS :
+                        mode == MODE_ATTEND    ? 1000 :
+                        mode == MODE_ATTEND_OK ?   50 :
+                        (mode == MODE_ADMIN_REGISTER || mode == MODE_ADMIN_DELETE) ? 380 : 0;
+  animTmr = frame ? sched.every(frame, animFrame) : TIMER_NONE;
+  touchMode();
+}
+
+void goTo(AppMode mode) {
+  setMode(mode);
   switch (mode) {
-    case MODE_ATTEND:         displayAttend(); break;
+    case MODE_SPLASH:         splashBeeped = false; drawSplash(SPLASH.f[0]); break;
+    case MODE_ATTEND:         displayAttend(true); break;
     case MODE_ADMIN_MENU:     menuIndex=0; displayAdminMenu(); break;
     case MODE_ADMIN_REGISTER: displayAdminScan("   REGISTER   "); break;
     case MODE_ADMIN_DELETE:   displayAdminScan("  HAPUS KARTU  "); break;
@@ -545,35 +2595,35 @@ void onWsEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
     case WStype_CONNECTED:
       Serial.printf("[WS] Client #%d connected\n", num);
       {
-        // Kirim semua data awal ke client baru
-        String s = "{\"type\":\"status\",\"uptime\":\"" + formatUptime(millis())
-                 + "\",\"users\":" + String(userCount)
-                 + ",\"logs\":"    + String(logCount) + "}";
-        ws.sendTXT(num, s);
-
-        String u = "{\"type\":\"users\",\"count\":" + String(userCount) + ",\"users\":[";
-        for (int i = 0; i < userCount; i++) {
-          if (i) u += ",";
-          u += "{\"name\":\"" + jsonEsc(users[i].name)
-            + "\",\"uid\":\"" + uidToStr(users[i].uid, UID_SIZE) + "\"}";
-        }
-        u += "]}";
-        ws.sendTXT(num, u);
-        String logsJson = buildLogsJson();
-        ws.sendTXT(num, logsJson);
+        wsClients    |=  (1UL << num);
+        wsBinClients &= ~(1UL << num);
+        wsPeerReset(num);
+        // status langsung; format, daftar user ("sync") & log diminta client
+        wsSendStatus(num);
       }
       break;
 
     case WStype_TEXT:
       {
-        String msg = String((char*)payload);
-        if (msg.indexOf("getUsers") >= 0) wsBroadcastUsers();
-        if (msg.indexOf("getLogs")  >= 0) { String logsJson = buildLogsJson(); ws.sendTXT(num, logsJson); }
+        JsonDocument doc;
+        if (deserializeJson(doc, payload, length)) break;
+        const char* cmd = doc["cmd"] | "";
+        if (!strcmp(cmd, "fmt")) {
+          if (doc["bin"] | 0) wsBinClients |=  (1UL << num);
+          else                wsBinClients &= ~(1UL << num);
+        }
+        if (!strcmp(cmd, "time"))     timeSet(doc["epoch"] | 0UL, doc["tz"] | 0);
+        if (!strcmp(cmd, "sync"))     wsSyncUsers(num, doc["epoch"] | -1L, doc["rev"] | -1L);
+        if (!strcmp(cmd, "getUsers")) wsSendUsers(num);
+        if (!strcmp(cmd, "getLogs"))  wsSendLogs(num);
       }
       break;
 
     case WStype_DISCONNECTED:
       Serial.printf("[WS] Client #%d disconnected\n", num);
+      wsClients    &= ~(1UL << num);
+      wsBinClients &= ~(1UL << num);
+      wsPeerReset(num);
       break;
 
     default: break;
@@ -589,8 +2639,33 @@ void handleCaptivePortal() {
   server.send(302, "text/plain", "");
 }
 
+// Rename / hapus dari dashboard → antre ke task UI (pemilik users.bin)
+bool userMutPush(UserOpType op, const User& u, const char* name) {
+  UserMut m;
+  m.op  = op;
+  m.key = uidKeyOf(u.uid, u.uidLen);
+  memset(m.name, 0, NAME_SIZE);
+  strncpy(m.name, name, NAME_SIZE-1);
+  return userMutQ.push(m);
+}
+
+// Dashboard versi gzip + ETag. Browser menyimpan salinan dan cukup
+// revalidasi (no-cache) → 304 tanpa body selama firmware sama.
+// Client tanpa gzip (jarang) dapat HTML_PAGE asli.
 void handleRoot() {
-  server.send_P(200, "text/html", HTML_PAGE);
+  server.sendHeader("ETag", HTML_PAGE_ETAG);
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("If-None-Match") == HTML_PAGE_ETAG) {
+    server.send(304);
+    return;
+  }
+  if (server.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server.send_P(200, "text/html", HTML_PAGE);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (const char*)HTML_PAGE_GZ, HTML_PAGE_GZ_LEN);
 }
 
 void handleApiRename() {
@@ -599,23 +2674,15 @@ void handleApiRename() {
   }
   int idx = server.arg("idx").toInt();
   String nm = server.arg("name"); nm.trim();
-  if (idx < 0 || idx >= userCount || nm.length() == 0) {
+  User u;
+  if (nm.length() == 0 || !userDb.read(idx, u)) {
     server.send(400, "application/json", "{\"ok\":false}"); return;
   }
-  strncpy(users[idx].name, nm.c_str(), NAME_SIZE-1);
-  users[idx].name[NAME_SIZE-1] = '\0';
-  saveUsers();
-  server.send(200, "application/json", "{\"ok\":true}");
-
-  String msg = "{\"type\":\"userchange\",\"msg\":\"Nama diperbarui\","
-               "\"count\":" + String(userCount) + ",\"users\":[";
-  for (int i = 0; i < userCount; i++) {
-    if (i) msg += ",";
-    msg += "{\"name\":\"" + jsonEsc(users[i].name)
-        + "\",\"uid\":\"" + uidToStr(users[i].uid, UID_SIZE) + "\"}";
+  if (!userMutPush(OP_RENAME, u, nm.c_str())) {
+    server.send(503, "application/json", "{\"ok\":false}"); return;
   }
-  msg += "]}";
-  ws.broadcastTXT(msg);
+  server.send(200, "application/json", "{\"ok\":true}");
+  wsBroadcastToast("Nama diperbarui");
 }
 
 void handleApiDelete() {
@@ -623,34 +2690,270 @@ void handleApiDelete() {
     server.send(400, "application/json", "{\"ok\":false}"); return;
   }
   int idx = server.arg("idx").toInt();
-  String dname = (idx >= 0 && idx < userCount) ? String(users[idx].name) : "";
-  if (removeUser(idx)) {   // removeUser sudah panggil saveUsers()
-    server.send(200, "application/json", "{\"ok\":true}");
-    String msg = "{\"type\":\"userchange\",\"msg\":\""
-               + jsonEsc(dname.c_str()) + " dihapus\","
-               + "\"count\":" + String(userCount) + ",\"users\":[";
-    for (int i = 0; i < userCount; i++) {
-      if (i) msg += ",";
-      msg += "{\"name\":\"" + jsonEsc(users[i].name)
-          + "\",\"uid\":\"" + uidToStr(users[i].uid, UID_SIZE) + "\"}";
-    }
-    msg += "]}";
-    ws.broadcastTXT(msg);
-  } else {
-    server.send(400, "application/json", "{\"ok\":false}");
+  User du;
+  if (!userDb.read(idx, du)) {
+    server.send(400, "application/json", "{\"ok\":false}"); return;
+  }
+  if (!userMutPush(OP_REMOVE, du, "")) {
+    server.send(503, "application/json", "{\"ok\":false}"); return;
   }
+  // Dihapus task UI sebentar lagi; delta menyusul lewat wsRefill()
+  server.send(200, "application/json", "{\"ok\":true}");
+  char msg[NAME_SIZE + 12];
+  snprintf(msg, sizeof(msg), "%s dihapus", du.name);
+  wsBroadcastToast(msg);
 }
 
-void handleApiLogsCsv() {
-  String csv = "No,Nama,UID,Waktu(uptime)\r\n";
-  for (int i = 0; i < logCount; i++) {
-    csv += String(i+1) + "," + logs[i].name + ","
-         + logs[i].uid + "," + formatUptime(logs[i].ts) + "\r\n";
+// ?from=&to=&user= — dipakai /api/logs dan /api/logs/csv
+LogQuery logQueryArgs() {
+  LogQuery q;
+  q.ranged = server.hasArg("from") || server.hasArg("to");
+  q.from   = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10) : 0;
+  q.to     = server.hasArg("to")   ? strtoul(server.arg("to").c_str(),   nullptr, 10) : 0xFFFFFFFFUL;
+  q.byUser = server.hasArg("user");
+  q.key    = uidKeyRaw(0);
+  if (q.byUser) {
+    byte uid[UID_MAX];
+    q.key = uidKeyOf(uid, strToUid(server.arg("user").c_str(), uid));
+  }
+  return q;
+}
+
+bool logInRange(const LogQuery& q, uint32_t ts) {
+  return !q.ranged || (ts >= EPOCH_MIN && ts >= q.from && ts <= q.to);
+}
+
+bool logMatch(const LogQuery& q, const UidKey& k, uint32_t ts) {
+  if (q.byUser && k != q.key) return false;
+  return logInRange(q, ts);
+}
+
+void csvRow(uint32_t no, const UidKey& k, uint32_t ts) {
+  char name[NAME_SIZE], uid[UID_STR], t[24];
+  nameOfKey(name, k);
+  uidOfKey(uid, k);
+  fmtTs(t, sizeof(t), ts);
+  httpOut.unum(no).ch(',').csv(name).ch(',').csv(uid).ch(',');
+  if (ts >= EPOCH_MIN) httpOut.unum(ts);
+  httpOut.ch(',').csv(t).raw("\r\n");
+}
+
+// Riwayat lengkap, terlama dulu: arsip /hist lalu segmen jurnal yang
+// belum diarsip. Filter sama dengan /api/logs; blok arsip di luar
+// from/to dilewati lewat header, blok jurnal lewat indeks. Nama
+// di-resolve sekarang: nama terbaru, user yang sudah dihapus jadi "?".
+// Dibuat per langkah (csvStep); selama ada ekspor histStep() menunggu,
+// jadi histDone / histFirst tidak bergeser di tengah ekspor.
+#define CSV_STEP_BLOCKS 4          // blok arsip / jurnal maks per langkah
+
+// Satu blok jurnal dari record ke-at. true = segmen habis
+bool csvJournalBlock(uint32_t seq, uint32_t& b, uint32_t& at, const LogQuery& q, uint32_t& no) {
+  int got = journalReadBlock(seq, b, q, jrnReadBuf);
+  for (int i = at; i < got; i++) {
+    if (!httpFits(HTTP_ROW_MAX)) { at = i; return false; }
+    const JournalRec& r = jrnReadBuf[i];
+    if (r.user == JREC_BOOT || r.user == JREC_TIME || !logMatch(q, r.key, r.ts)) continue;
+    csvRow(++no, r.key, r.ts);
+  }
+  at = 0;
+  return ++b >= JIDX_BLOCKS;
+}
+
+// cur: [0] segmen (0 = baris judul belum), [1] offset blok .col /
+// nomor blok jurnal, [2] tap berikutnya di blok, [3] nomor baris
+bool csvStep(uint32_t* cur) {
+  LogQuery q = logQueryArgs();
+  if (!cur[0]) {
+    httpOut.raw("No,Nama,UID,Epoch,Waktu\r\n");
+    cur[0] = histFirst ? histFirst : max(histDone + 1, jrnFirstSeq);
   }
+  for (int n = 0; n < CSV_STEP_BLOCKS && httpFits(HTTP_ROW_MAX); n++) {
+    uint32_t seq = cur[0];
+    bool end;
+    if (histFirst && seq >= histFirst && seq <= histDone) end = histExportBlock(seq, cur[1], cur[2], q, cur[3]);
+    else if (seq <= jrnSeq)                             end = csvJournalBlock(seq, cur[1], cur[2], q, cur[3]);
+    else return httpStep(false);
+    if (!end) continue;
+    cur[0]++;
+    cur[1] = cur[2] = 0;
+    if (cur[0] > histDone) cur[0] = max(cur[0], jrnFirstSeq);
+  }
+  return httpStep(true);
+}
+
+void csvDone() { csvExports--; }
+
+void handleApiLogsCsv() {
   server.sendHeader("Content-Disposition", "attachment; filename=absensi_log.csv");
-  server.send(200, "text/csv", csv);
+  csvExports++;
+  server.stream(200, "text/csv", csvStep, csvDone);
+}
+
+// Sesudah jendela jurnal /api/logs turun ke arsip: .col di bawah
+// jrnFirstSeq, terbaru dulu. Posisi tap arsip = seq × JOURNAL_SEG_RECS
+// + urutan tap di .col, jadi cursor tetap satu angka yang menurun.
+// Blok di luar from/to dilewati lewat header; blok lain didekode maju
+// (maks. CSV_STEP_BLOCKS per langkah), LOGS_HIST_HITS tap cocok
+// terbaru ditampung dan dikirim mundur — lebih dari itu, blok yang
+// sama didekode lagi untuk sisanya. Key kamus dibaca dari flash hanya
+// untuk tap yang dikirim (atau dicocokkan ke ?user=). Return 1 = masih ada item
+// sesudah limit, 0 = arsip habis, -1 = lanjut di langkah berikut.
+#define LOGS_HIST_HITS 16
+#define HIST_SEG_BLOCKS ((JOURNAL_SEG_RECS + HIST_BLOCK - 1) / HIST_BLOCK)
+
+struct HistHit {
+  UidKey   key;          // ref 0: key sudah terisi
+  uint32_t ref, ts, pos;
+};
+HistHit histHits[LOGS_HIST_HITS];
+
+int logsHist(const LogQuery& q, int limit, uint32_t* cur) {
+  if (!histFirst || !cur[1]) return 0;
+  uint32_t seq = min(min((uint32_t)histDone, jrnFirstSeq - 1), (cur[1] - 1) / JOURNAL_SEG_RECS);
+  int decoded = 0;
+  LogEntry e;
+  for (; seq >= histFirst && seq; cur[1] = seq * JOURNAL_SEG_RECS, seq--) {
+    File f = LittleFS.open(histPath(seq, ".col"), "r");
+    if (!f) continue;
+    uint32_t at[HIST_SEG_BLOCKS], tap0[HIST_SEG_BLOCKS], off = 0, taps = 0;
+    int nb = 0;
+    HistBlockHdr h;
+    while (nb < HIST_SEG_BLOCKS && f.seek(off) && f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+           h.magic == HIST_MAGIC) {
+      at[nb] = off; tap0[nb++] = taps;
+      off += sizeof(h) + h.len; taps += h.taps;
+    }
+    for (int b = nb - 1; b >= 0; ) {
+      uint32_t pos0 = seq * JOURNAL_SEG_RECS + tap0[b];
+      if (pos0 >= cur[1]) { b--; continue; }
+      if (!f.seek(at[b]) || f.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) break;
+      if (q.ranged && (h.tsMax < q.from || h.tsMin > q.to)) { cur[1] = pos0; b--; continue; }
+      if (decoded++ == CSV_STEP_BLOCKS || !httpFits(HTTP_ROW_MAX)) return -1;
+      if (!histLoad(f, seq, at[b], h)) { cur[1] = pos0; b--; continue; }
+      HistReader rd(h, histBuf);
+      uint32_t ref, ts, n = 0;
+      UidKey   k = uidKeyRaw(0);
+      for (uint32_t pos = pos0; pos < cur[1] && rd.next(ref, k, ts); pos++) {
+        if (!logInRange(q, ts)) continue;
+        if (q.byUser) {
+          if (ref && !histKeys.key(ref - 1, k)) continue;    // slot kamus rusak
+          if (k != q.key) continue;
+          ref = 0;
+        }
+        histHits[n++ % LOGS_HIST_HITS] = { k, ref, ts, pos };
+      }
+      for (uint32_t i = 0; i < n && i < LOGS_HIST_HITS; i++) {
+        HistHit& hit = histHits[(n - 1 - i) % LOGS_HIST_HITS];
+        if (cur[2] == (uint32_t)limit) return 1;
+        if (!httpFits(HTTP_ROW_MAX)) return -1;
+        if (hit.ref && !histKeys.key(hit.ref - 1, hit.key)) continue;
+        nameOfKey(e.name, hit.key);
+        uidOfKey(e.uid, hit.key);
+        e.ts = hit.ts;
+        if (cur[2]++) httpOut.ch(',');
+        writeLogItem(httpOut, e);
+        cur[1] = cur[3] = hit.pos;
+      }
+      if (n <= LOGS_HIST_HITS) { cur[1] = pos0; b--; }      // lebih → blok ini lagi
+    }
+  }
+  return 0;
+}
+
+// Riwayat terbaru dulu — jurnal, lalu arsip /hist (logsHist):
+//   /api/logs?from=&to=&user=AA:BB:CC:DD&cursor=&limit=
+// from/to epoch detik (inklusif). cursor = "next" halaman
+// sebelumnya (posisi global record, eksklusif). Blok jurnal yang
+// tidak lolos ringkasan indeks tidak dibaca dari flash. Record yang
+// masih antre di RAM (<= JOURNAL_FLUSH_MS) belum ikut. Arsip tertua
+// terhapus sesudah HIST_MAX_KB — "next": null = tidak ada yang lebih lama.
+// cur: [0] 1 = sudah mulai, [1] posisi record berikutnya (eksklusif),
+// [2] item terkirim, [3] posisi item terakhir ("next")
+bool logsStep(uint32_t* cur) {
+  LogQuery q = logQueryArgs();
+  int limit = server.hasArg("limit") ? server.arg("limit").toInt() : LOG_PAGE_DEF;
+  limit = constrain(limit, 1, LOG_PAGE_MAX);
+  if (!cur[0]) {
+    cur[0] = 1;
+    cur[1] = server.hasArg("cursor") ? strtoul(server.arg("cursor").c_str(), nullptr, 10) : 0xFFFFFFFFUL;
+    httpOut.raw("{\"items\":[");
+  }
+  bool more = false;
+  LogEntry e;
+  for (uint32_t seq = jrnSeq; seq >= jrnFirstSeq && seq && !more; seq--) {
+    for (int b = JIDX_BLOCKS - 1; b >= 0 && !more; b--) {
+      uint32_t base = seq * JOURNAL_SEG_RECS + b * LOG_BLOCK;
+      if (base >= cur[1]) continue;
+      int got = journalReadBlock(seq, b, q, jrnReadBuf);
+      for (int i = got - 1; i >= 0; i--) {
+        const JournalRec& r = jrnReadBuf[i];
+        if (base + i >= cur[1] || r.user == JREC_BOOT || r.user == JREC_TIME) continue;
+        if (!logMatch(q, r.key, r.ts)) continue;
+        if (cur[2] == (uint32_t)limit) { more = true; break; }
+        if (!httpFits(HTTP_ROW_MAX)) return httpStep(true);
+        nameOfKey(e.name, r.key);
+        uidOfKey(e.uid, r.key);
+        e.ts = r.ts;
+        if (cur[2]++) httpOut.ch(',');
+        writeLogItem(httpOut, e);
+        cur[1] = cur[3] = base + i;
+      }
+      if (!more) cur[1] = base;
+    }
+  }
+  if (!more) {
+    int h = logsHist(q, limit, cur);
+    if (h < 0) return httpStep(true);
+    more = h > 0;
+  }
+  httpOut.raw("],\"next\":");
+  if (more) httpOut.unum(cur[3]); else httpOut.raw("null");
+  httpOut.ch('}');
+  return httpStep(false);
+}
+
+void handleApiLogs() { server.stream(200, "application/json", logsStep, nullptr); }
+
+// cur: [0] 1 = sudah mulai, [1] slot berikutnya, [2] item, [3] telat
+bool summaryStep(uint32_t* cur) {
+  char b[24];
+  if (!cur[0]) {
+    cur[0] = 1;
+    httpOut.raw("{\"day\":");
+    if (daySum.day()) {
+      CivilTime t = civilOf(daySum.day() * 86400UL);
+      snprintf(b, sizeof(b), "\"%04u-%02u-%02u\"", t.year, t.month, t.day);
+      httpOut.raw(b);
+    } else {
+      httpOut.raw("null");
+    }
+    snprintf(b, sizeof(b), "%02d:%02d", LATE_AFTER / 60, LATE_AFTER % 60);
+    httpOut.raw(",\"lateAfter\":\"").raw(b)
+           .raw("\",\"present\":").unum(daySum.used())
+           .raw(",\"dropped\":").unum(daySum.drops())
+           .raw(",\"items\":[");
+  }
+  char name[NAME_SIZE];
+  for (; cur[1] < daySum.slots(); cur[1]++) {
+    const DayAgg& a = daySum.at(cur[1]);
+    if (!a.count) continue;
+    if (!httpFits(HTTP_ROW_MAX)) return httpStep(true);
+    nameOfKey(name, a.key);
+    uidOfKey(b, a.key);
+    if (cur[2]++) httpOut.ch(',');
+    httpOut.raw("{\"name\":").str(name).raw(",\"uid\":\"").raw(b)
+           .raw("\",\"first\":").unum(a.first).raw(",\"last\":").unum(a.last)
+           .raw(",\"count\":").unum(a.count)
+           .raw(",\"late\":").raw(a.late ? "true}" : "false}");
+    cur[3] += a.late;
+  }
+  httpOut.raw("],\"late\":").unum(cur[3]).ch('}');
+  return httpStep(false);
 }
 
+// Rekap hari ini, langsung dari tabel daySum (tanpa scan log)
+void handleApiSummary() { server.stream(200, "application/json", summaryStep, nullptr); }
+
 void handleApiDebugFs() {
   String out = "LittleFS Files:\n";
   File root = LittleFS.open("/");
@@ -659,17 +2962,122 @@ void handleApiDebugFs() {
     out += "  " + String(file.name()) + "  (" + String(file.size()) + " bytes)\n";
     file = root.openNextFile();
   }
-  if (LittleFS.exists(USERS_FILE)) {
-    File f = LittleFS.open(USERS_FILE, "r");
-    out += "\nusers.json:\n" + f.readString();
-    f.close();
-  }
+  out += "\njurnal: segmen " + String(jrnFirstSeq) + ".." + String(jrnSeq)
+       + ", " + String(jrnSegRecs) + " record aktif, " + String(jrnPendingN) + " antre\n";
+  out += "arsip: " + String(histFirst) + ".." + String(histDone) + ", "
+       + String(histBytes / 1024) + "/" + String(HIST_MAX_KB) + " KB, kamus "
+       + String(histKeys.count()) + " UID" + (histSeg ? ", mengarsip " + String(histSeg) : String())
+       + (histFails ? ", gagal " + String(histFails) + "x" : String()) + "\n";
+  out += "users.bin: " + String(userDb.count()) + " user x "
+       + String((int)sizeof(DbRecord)) + " byte/record\n";
   server.send(200, "text/plain", out);
 }
 
+// cur: [0] 1 = sudah mulai, [1] index user berikutnya
+bool usersStep(uint32_t* cur) {
+  if (!cur[0]) {
+    cur[0] = 1;
+    httpOut.raw("{\"count\":").num(userDb.count()).raw(",\"users\":[");
+  }
+  User u;
+  for (; (int)cur[1] < userDb.count(); cur[1]++) {
+    if (!httpFits(HTTP_ROW_MAX)) return httpStep(true);
+    userDb.read(cur[1], u);
+    if (cur[1]) httpOut.ch(',');
+    writeUserItem(httpOut, u);
+  }
+  httpOut.raw("]}");
+  return httpStep(false);
+}
+
+void handleApiUsersExport() {
+  server.sendHeader("Content-Disposition", "attachment; filename=users.json");
+  server.stream(200, "application/json", usersStep, nullptr);
+}
+
+// Histogram per tahap: n[i] = jumlah tap dengan latensi < bucketsUs[i]
+// (elemen terakhir n = sisanya). Clock SPI RC522 ikut dilaporkan.
+const char* const TAP_STAGE_NAMES[TAP_STAGES] = { "uid", "lookup", "feedback", "total" };
+
+void writeHist(JsonBuf& j, const LatHist<LAT_BUCKETS, 5>& h) {
+  j.raw("{\"count\":").unum(h.count)
+   .raw(",\"avgUs\":").unum(h.count ? (uint32_t)(h.sum / h.count) : 0)
+   .raw(",\"p99Us\":").unum(h.quantile(990))
+   .raw(",\"maxUs\":").unum(h.max).raw(",\"n\":[");
+  for (int i = 0; i < LAT_BUCKETS; i++) {
+    if (i) j.ch(',');
+    j.unum(h.n[i]);
+  }
+  j.raw("]}");
+}
+
+void handleApiStatsTap() {
+  if (server.hasArg("reset")) {
+    tapStat = {0, 0, 0, 0};
+    for (int i = 0; i < TAP_STAGES; i++) tapHist[i].clear();
+    bcastHist.clear();
+  }
+  char b[2048]; JsonBuf j(b, sizeof(b));
+  j.raw("{\"taps\":").unum(tapStat.count)
+   .raw(",\"lastUs\":").unum(tapStat.lastUs)
+   .raw(",\"maxUs\":").unum(tapStat.maxUs)
+   .raw(",\"maxUsStreaming\":").unum(tapStat.maxStreamUs)
+   .raw(",\"streaming\":").raw(httpStreaming ? "true" : "false")
+   .raw(",\"attendDrops\":").unum(attendQ.drops())
+   .raw(",\"userMutDrops\":").unum(userMutQ.drops())
+   .raw(",\"oledBytes\":").unum(oledBytes)
+   .raw(",\"rfidMode\":").raw(RFID_IRQ < 0 ? "\"poll\"" : "\"irq\"")
+#ifdef MFRC522_SPICLOCK
+   .raw(",\"spiHz\":").unum(MFRC522_SPICLOCK)
+#endif
+   .raw(",\"bucketsUs\":[");
+  for (int i = 0; i < LAT_BUCKETS - 1; i++) {
+    if (i) j.ch(',');
+    j.unum(tapHist[0].bound(i));
+  }
+  j.raw("],\"stages\":{");
+  for (int st = 0; st < TAP_STAGES; st++) {
+    j.ch('"').raw(TAP_STAGE_NAMES[st]).raw("\":");
+    writeHist(j, tapHist[st]);
+    j.ch(',');
+  }
+  j.raw("\"broadcast\":");            // kartu terdeteksi → attend masuk antrean WS (task net)
+  writeHist(j, bcastHist);
+  j.raw("}}");
+  sendJson(j);
+}
+
+// queues: antrean kirim per slot client (bytes/frames sekarang, peak,
+// drops = frame ditolak karena penuh, coalesced = status yang digantikan)
+void handleApiStatsWs() {
+  char b[384 + WEBSOCKETS_SERVER_CLIENT_MAX * 160]; JsonBuf j(b, sizeof(b));
+  j.raw("{\"clients\":").unum(__builtin_popcount(wsClients))
+   .raw(",\"binClients\":").unum(__builtin_popcount(wsBinClients))
+   .raw(",\"lastMinute\":{\"msgs\":").unum(wsStatLast.msgs)
+   .raw(",\"bytes\":").unum(wsStatLast.bytes)
+   .raw("},\"thisMinute\":{\"msgs\":").unum(wsStatMinute.msgs)
+   .raw(",\"bytes\":").unum(wsStatMinute.bytes)
+   .raw("},\"total\":{\"msgs\":").unum(wsStatTotal.msgs)
+   .raw(",\"bytes\":").unum(wsStatTotal.bytes)
+   .raw("},\"evictions\":").unum(wsEvictions)
+   .raw(",\"queueCap\":").unum(WS_QUEUE_BYTES).raw(",\"queues\":[");
+  for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) {
+    const WsPeer& p = wsPeer[c];
+    if (c) j.ch(',');
+    j.raw("{\"id\":").unum(c).raw(",\"on\":").raw((wsClients >> c) & 1 ? "true" : "false")
+     .raw(",\"bytes\":").unum(p.q.bytes()).raw(",\"frames\":").unum(p.q.frames())
+     .raw(",\"peak\":").unum(p.q.peak()).raw(",\"drops\":").unum(p.q.drops())
+     .raw(",\"coalesced\":").unum(p.q.coalesced()).ch('}');
+  }
+  j.raw("],\"uptime\":").unum(upSec()).ch('}');
+  sendJson(j);
+}
+
 void setupNetwork() {
-  WiFi.mode(WIFI_AP);
+  bool site = SITE_SSID[0];
+  WiFi.mode(site ? WIFI_AP_STA : WIFI_AP);
   WiFi.softAP(AP_SSID, AP_PASS);
+  if (site) WiFi.begin(SITE_SSID, SITE_PASS);   // tidak ditunggu; replikasi jalan begitu tersambung
   delay(100);
   Serial.printf("[WiFi] AP IP: %s\n", WiFi.softAPIP().toString().c_str());
 
@@ -680,8 +3088,15 @@ void setupNetwork() {
   server.on("/favicon.ico",  HTTP_GET,  [](){server.send(204,"","");});
   server.on("/api/rename",   HTTP_POST, handleApiRename);
   server.on("/api/delete",   HTTP_POST, handleApiDelete);
+  server.on("/api/logs",     HTTP_GET,  handleApiLogs);
+  server.on("/api/summary",  HTTP_GET,  handleApiSummary);
   server.on("/api/logs/csv", HTTP_GET,  handleApiLogsCsv);
   server.on("/api/debug/fs", HTTP_GET,  handleApiDebugFs);
+  server.on("/api/users.json", HTTP_GET, handleApiUsersExport);
+  server.on("/api/stats/ws",  HTTP_GET,  handleApiStatsWs);
+  server.on("/api/stats/tap", HTTP_GET,  handleApiStatsTap);
+  server.on("/api/metrics",   HTTP_GET,  handleApiMetrics);
+  server.on("/api/repl",      HTTP_GET,  handleApiRepl);
   // Captive portal endpoints
   server.on("/generate_204",              HTTP_GET, handleCaptivePortal);
   server.on("/gen_204",                   HTTP_GET, handleCaptivePortal);
@@ -691,10 +3106,373 @@ void setupNetwork() {
   server.on("/connecttest.txt",           HTTP_GET, handleCaptivePortal);
   server.on("/redirect",                  HTTP_GET, handleCaptivePortal);
   server.onNotFound(handleCaptivePortal);
+  server.captive(AP_DOMAIN, WiFi.softAPIP().toString().c_str());
 
   server.begin();
   ws.begin();
   ws.onEvent(onWsEvent);
+  if (site) replStart();
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   METRIK — /api/metrics (Prometheus text 0.0.4)
+//   Histogram log2 µs (LatHist) di jalur panas + heap,
+//   jumlah write flash, WS, tap. Biaya per sampel: 2×
+//   micros() + satu clz, tanpa lock — aman dibiarkan aktif.
+//   Dashboard menerima ringkasannya tiap METRICS_WS_MS:
+//   {"type":"metrics","heap":..,"heapMin":..,"block":..,
+//    "loopP99":..,"httpP99":..,"wsP99":..,"fsW":..}
+// └──────────────────────────────────────────────────────┘
+const char* const METRIC_NAMES[METRICS] = {
+  "loop", "find_user", "user_save", "oled_flush", "journal_flush", "http_handle", "ws_send"
+};
+const char* const METRIC_HELP[METRICS] = {
+  "Durasi satu putaran loop() task UI",
+  "Lookup UID ke user (indeks hash)",
+  "Tulis users.bin per tambah/rename/hapus",
+  "Kirim tile OLED yang berubah lewat I2C",
+  "Tulis batch jurnal ke flash",
+  "server.handleClient() yang melayani request",
+  "Satu frame WebSocket ditulis ke socket"
+};
+
+unsigned long metricsWsRef = 0;
+
+void promHead(const char* name, const char* type, const char* help) {
+  httpOut.raw("# HELP absensi_").raw(name).ch(' ').raw(help)
+         .raw("\n# TYPE absensi_").raw(name).ch(' ').raw(type).ch('\n');
+}
+
+void promValue(const char* name, const char* type, const char* help, uint32_t v) {
+  promHead(name, type, help);
+  httpOut.raw("absensi_").raw(name).ch(' ').unum(v).ch('\n');
+}
+
+// Bucket kumulatif; +Inf & _count dari jumlah bucket supaya konsisten
+// walau task lain menambah sampel di tengah baca
+void promHist(const char* prefix, const char* name, const char* help,
+              const LatHist<LAT_BUCKETS, 5>& h) {
+  char n[32]; snprintf(n, sizeof(n), "%s%s_us", prefix, name);
+  promHead(n, "histogram", help);
+  uint32_t cum = 0;
+  for (int i = 0; i < LAT_BUCKETS; i++) {
+    cum += h.n[i];
+    httpOut.raw("absensi_").raw(n).raw("_bucket{le=\"");
+    if (i < LAT_BUCKETS - 1) httpOut.unum(h.bound(i)); else httpOut.raw("+Inf");
+    httpOut.raw("\"} ").unum(cum).ch('\n');
+  }
+  char sum[24]; snprintf(sum, sizeof(sum), "%llu", (unsigned long long)h.sum);
+  httpOut.raw("absensi_").raw(n).raw("_sum ").raw(sum).ch('\n')
+         .raw("absensi_").raw(n).raw("_count ").unum(cum).ch('\n');
+}
+
+// Satu bagian per langkah (cur[0]): histogram satu per satu, lalu
+// nilai tunggal dalam kelompok ≤ 1 KB
+bool metricsStep(uint32_t* cur) {
+  uint32_t part = cur[0]++;
+  if (part < METRICS) {
+    promHist("", METRIC_NAMES[part], METRIC_HELP[part], metric[part]);
+    return httpStep(true);
+  }
+  part -= METRICS;
+  if (part < TAP_STAGES) {
+    promHist("tap_", TAP_STAGE_NAMES[part], "Tahap tap kartu (lihat /api/stats/tap)", tapHist[part]);
+    return httpStep(true);
+  }
+  switch (part - TAP_STAGES) {
+    case 0:
+      promHist("tap_", "broadcast", "Kartu terdeteksi sampai frame attend masuk antrean semua client WS", bcastHist);
+      return httpStep(true);
+    case 1:
+      promValue("heap_free_bytes",          "gauge", "Heap bebas", ESP.getFreeHeap());
+      promValue("heap_min_free_bytes",      "gauge", "Heap bebas terendah sejak boot", ESP.getMinFreeHeap());
+      promValue("heap_largest_block_bytes", "gauge", "Blok heap terbesar yang bisa dialokasikan", ESP.getMaxAllocHeap());
+      promValue("uptime_seconds",           "gauge", "Detik sejak boot", upSec());
+      promValue("users",                    "gauge", "User terdaftar", userDb.count());
+      promValue("log_ring_entries",         "gauge", "Entri ring log RAM", logRing.count());
+      promValue("ws_clients",               "gauge", "Client WebSocket terkoneksi", __builtin_popcount(wsClients));
+      return httpStep(true);
+    case 2:
+      promValue("http_connections",         "gauge", "Koneksi HTTP terbuka (maks HTTP_CONNS)", server.connections());
+      promValue("http_requests_total",      "counter", "Request HTTP yang dilayani handler", server.requests());
+      promValue("http_captive_total",       "counter", "Probe captive dijawab 302 jalur cepat", server.captiveHits());
+      promValue("http_busy_total",          "counter", "Koneksi ditolak 503 karena semua slot sibuk", server.busyRejects());
+      promValue("http_evicted_total",       "counter", "Koneksi keep-alive diam dilepas untuk client baru", server.evictions());
+      promValue("taps_total",               "counter", "Tap kartu terbaca", tapStat.count);
+      promValue("attend_queue_drops_total", "counter", "Event absen dibuang karena attendQ penuh", attendQ.drops());
+      return httpStep(true);
+    case 3:
+      promValue("oled_bytes_total",         "counter", "Byte tile OLED terkirim", oledBytes);
+      promValue("ws_messages_total",        "counter", "Pesan WS terkirim (per penerima)", wsStatTotal.msgs);
+      promValue("ws_bytes_total",           "counter", "Byte WS terkirim (per penerima)", wsStatTotal.bytes);
+      promValue("ws_evictions_total",       "counter", "Client WS diputus karena antrean penuh / macet", wsEvictions);
+      promValue("repl_records_total",       "counter", "Record user dari unit lain diteruskan ke task UI", repl.stats().records);
+      promValue("repl_full_total",          "counter", "Snapshot penuh dilayani ke unit lain", repl.stats().fulls);
+      return httpStep(true);
+    case 4:
+      promHead("ws_queue_bytes", "gauge", "Isi antrean kirim per slot client WS");
+      for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++)
+        httpOut.raw("absensi_ws_queue_bytes{client=\"").unum(c).raw("\"} ").unum(wsPeer[c].q.bytes()).ch('\n');
+      promHead("ws_queue_drops_total", "counter", "Frame WS ditolak karena antrean penuh, per slot client");
+      for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++)
+        httpOut.raw("absensi_ws_queue_drops_total{client=\"").unum(c).raw("\"} ").unum(wsPeer[c].q.drops()).ch('\n');
+      return httpStep(true);
+  }
+  promHead("ws_queue_coalesced_total", "counter", "Frame status/metrics yang digantikan sebelum terkirim, per slot client");
+  for (uint8_t c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++)
+    httpOut.raw("absensi_ws_queue_coalesced_total{client=\"").unum(c).raw("\"} ").unum(wsPeer[c].q.coalesced()).ch('\n');
+  promHead("fs_writes_total", "counter", "Write LittleFS per file");
+  httpOut.raw("absensi_fs_writes_total{file=\"users\"} ").unum(userDb.writes())
+         .raw("\nabsensi_fs_writes_total{file=\"journal\"} ").unum(jrnWrites)
+         .raw("\nabsensi_fs_writes_total{file=\"hist\"} ").unum(histWrites).ch('\n');
+  promValue("journal_lost_total", "counter", "Tap tidak masuk jurnal (antrean penuh, flash tidak bisa ditulis)", jrnLost);
+  promValue("hist_bytes", "gauge", "Ukuran arsip riwayat /hist", histBytes);
+  return httpStep(false);
+}
+
+void handleApiMetrics() { server.stream(200, "text/plain; version=0.0.4", metricsStep, nullptr); }
+
+// Task net — ringkasan untuk dashboard, hanya kalau ada client
+void metricsTick(unsigned long now) {
+  if (now - metricsWsRef < METRICS_WS_MS) return;
+  metricsWsRef = now;
+  if (!wsClients) return;
+  uint32_t heap = ESP.getFreeHeap(), heapMin = ESP.getMinFreeHeap(), block = ESP.getMaxAllocHeap();
+  uint32_t loopP = metric[M_LOOP].quantile(990), httpP = metric[M_HTTP].quantile(990);
+  uint32_t wsP = metric[M_WS_SEND].quantile(990), fsW = userDb.writes() + jrnWrites;
+  char    jb[192]; JsonBuf j(jb, sizeof(jb));
+  uint8_t mb[128]; MpBuf   m(mb, sizeof(mb));
+  if (wsWantsTxt(-1))
+    j.raw("{\"type\":\"metrics\",\"heap\":").unum(heap).raw(",\"heapMin\":").unum(heapMin)
+     .raw(",\"block\":").unum(block).raw(",\"loopP99\":").unum(loopP)
+     .raw(",\"httpP99\":").unum(httpP).raw(",\"wsP99\":").unum(wsP)
+     .raw(",\"fsW\":").unum(fsW).ch('}');
+  if (wsWantsBin(-1))
+    m.map(8).key("type").str("metrics").key("heap").uint(heap).key("heapMin").uint(heapMin)
+     .key("block").uint(block).key("loopP99").uint(loopP).key("httpP99").uint(httpP)
+     .key("wsP99").uint(wsP).key("fsW").uint(fsW);
+  wsDeliver(-1, jb, j.length(), mb, m.length(), WSK_METRICS);
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   TASK JARINGAN — core 0
+//   DNS/HTTP/WS tidak lagi berbagi loop dengan RFID: client
+//   lambat / download CSV besar tidak menunda baca kartu.
+//   Kirim WS lewat antrean per client (wsDrain), jadi client
+//   di sinyal lemah tidak menahan DNS/HTTP maupun client lain.
+//   Data lintas core hanya lewat attendQ, userMutQ, replInQ,
+//   ring userOps (userRev) dan users.bin + tombs (dbMutex).
+// └──────────────────────────────────────────────────────┘
+void netPump() {
+  AttendEvent a;
+  LogEntry&   e = a.e;
+  summaryTick();
+  while (attendQ.pop(a)) {
+    if (e.ts < EPOCH_MIN && timeBase) e.ts += timeBase;   // antre sebelum sinkron
+    addLog(e.name, e.uid, e.ts);
+    summaryTap(a.key, e.ts);
+    wsBroadcastAttend(e);
+    bcastHist.add(micros() - a.tapUs);
+  }
+  if (statusDirty) { statusDirty = false; wsBroadcastStatus(); }
+}
+
+// Satu putaran task jaringan (build host memanggilnya langsung)
+void netRound() {
+  dns.processNextRequest();
+  uint32_t t = micros();
+  server.handleClient();
+  t = micros() - t;
+  if (t >= metric[M_HTTP].bound(0)) metric[M_HTTP].add(t);     // putaran tanpa request tidak dihitung
+  httpStreaming = server.streams() > 0;
+  ws.loop();
+  netPump();
+  wsDrain(WS_DRAIN_US);
+  replPoll(millis());
+  histStep();
+  wsStatTick(millis());
+  metricsTick(millis());
+}
+
+void netTask(void*) {
+  for (;;) {
+    netRound();
+    vTaskDelay(1);               // beri jatah IDLE0 (watchdog) & stack WiFi
+  }
+}
+
+void netStart() {
+  xTaskCreatePinnedToCore(netTask, "net", NET_STACK, nullptr, 1, nullptr, NET_CORE);
+}
+
+// Task UI: terapkan rename/hapus dari dashboard
+void userMutApply() {
+  UserMut m;
+  while (userMutQ.pop(m)) {
+    int idx = findKey(m.key);
+    if (idx < 0) continue;
+    if (m.op == OP_RENAME) renameUser(idx, m.name);
+    if (m.op == OP_REMOVE) {
+      // Index yang sedang dikonfirmasi di OLED bisa bergeser
+      if (currentMode == MODE_ADMIN_DEL_CONFIRM) { deleteTarget = -1; goTo(MODE_ADMIN_DELETE); }
+      removeUser(idx);
+    }
+  }
+}
+
+// Task UI, sesudah buzzer dibunyikan: latensi per tahap sejak kartu
+// terdeteksi (IRQ, atau poll sebelumnya — kartu paling awal bisa menempel)
+void tapRecord(uint32_t detectUs, uint32_t uidUs, uint32_t lookupUs) {
+  uint32_t fbUs = micros(), us = fbUs - detectUs;
+  tapHist[STAGE_UID].add(uidUs - detectUs);
+  tapHist[STAGE_LOOKUP].add(lookupUs - uidUs);
+  tapHist[STAGE_FEEDBACK].add(fbUs - lookupUs);
+  tapHist[STAGE_TOTAL].add(us);
+  tapStat.count++;
+  tapStat.lastUs = us;
+  if (us > tapStat.maxUs) tapStat.maxUs = us;
+  if (httpStreaming && us > tapStat.maxStreamUs) tapStat.maxStreamUs = us;
+}
+
+// ┌──────────────────────────────────────────────────────┐
+//   RFID — deteksi & baca kartu (task UI)
+//   Polling: PICC_IsNewCardPresent() tiap loop = satu REQA
+//   yang menunggu timeout RC522 (~25 ms) selama tidak ada
+//   kartu. Mode IRQ (RFID_IRQ >= 0): REQA dikirim tanpa
+//   menunggu tiap RFID_ARM_MS; kartu yang menjawab (RxIRq)
+//   menarik pin IRQ, loop() cukup cek flag.
+//   Urutan per tap: UID → lookup → buzzer, baru log, jurnal
+//   dan OLED. rfidService() jalan paling awal di loop().
+// └──────────────────────────────────────────────────────┘
+volatile bool     rfidIrq    = false;
+volatile uint32_t rfidIrqUs  = 0;       // micros() saat pin IRQ turun
+unsigned long     rfidArmAt  = 0;
+uint32_t          rfidPollUs = 0;       // micros() poll sebelumnya (mode polling)
+
+void IRAM_ATTR rfidIsr() {
+  rfidIrqUs = micros();
+  rfidIrq   = true;
+}
+
+// REQA ke FIFO + Transceive; jawaban ATQA → RxIRq → pin IRQ
+void rfidArm() {
+  rfid.PCD_WriteRegister(MFRC522::ComIrqReg, 0x7F);        // hapus flag lama
+  rfid.PCD_WriteRegister(MFRC522::FIFOLevelReg, 0x80);     // kosongkan FIFO
+  rfid.PCD_WriteRegister(MFRC522::FIFODataReg, MFRC522::PICC_CMD_REQA);
+  rfid.PCD_WriteRegister(MFRC522::CommandReg, MFRC522::PCD_Transceive);
+  rfid.PCD_WriteRegister(MFRC522::BitFramingReg, 0x87);    // StartSend, frame 7 bit
+}
+
+void rfidInit() {
+  SPI.begin(RFID_SCK, RFID_MISO, RFID_MOSI, RFID_SS);
+  rfid.PCD_Init();
+  if (RFID_IRQ < 0) return;
+  pinMode(RFID_IRQ, INPUT_PULLUP);
+  rfid.PCD_WriteRegister(MFRC522::CommIEnReg, 0xA0);       // IRqInv (aktif LOW) + RxIEn
+  attachInterrupt(digitalPinToInterrupt(RFID_IRQ), rfidIsr, FALLING);
+  rfidArm();
+  rfidArmAt = millis();
+}
+
+// true = kartu baru terbaca di rfid.uid; detectUs = saat terdeteksi
+bool rfidDetect(unsigned long now, uint32_t& detectUs) {
+  if (RFID_IRQ < 0) {
+    detectUs   = rfidPollUs;
+    rfidPollUs = micros();
+    return rfid.PICC_IsNewCardPresent() && rfid.PICC_ReadCardSerial();
+  }
+  if (!rfidIrq) {
+    if (now - rfidArmAt >= RFID_ARM_MS) { rfidArm(); rfidArmAt = now; }
+    return false;
+  }
+  detectUs  = rfidIrqUs;
+  rfidArmAt = now - RFID_ARM_MS;        // REQA berikutnya di loop() selanjutnya
+  bool ok = rfid.PICC_ReadCardSerial();
+  rfidIrq = false;                      // RxIRq anticollision/select ikut menarik pin
+  return ok;
+}
+
+void rfidService(unsigned long now) {
+  uint32_t detectUs;
+  if (!rfidDetect(now, detectUs)) return;
+  uint32_t uidUs = micros();
+  byte*    uid   = rfid.uid.uidByte;
+  byte     uidSz = rfid.uid.size;
+  UidKey   key   = uidKeyOf(uid, uidSz);
+  if (tapCool.hit(key, now)) {
+    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
+  }
+  touchMode();
+
+  if (currentMode == MODE_SPLASH || currentMode == MODE_ATTEND ||
+      currentMode == MODE_ATTEND_OK || currentMode == MODE_ATTEND_FAIL) {
+    int idx = findKey(key);
+    uint32_t lookupUs = micros();
+    if (idx >= 0) beepOK(); else beepFail();
+    tapRecord(detectUs, uidUs, lookupUs);
+    String uStr = uidToStr(uid, uidSz);
+    Serial.printf("[RFID] %s\n", uStr.c_str());
+    if (idx >= 0) {
+      User u; userDb.read(idx, u);
+      AttendEvent a;
+      LogEntry&   e = a.e;
+      e.ts = nowTs();
+      journalAppend(userDb.key(idx), idx, e.ts);
+      strncpy(e.name, u.name, NAME_SIZE-1); e.name[NAME_SIZE-1] = '\0';
+      strncpy(e.uid, uStr.c_str(), UID_STR-1); e.uid[UID_STR-1] = '\0';
+      a.key = key; a.tapUs = detectUs;
+      attendQ.push(a);                      // log RAM + siaran di task net
+      Serial.printf("[ABSEN] %s\n", u.name);
+      displayAttendOK(u.name);
+      setMode(MODE_ATTEND_OK);
+    } else {
+      displayAttendFail(uStr.c_str());
+      setMode(MODE_ATTEND_FAIL);
+    }
+    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
+  }
+
+  String uStr = uidToStr(uid, uidSz);
+  Serial.printf("[RFID] %s\n", uStr.c_str());
+
+  if (currentMode == MODE_ADMIN_REGISTER) {
+    int idx = findKey(key);
+    User u;
+    if (idx >= 0) {
+      userDb.read(idx, u);
+      beepFail(); setMode(MODE_RESULT_FAIL);
+      displayResult(false, "Sudah Ada!", u.name, uStr.c_str());
+    } else if (userDb.count() >= MAX_USERS) {
+      char maxBuf[20]; snprintf(maxBuf, sizeof(maxBuf), "Max %d user", MAX_USERS);
+      beepFail(); setMode(MODE_RESULT_FAIL);
+      displayResult(false, "Penuh!", maxBuf);
+    } else if (!addUser(uid, uidSz)) {
+      beepFail(); setMode(MODE_RESULT_FAIL);
+      displayResult(false, "Gagal Simpan!", "Cek LittleFS");
+    } else {
+      userDb.read(userDb.count()-1, u);
+      beepOK();
+      Serial.printf("[REG] %s | %s\n", u.name, uStr.c_str());
+      setMode(MODE_RESULT_OK);
+      displayResult(true, u.name, "Terdaftar!", "Ganti nama di web");
+    }
+    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
+  }
+
+  if (currentMode == MODE_ADMIN_DELETE) {
+    int idx = findKey(key);
+    if (idx >= 0) {
+      deleteTarget = idx; setMode(MODE_ADMIN_DEL_CONFIRM);
+      displayDeleteConfirm(idx);
+    } else {
+      beepFail(); setMode(MODE_RESULT_FAIL);
+      displayResult(false, "Tdk Dikenal!", uStr.c_str());
+    }
+    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
+  }
+
+  rfid.PICC_HaltA();
+  rfid.PCD_StopCrypto1();
 }
 
 // ┌──────────────────────────────────────────────────────┐
@@ -703,6 +3481,10 @@ void setupNetwork() {
 void setup() {
   Serial.begin(115200);
   delay(200);
+  dbMutex = xSemaphoreCreateMutex();
+  userDb.setLock(dbLock, dbUnlock);
+  jrnMutex = xSemaphoreCreateMutex();
+  unitId = replUnitId();           // cap LWW sudah dipakai impor users.json
 
   pinMode(BTN_LEFT,   INPUT_PULLUP);
   pinMode(BTN_RIGHT,  INPUT_PULLUP);
@@ -715,186 +3497,50 @@ void setup() {
   } else {
     Serial.println("[FS] LittleFS OK");
     loadUsers();
+    histInit();
+    journalRecover();
   }
+  logInit();
 
   Wire.begin(21, 22);
   u8g2.begin();
+  oledDiff.invalidate();
   u8g2.setContrast(220);
+  timeInit();
 
-  SPI.begin(RFID_SCK, RFID_MISO, RFID_MOSI, RFID_SS);
-  rfid.PCD_Init();
+  rfidInit();
   delay(50);
 
   setupNetwork();
-
-  // ══════════════════════════════════════════════════════
-  //   ANIMATED SPLASH — 30fps unified loop (~3.5 detik)
-  // ══════════════════════════════════════════════════════
-  auto easeOut = [](float t) -> float {
-    float inv = 1.0f - t;
-    return 1.0f - (inv * inv * inv * inv);
-  };
-  auto easeInOut = [](float t) -> float {
-    return t < 0.5f ? 2*t*t : 1 - (-2*t+2)*(-2*t+2)/2;
-  };
-  auto clampf = [](float v, float lo, float hi) -> float {
-    return v < lo ? lo : (v > hi ? hi : v);
-  };
-
-  auto drawCard = [&](int cx, int cy, float scale) {
-    int w = (int)(40*scale), h = (int)(26*scale);
-    int x0 = cx - w/2, y0 = cy - h/2;
-    int r = (int)(3*scale); if (r < 1) r = 1;
-    u8g2.drawRFrame(x0, y0, w, h, r);
-    int chipX = x0 + (int)(8*scale), chipY = y0 + (int)(7*scale);
-    int chipW = (int)(11*scale); if (chipW < 3) chipW = 3;
-    int chipH = (int)(8*scale);  if (chipH < 2) chipH = 2;
-    u8g2.drawRFrame(chipX, chipY, chipW, chipH, 1);
-    if (scale > 0.4f) {
-      int lineY = y0 + (int)(13*scale);
-      u8g2.drawHLine(x0 + (int)(22*scale), lineY, (int)(14*scale));
-    }
-  };
-
-  auto drawSignal = [&](int cx, int cy, int rings, float progress) {
-    for (int i = 0; i < rings; i++) {
-      float ringT = clampf((progress * rings) - i, 0.0f, 1.0f);
-      if (ringT <= 0.0f) break;
-      int r = 10 + i * 9;
-      u8g2.drawCircle(cx, cy, r, U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_LEFT);
-    }
-  };
-
-  const unsigned long SPLASH_TOTAL = 3300UL;
-  const unsigned long FRAME_MS     = 33UL;
-  unsigned long splashStart = millis();
-  const int CARD_SMALL_CX = 13, CARD_SMALL_CY = 7;
-  const float CARD_SMALL_S = 0.45f;
-  const int CARD_BIG_CX = 64, CARD_BIG_CY = 31;
-  char infoBuf[30];
-  snprintf(infoBuf, sizeof(infoBuf), "%d user  |  %s", userCount, AP_DOMAIN);
-  bool beepDone = false;
-
-  while (true) {
-    unsigned long now = millis();
-    unsigned long elapsed = now - splashStart;
-    if (elapsed > SPLASH_TOTAL) break;
-    float T = (float)elapsed / (float)SPLASH_TOTAL;
-
-    float t1   = clampf(T / 0.12f, 0.0f, 1.0f);
-    float cardS = easeOut(t1);
-    float t2   = clampf((T - 0.12f) / 0.33f, 0.0f, 1.0f);
-    float sigProg = easeInOut(t2) * 3.0f;
-    float t3   = clampf((T - 0.40f) / 0.20f, 0.0f, 1.0f);
-    float t3e  = easeOut(t3);
-    int cardCX = (int)(CARD_BIG_CX + (CARD_SMALL_CX - CARD_BIG_CX) * t3e);
-    int cardCY = (int)(CARD_BIG_CY + (CARD_SMALL_CY - CARD_BIG_CY) * t3e);
-    float cardSc = cardS * (1.0f - t3e) + CARD_SMALL_S * t3e;
-    float t3b  = clampf((T - 0.45f) / 0.20f, 0.0f, 1.0f);
-    int lineY  = (int)(-2 + 17 * easeOut(t3b));
-    float t3c  = clampf((T - 0.50f) / 0.22f, 0.0f, 1.0f);
-    int titleY = (int)(-15 + 29 * easeOut(t3c));
-    float t3d  = clampf((T - 0.58f) / 0.20f, 0.0f, 1.0f);
-    int subY   = (int)(-8 + 50 * easeOut(t3d));
-    float t4   = clampf((T - 0.72f) / 0.24f, 0.0f, 1.0f);
-    float barP = easeInOut(t4);
-    int barW   = (int)(118.0f * barP);
-    bool showInfo = (T >= 0.78f);
-
-    if (!beepDone && T >= 0.72f) { beepBoot(); beepDone = true; }
-
-    u8g2.clearBuffer();
-    if (T < 0.42f) {
-      drawCard(CARD_BIG_CX, CARD_BIG_CY, cardS);
-      if (t2 > 0.0f) drawSignal(CARD_BIG_CX - 20, CARD_BIG_CY, 3, sigProg);
-    } else {
-      if (lineY >= 0 && lineY <= 63) u8g2.drawHLine(0, lineY, 128);
-      drawCard(cardCX, cardCY, cardSc);
-      if (titleY > 0 && titleY < 70) {
-        u8g2.setFont(u8g2_font_9x15_tf);
-        const char* ttl = "ABSENSI";
-        u8g2.drawStr((128 - u8g2.getStrWidth(ttl))/2, titleY, ttl);
-      }
-      if (subY > 0 && subY < 70) {
-        u8g2.setFont(u8g2_font_6x10_tf);
-        const char* sub = "ESP32  v2.0";
-        u8g2.drawStr((128 - u8g2.getStrWidth(sub))/2, subY, sub);
-      }
-      if (T >= 0.72f) {
-        u8g2.drawRFrame(4, 56, 120, 7, 2);
-        if (barW > 0) u8g2.drawBox(5, 57, barW, 5);
-        if (barP < 0.99f) {
-          int dotX = 5 + barW;
-          if (dotX < 122) u8g2.drawDisc(dotX, 59, 2);
-        }
-      }
-      if (showInfo) {
-        u8g2.setFont(u8g2_font_4x6_tf);
-        u8g2.drawStr((128 - u8g2.getStrWidth(infoBuf))/2, 53, infoBuf);
-      }
-    }
-    u8g2.sendBuffer();
-
-    unsigned long spent = millis() - now;
-    if (spent < FRAME_MS) delay(FRAME_MS - spent);
+  netStart();
+
+  // Splash jalan sebagai mode biasa (lihat bagian SPLASH) — DNS, HTTP &
+  // kartu sudah dilayani sejak frame pertama
+  esp_reset_reason_t rr = esp_reset_reason();
+  bool wdtReset = rr == ESP_RST_TASK_WDT || rr == ESP_RST_INT_WDT || rr == ESP_RST_WDT;
+  if (SPLASH_SKIP_ON_WDT && wdtReset) {
+    Serial.println("[BOOT] Reset watchdog, splash dilewati");
+    goTo(MODE_ATTEND);
+  } else {
+    goTo(MODE_SPLASH);
   }
-
-  u8g2.setDrawColor(2);
-  u8g2.drawBox(0, 0, 128, 64);
-  u8g2.sendBuffer();
-  delay(60);
-  u8g2.setDrawColor(1);
-  u8g2.clearBuffer();
-  u8g2.sendBuffer();
-  delay(40);
-
-  goTo(MODE_ATTEND);
-  lastAction = millis();
-  lastFrame  = millis();
-  Serial.printf("[BOOT] Siap. %d users.\n", userCount);
+  Serial.printf("[BOOT] Siap. %d users.\n", userDb.count());
 }
 
 // ┌──────────────────────────────────────────────────────┐
 //   MAIN LOOP
 // └──────────────────────────────────────────────────────┘
+// Core 1 — jaringan ada di netTask()
 void loop() {
-  dns.processNextRequest();
-  server.handleClient();
-  ws.loop();
-  readButtons();
-
+  uint32_t loopUs = micros();
   unsigned long now = millis();
-
-  static unsigned long idleRef = 0;
-  if (currentMode == MODE_ATTEND && now - idleRef > 1000) {
-    idleRef = now;
-    displayAttend();
-    wsBroadcastStatus();
-  }
-
-  if ((currentMode == MODE_ADMIN_REGISTER || currentMode == MODE_ADMIN_DELETE) &&
-       now - lastFrame > 380) {
-    lastFrame = now; dotStep = (dotStep+1) % 3;
-    if (currentMode == MODE_ADMIN_REGISTER) displayAdminScan("   REGISTER   ");
-    else                                    displayAdminScan("  HAPUS KARTU  ");
-  }
-
-  static unsigned long attendOKStart = 0;
-  if (currentMode == MODE_ATTEND_OK) {
-    static unsigned long lastBar = 0;
-    if (now - lastBar > 50) { lastBar = now; updateAttendOKBar(now - attendOKStart); }
-    if (now - attendOKStart > RESULT_TIMEOUT) goTo(MODE_ATTEND);
-  }
-
-  if (currentMode == MODE_ATTEND_FAIL && now - lastAction > RESULT_TIMEOUT)
-    goTo(MODE_ATTEND);
-
-  bool inAdmin = (currentMode == MODE_ADMIN_MENU     || currentMode == MODE_ADMIN_REGISTER ||
-                  currentMode == MODE_ADMIN_DELETE    || currentMode == MODE_ADMIN_DEL_CONFIRM);
-  if (inAdmin && now - lastAction > MENU_TIMEOUT) goTo(MODE_ATTEND);
-
-  if ((currentMode == MODE_RESULT_OK || currentMode == MODE_RESULT_FAIL) &&
-       now - lastAction > RESULT_TIMEOUT) goTo(MODE_ADMIN_MENU);
+  rfidService(now);            // kartu dulu: buzzer sebelum OLED & tombol
+  sched.run(now);              // nada buzzer, animasi OLED, timeout layar
+  readButtons();
+  userMutApply();
+  replApplyIn();
+  timeTick();
+  journalTick(now);
 
   // ── Tombol ────────────────────────────────────────────
   if (btnLHeld) {
@@ -905,7 +3551,7 @@ void loop() {
   }
 
   if (btnLPressed) {
-    beepClick(); lastAction = now;
+    beepClick(); touchMode();
     switch (currentMode) {
       case MODE_ADMIN_MENU:
         menuIndex = (menuIndex+1) % ADMIN_COUNT; displayAdminMenu(); break;
@@ -922,7 +3568,7 @@ void loop() {
   }
 
   if (btnRPressed) {
-    beepClick(); lastAction = now;
+    beepClick(); touchMode();
     switch (currentMode) {
       case MODE_ADMIN_MENU:
         if      (menuIndex==0) goTo(MODE_ADMIN_REGISTER);
@@ -930,14 +3576,13 @@ void loop() {
         break;
       case MODE_ADMIN_DEL_CONFIRM:
         if (deleteTarget >= 0) {
-          char dname[NAME_SIZE];
-          strncpy(dname, users[deleteTarget].name, NAME_SIZE);
+          User du; userDb.read(deleteTarget, du);
+          const char* dname = du.name;
           beepDelete();
           removeUser(deleteTarget);
           deleteTarget = -1;
-          wsBroadcastUsers();
           char sub[28]; snprintf(sub, 28, "%s dihapus", dname);
-          currentMode = MODE_RESULT_OK; lastAction = now;
+          setMode(MODE_RESULT_OK);
           displayResult(true, "Terhapus!", sub);
         }
         break;
@@ -947,70 +3592,6 @@ void loop() {
       default: break;
     }
   }
-
-  // ── RFID ──────────────────────────────────────────────
-  if (!rfid.PICC_IsNewCardPresent() || !rfid.PICC_ReadCardSerial()) return;
-  if (now - lastScan < SCAN_COOLDOWN) {
-    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
-  }
-  lastScan = now; lastAction = now;
-
-  byte*  uid   = rfid.uid.uidByte;
-  byte   uidSz = rfid.uid.size;
-  String uStr  = uidToStr(uid, uidSz);
-  Serial.printf("[RFID] %s\n", uStr.c_str());
-
-  if (currentMode == MODE_ATTEND || currentMode == MODE_ATTEND_OK ||
-      currentMode == MODE_ATTEND_FAIL) {
-    int idx = findUser(uid);
-    if (idx >= 0) {
-      beepOK();
-      addLog(users[idx].name, uStr.c_str());
-      wsBroadcastAttend(users[idx].name, uStr.c_str());
-      wsBroadcastStatus();
-      Serial.printf("[ABSEN] %s\n", users[idx].name);
-      displayAttendOK(users[idx].name);
-      currentMode = MODE_ATTEND_OK;
-      attendOKStart = millis(); lastAction = millis();
-    } else {
-      beepFail();
-      displayAttendFail(uStr.c_str());
-      currentMode = MODE_ATTEND_FAIL; lastAction = millis();
-    }
-    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
-  }
-
-  if (currentMode == MODE_ADMIN_REGISTER) {
-    int idx = findUser(uid);
-    if (idx >= 0) {
-      beepFail(); currentMode = MODE_RESULT_FAIL; lastAction = now;
-      displayResult(false, "Sudah Ada!", users[idx].name, uStr.c_str());
-    } else if (userCount >= MAX_USERS) {
-      beepFail(); currentMode = MODE_RESULT_FAIL; lastAction = now;
-      displayResult(false, "Penuh!", "Max 50 user");
-    } else {
-      addUser(uid);
-      beepOK();
-      wsBroadcastUsers(); wsBroadcastStatus();
-      Serial.printf("[REG] %s | %s\n", users[userCount-1].name, uStr.c_str());
-      currentMode = MODE_RESULT_OK; lastAction = now;
-      displayResult(true, users[userCount-1].name, "Terdaftar!", "Ganti nama di web");
-    }
-    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
-  }
-
-  if (currentMode == MODE_ADMIN_DELETE) {
-    int idx = findUser(uid);
-    if (idx >= 0) {
-      deleteTarget = idx; currentMode = MODE_ADMIN_DEL_CONFIRM;
-      lastAction = now; displayDeleteConfirm(idx);
-    } else {
-      beepFail(); currentMode = MODE_RESULT_FAIL; lastAction = now;
-      displayResult(false, "Tdk Dikenal!", uStr.c_str());
-    }
-    rfid.PICC_HaltA(); rfid.PCD_StopCrypto1(); return;
-  }
-
-  rfid.PICC_HaltA();
-  rfid.PCD_StopCrypto1();
+  metric[M_LOOP].add(micros() - loopUs);
 }
+
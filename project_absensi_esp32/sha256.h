@@ -0,0 +1,130 @@
+#pragma once
+/*
+ * sha256.h — SHA-256 (FIPS 180-4) dan HMAC-SHA256 (RFC 2104)
+ * Untuk autentikasi paket replikasi (user_repl.h). Kunci HMAC
+ * diproses sekali di setKey(): state ipad / opad disimpan, jadi
+ * satu tag = dua kompresi tambahan + data. verify() membandingkan
+ * tag dalam waktu konstan.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+class Sha256 {
+public:
+  static const size_t BLOCK = 64, DIGEST = 32;
+
+  Sha256() { init(); }
+
+  void init() {
+    static const uint32_t H0[8] = {
+      0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    memcpy(_h, H0, sizeof(_h));
+    _len = 0;
+    _n = 0;
+  }
+
+  void update(const void* data, size_t n) {
+    const uint8_t* p = (const uint8_t*)data;
+    _len += n;
+    while (n) {
+      size_t k = BLOCK - _n;
+      if (k > n) k = n;
+      memcpy(_buf + _n, p, k);
+      _n += k; p += k; n -= k;
+      if (_n == BLOCK) { block(_buf); _n = 0; }
+    }
+  }
+
+  void final(uint8_t out[DIGEST]) {
+    uint64_t bits = _len * 8;
+    uint8_t pad = 0x80;
+    update(&pad, 1);
+    pad = 0;
+    while (_n != BLOCK - 8) update(&pad, 1);
+    uint8_t be[8];
+    for (int i = 0; i < 8; i++) be[i] = (uint8_t)(bits >> (56 - 8 * i));
+    update(be, 8);
+    for (int i = 0; i < 8; i++) {
+      out[4 * i]     = (uint8_t)(_h[i] >> 24); out[4 * i + 1] = (uint8_t)(_h[i] >> 16);
+      out[4 * i + 2] = (uint8_t)(_h[i] >> 8);  out[4 * i + 3] = (uint8_t)_h[i];
+    }
+  }
+
+private:
+  static uint32_t ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+  void block(const uint8_t* b) {
+    static const uint32_t K[64] = {
+      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+      0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+      0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+      0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+      0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+      0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+      0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+      0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+      w[i] = (uint32_t)b[4 * i] << 24 | (uint32_t)b[4 * i + 1] << 16 | (uint32_t)b[4 * i + 2] << 8 | b[4 * i + 3];
+    for (int i = 16; i < 64; i++) {
+      uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = _h[0], bb = _h[1], c = _h[2], d = _h[3], e = _h[4], f = _h[5], g = _h[6], h = _h[7];
+    for (int i = 0; i < 64; i++) {
+      uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+      uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & bb) ^ (a & c) ^ (bb & c));
+      h = g; g = f; f = e; e = d + t1; d = c; c = bb; bb = a; a = t1 + t2;
+    }
+    _h[0] += a; _h[1] += bb; _h[2] += c; _h[3] += d; _h[4] += e; _h[5] += f; _h[6] += g; _h[7] += h;
+  }
+
+  uint32_t _h[8];
+  uint64_t _len;
+  uint8_t  _buf[BLOCK];
+  size_t   _n;
+};
+
+// Tag dipotong ke TAG byte (RFC 2104 §5: boleh, minimal separuh digest)
+template <size_t TAG>
+class HmacSha256 {
+  static_assert(TAG >= 16 && TAG <= Sha256::DIGEST, "TAG 16..32 byte");
+
+public:
+  void setKey(const void* key, size_t n) {
+    uint8_t k[Sha256::BLOCK] = {};
+    if (n > Sha256::BLOCK) { Sha256 s; s.update(key, n); s.final(k); }
+    else                   memcpy(k, key, n);
+    uint8_t pad[Sha256::BLOCK];
+    for (size_t i = 0; i < sizeof(pad); i++) pad[i] = k[i] ^ 0x36;
+    _in.init();  _in.update(pad, sizeof(pad));
+    for (size_t i = 0; i < sizeof(pad); i++) pad[i] = k[i] ^ 0x5c;
+    _out.init(); _out.update(pad, sizeof(pad));
+  }
+
+  void tag(const void* data, size_t n, uint8_t out[TAG]) const {
+    uint8_t d[Sha256::DIGEST];
+    Sha256 s = _in;
+    s.update(data, n);
+    s.final(d);
+    s = _out;
+    s.update(d, sizeof(d));
+    s.final(d);
+    memcpy(out, d, TAG);
+  }
+
+  bool verify(const void* data, size_t n, const uint8_t* t) const {
+    uint8_t mine[TAG];
+    tag(data, n, mine);
+    uint8_t diff = 0;
+    for (size_t i = 0; i < TAG; i++) diff |= mine[i] ^ t[i];
+    return !diff;
+  }
+
+private:
+  Sha256 _in, _out;
+};
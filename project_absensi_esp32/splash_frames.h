@@ -0,0 +1,83 @@
+#pragma once
+/*
+ * splash_frames.h — Tabel keyframe animasi splash, dihitung saat compile
+ * 100 frame × 33 ms (~3.3 detik). Semua easing float dievaluasi oleh
+ * compiler (constexpr), di runtime tinggal baca tabel di flash.
+ *   Fase 1 (big=1)  : kartu besar muncul + gelombang sinyal
+ *   Fase 2 (big=0)  : kartu mengecil ke pojok, garis, judul, sub judul,
+ *                     progress bar (bar=1), info (info=1)
+ * Ditulis C++11 (fungsi constexpr satu ekspresi) supaya cocok dengan
+ * toolchain Arduino-ESP32 lama. Tidak bergantung Arduino.
+ */
+
+#include <stdint.h>
+
+#define SPLASH_FRAMES    100
+#define SPLASH_FRAME_MS   33
+
+struct SplashFrame {
+  uint8_t big  : 1;      // fase 1 (kartu besar di tengah)
+  uint8_t bar  : 1;      // progress bar tampil (+ bunyi boot pertama kali)
+  uint8_t info : 1;      // teks info tampil
+  uint8_t dot  : 1;      // titik di ujung progress bar
+  uint8_t rings;         // jumlah cincin sinyal (fase 1)
+  uint8_t cardS;         // skala kartu × 100
+  int8_t  cardCX, cardCY;
+  int8_t  lineY, titleY, subY;
+  uint8_t barW;
+};
+
+namespace splash {
+
+constexpr float clampf(float v, float lo, float hi) { return v < lo ? lo : (v > hi ? hi : v); }
+constexpr float pow4(float x)                       { return x * x * x * x; }
+constexpr float easeOut(float t)                    { return 1.0f - pow4(1.0f - t); }
+constexpr float easeInOut(float t) {
+  return t < 0.5f ? 2*t*t : 1 - (-2*t+2)*(-2*t+2)/2;
+}
+constexpr float lerp(float a, float b, float t)     { return a + (b - a) * t; }
+
+// Fase animasi relatif terhadap T (0..1)
+constexpr float phase(float T, float from, float len) { return clampf((T - from) / len, 0.0f, 1.0f); }
+
+constexpr float cardIn(float T)  { return easeOut(phase(T, 0.00f, 0.12f)); }
+constexpr float sigT(float T)    { return phase(T, 0.12f, 0.33f); }
+constexpr float shrink(float T)  { return easeOut(phase(T, 0.40f, 0.20f)); }
+constexpr float barP(float T)    { return easeInOut(phase(T, 0.72f, 0.24f)); }
+
+constexpr uint8_t rings(float T) {
+  return sigT(T) <= 0.0f ? 0 :
+         (uint8_t)((easeInOut(sigT(T)) * 9.0f > 0.0f) + (easeInOut(sigT(T)) * 9.0f > 1.0f) +
+                   (easeInOut(sigT(T)) * 9.0f > 2.0f));
+}
+
+// Kartu: besar (64,31) → kecil (13,7) skala 0.45
+constexpr SplashFrame frame(float T) {
+  return SplashFrame{
+    T < 0.42f, T >= 0.72f, T >= 0.78f, barP(T) < 0.99f,
+    rings(T),
+    (uint8_t)(100.0f * (T < 0.42f ? cardIn(T) : lerp(cardIn(T), 0.45f, shrink(T)))),
+    (int8_t)lerp(64.0f, 13.0f, shrink(T)),
+    (int8_t)lerp(31.0f,  7.0f, shrink(T)),
+    (int8_t)(-2  + 17 * easeOut(phase(T, 0.45f, 0.20f))),
+    (int8_t)(-15 + 29 * easeOut(phase(T, 0.50f, 0.22f))),
+    (int8_t)(-8  + 50 * easeOut(phase(T, 0.58f, 0.20f))),
+    (uint8_t)(118.0f * barP(T))
+  };
+}
+
+// Index sequence ala C++11 untuk membangun tabel
+template <int... I> struct Seq {};
+template <int N, int... I> struct MakeSeq : MakeSeq<N - 1, N - 1, I...> {};
+template <int... I> struct MakeSeq<0, I...> { typedef Seq<I...> type; };
+
+struct Table { SplashFrame f[SPLASH_FRAMES]; };
+
+template <int... I>
+constexpr Table build(Seq<I...>) {
+  return Table{{ frame((float)I / SPLASH_FRAMES)... }};
+}
+
+} // namespace splash
+
+constexpr splash::Table SPLASH = splash::build(splash::MakeSeq<SPLASH_FRAMES>::type());
@@ -0,0 +1,47 @@
+#pragma once
+/*
+ * spsc_queue.h — Antrean lock-free 1 produsen / 1 konsumen
+ * Penghubung task UI (core 1) dan task jaringan (core 0):
+ *   produsen hanya menulis _head, konsumen hanya menulis _tail,
+ *   jadi tidak perlu mutex / critical section.
+ * N harus pangkat 2. Indeks 32-bit berjalan terus (wrap aman).
+ * Tidak bergantung Arduino — bisa di-compile di host.
+ */
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint32_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "N harus pangkat 2");
+
+public:
+  // Produsen. Penuh → false (item dibuang, drops() naik)
+  bool push(const T& v) {
+    uint32_t h = _head.load(std::memory_order_relaxed);
+    if (h - _tail.load(std::memory_order_acquire) == N) { _drops++; return false; }
+    _buf[h & (N - 1)] = v;
+    _head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Konsumen. Kosong → false
+  bool pop(T& v) {
+    uint32_t t = _tail.load(std::memory_order_relaxed);
+    if (t == _head.load(std::memory_order_acquire)) return false;
+    v = _buf[t & (N - 1)];
+    _tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t size() const {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+  uint32_t drops() const { return _drops; }
+
+private:
+  T                     _buf[N];
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+  uint32_t              _drops = 0;   // hanya ditulis produsen
+};
@@ -0,0 +1,133 @@
+#pragma once
+/*
+ * timer_wheel.h — Penjadwal timer non-blocking (hashed timer wheel)
+ * Pengganti delay() dan timer "static unsigned long" di loop():
+ *   after(ms, fn)  → sekali jalan
+ *   every(ms, fn)  → periodik (jadwal ulang dari tick akhir run(), tanpa
+ *                    burst sesudah loop() tertahan)
+ *   cancel(id)     → batalkan; id basi (sudah jalan / dibatalkan) diabaikan
+ *   run(nowMs)     → dipanggil tiap loop(). Jam diberikan pemanggil, jadi
+ *                    bisa diuji di host dengan jam palsu.
+ * Resolusi TICK_MS. Timer yang lebih jauh dari SLOTS tick tetap di slot-nya
+ * dan dicek tiap putaran. millis() wrap aman (hanya selisih yang dipakai).
+ * Untuk satu task saja (tidak thread-safe). Tidak bergantung Arduino.
+ */
+
+#include <stdint.h>
+
+typedef uint16_t TimerId;                  // (generasi << 8) | index timer
+static const TimerId TIMER_NONE = 0xFFFF;
+
+template <uint8_t TIMERS, uint16_t SLOTS, uint8_t TICK_MS>
+class TimerWheel {
+  static_assert(TIMERS < 255, "TIMERS maks 254");
+  static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS harus pangkat 2");
+
+public:
+  typedef void (*Fn)(void* arg);
+
+  TimerWheel() : _cur(0), _end(0), _lastMs(0), _started(false) {
+    for (uint8_t i = 0; i < TIMERS; i++) { _t[i].fn = nullptr; _t[i].gen = 0; }
+    for (uint16_t s = 0; s < SLOTS; s++) _head[s] = NIL;
+  }
+
+  TimerId after(uint32_t ms, Fn fn, void* arg = nullptr) { return add(ms, 0, fn, arg); }
+  TimerId every(uint32_t ms, Fn fn, void* arg = nullptr) { return add(ms, ms, fn, arg); }
+
+  bool active(TimerId id) const {
+    uint8_t i = id & 0xFF;
+    return i < TIMERS && _t[i].fn && _t[i].gen == (uint8_t)(id >> 8);
+  }
+
+  bool cancel(TimerId id) {
+    if (!active(id)) return false;
+    uint8_t i = id & 0xFF;
+    unlink(i);
+    release(i);
+    return true;
+  }
+
+  // Majukan jam ke nowMs, jalankan timer yang jatuh tempo
+  void run(uint32_t nowMs) {
+    if (!_started) { _lastMs = nowMs; _started = true; return; }
+    uint32_t n = (nowMs - _lastMs) / TICK_MS;
+    _lastMs += n * TICK_MS;
+    // Tertinggal > 1 putaran: cukup kunjungi tiap slot sekali
+    if (n > SLOTS) { _cur += n - SLOTS; n = SLOTS; }
+    _end = _cur + n;
+    while (n--) fire(++_cur);
+  }
+
+  uint8_t pending() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < TIMERS; i++) if (_t[i].fn) n++;
+    return n;
+  }
+
+private:
+  static const uint8_t  NIL  = 0xFF;
+  static const uint16_t MASK = SLOTS - 1;
+
+  struct Timer {
+    Fn       fn;          // nullptr = slot timer kosong
+    void*    arg;
+    uint32_t due;         // tick jatuh tempo
+    uint32_t period;      // ms, 0 = sekali
+    uint8_t  next;        // rantai dalam slot wheel
+    uint8_t  gen;         // naik tiap dilepas → TimerId lama jadi basi
+  };
+
+  static uint32_t ticksOf(uint32_t ms) {
+    uint32_t t = (ms + TICK_MS - 1) / TICK_MS;
+    return t ? t : 1;
+  }
+
+  TimerId add(uint32_t ms, uint32_t period, Fn fn, void* arg) {
+    if (!fn) return TIMER_NONE;
+    for (uint8_t i = 0; i < TIMERS; i++) {
+      if (_t[i].fn) continue;
+      Timer& t = _t[i];
+      t.fn = fn; t.arg = arg; t.period = period;
+      t.due = _end + ticksOf(ms);         // dari callback: relatif ke akhir run()
+      link(i);
+      return ((TimerId)t.gen << 8) | i;
+    }
+    return TIMER_NONE;
+  }
+
+  void link(uint8_t i) {
+    uint8_t& h = _head[_t[i].due & MASK];
+    _t[i].next = h;
+    h = i;
+  }
+
+  void unlink(uint8_t i) {
+    uint8_t* p = &_head[_t[i].due & MASK];
+    while (*p != NIL && *p != i) p = &_t[*p].next;
+    if (*p == i) *p = _t[i].next;
+  }
+
+  void release(uint8_t i) { _t[i].fn = nullptr; _t[i].gen++; }
+
+  void fire(uint32_t tick) {
+    uint8_t* p = &_head[tick & MASK];
+    while (*p != NIL) {
+      uint8_t i = *p;
+      Timer&  t = _t[i];
+      if ((int32_t)(t.due - tick) > 0) { p = &t.next; continue; }   // putaran berikutnya
+      *p = t.next;
+      Fn fn = t.fn; void* arg = t.arg;
+      if (t.period) { t.due = _end + ticksOf(t.period); link(i); }
+      else          release(i);
+      fn(arg);
+      p = &_head[tick & MASK];    // callback boleh mengubah rantai → mulai ulang
+    }
+  }
+
+  Timer    _t[TIMERS];
+  uint8_t  _head[SLOTS];
+  uint32_t _cur;          // tick terakhir yang sudah diproses
+  uint32_t _end;          // tick terakhir run() yang sedang berjalan
+  uint32_t _lastMs;
+  bool     _started;
+};
@@ -0,0 +1,119 @@
+#pragma once
+/*
+ * uid_index.h — Key UID panjang variabel + indeks hash UID → index user
+ * Key = UID 4/7/10 byte + panjangnya dipak ke 3 word 32-bit (96 bit):
+ *   w[0] = len<<24 | b0 b1 b2,  w[1] = b3..b6,  w[2] = b7 b8 b9 0
+ * Byte yang tidak dipakai selalu 0, jadi dua key sama ⇔ UID & panjang
+ * sama (tanpa tabrakan). 80 bit tidak cukup: UID 10 byte sudah 80 bit
+ * sebelum tag panjang. UID 4 byte (mayoritas kartu) hanya beda di w[0].
+ * Open addressing (linear probing).
+ * Tidak bergantung Arduino — bisa di-compile di host untuk benchmark.
+ *
+ *   Slot hanya menyimpan index (int16), key dibaca dari array keys[] yang
+ *   dense (urutan sama dengan users[]), jadi tabel tetap kecil & cache-friendly.
+ *   SLOTS harus pangkat 2, >= 2x jumlah user (load factor <= 0.5), <= 32768.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define UID_MAX 10               // ISO 14443-3: 4, 7 atau 10 byte
+
+struct UidKey {
+  uint32_t w[3];
+};
+
+inline bool operator==(const UidKey& a, const UidKey& b) {
+  return a.w[0] == b.w[0] && a.w[1] == b.w[1] && a.w[2] == b.w[2];
+}
+inline bool operator!=(const UidKey& a, const UidKey& b) { return !(a == b); }
+
+// len > UID_MAX dipotong — RC522 tidak pernah melaporkan lebih
+inline UidKey uidKeyOf(const uint8_t* uid, uint8_t len) {
+  if (len > UID_MAX) len = UID_MAX;
+  uint8_t b[12] = { len };
+  memcpy(b + 1, uid, len);
+  UidKey k;
+  for (int i = 0; i < 3; i++)
+    k.w[i] = ((uint32_t)b[i*4] << 24) | ((uint32_t)b[i*4+1] << 16) |
+             ((uint32_t)b[i*4+2] << 8) | b[i*4+3];
+  return k;
+}
+
+// Kebalikan uidKeyOf — return panjang UID, out minimal UID_MAX byte
+inline uint8_t uidKeyBytes(const UidKey& k, uint8_t* out) {
+  uint8_t len = k.w[0] >> 24;
+  if (len > UID_MAX) len = 0;
+  for (uint8_t i = 0; i < len; i++) out[i] = k.w[(i + 1) / 4] >> (24 - 8 * ((i + 1) % 4));
+  return len;
+}
+
+// Nilai bukan-UID (penanda jurnal: format, offset jam)
+inline UidKey uidKeyRaw(uint32_t v) { UidKey k = {{ v, 0, 0 }}; return k; }
+
+// Hash 32-bit (murmur3 fmix) — dipakai indeks, bloom jurnal, rekap, cooldown
+inline uint32_t uidKeyHash(const UidKey& k) {
+  uint32_t h = k.w[0] * 0x9E3779B1u ^ k.w[1] * 0x85EBCA77u ^ k.w[2] * 0xC2B2AE3Du;
+  h ^= h >> 16; h *= 0x85EBCA6Bu;
+  h ^= h >> 13; h *= 0xC2B2AE35u;
+  return h ^ (h >> 16);
+}
+
+template <uint32_t SLOTS>
+class UidIndex {
+  static_assert((SLOTS & (SLOTS - 1)) == 0 && SLOTS <= 32768, "SLOTS harus pangkat 2");
+
+public:
+  explicit UidIndex(const UidKey* keys) : _keys(keys) { clear(); }
+
+  void clear() { memset(_slot, 0xFF, sizeof(_slot)); }   // semua -1
+
+  // Return index user, -1 kalau tidak ada
+  int find(const UidKey& k) const {
+    for (uint16_t s = home(k);; s = (s + 1) & MASK) {
+      int16_t i = _slot[s];
+      if (i < 0)          return -1;
+      if (_keys[i] == k)  return i;
+    }
+  }
+
+  // keys[idx] harus sudah berisi k sebelum insert
+  void insert(const UidKey& k, int idx) {
+    uint16_t s = home(k);
+    while (_slot[s] >= 0) s = (s + 1) & MASK;
+    _slot[s] = (int16_t)idx;
+  }
+
+  // Hapus slot milik user idx (keys[idx] masih harus utuh saat dipanggil)
+  void erase(const UidKey& k, int idx) {
+    uint16_t s = home(k);
+    while (_slot[s] != idx) {
+      if (_slot[s] < 0) return;
+      s = (s + 1) & MASK;
+    }
+    // backward-shift delete — tanpa tombstone, probe tetap pendek
+    uint16_t hole = s;
+    for (uint16_t n = (s + 1) & MASK; _slot[n] >= 0; n = (n + 1) & MASK) {
+      uint16_t h = home(_keys[_slot[n]]);
+      if (((n - h) & MASK) >= ((n - hole) & MASK)) {
+        _slot[hole] = _slot[n];
+        hole = n;
+      }
+    }
+    _slot[hole] = -1;
+  }
+
+  // User k pindah posisi from → to (swap-remove di tabel user)
+  void relabel(const UidKey& k, int from, int to) {
+    for (uint16_t s = home(k); _slot[s] >= 0; s = (s + 1) & MASK)
+      if (_slot[s] == from) { _slot[s] = (int16_t)to; return; }
+  }
+
+private:
+  static const uint16_t MASK = SLOTS - 1;
+
+  static uint16_t home(const UidKey& k) { return (uint16_t)(uidKeyHash(k) & MASK); }
+
+  const UidKey* _keys;
+  int16_t       _slot[SLOTS];
+};
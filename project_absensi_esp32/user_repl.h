@@ -0,0 +1,454 @@
+#pragma once
+/*
+ * user_repl.h — Replikasi daftar user antar unit di satu lokasi
+ * Tiap record user membawa cap LWW {ver, origin}: ver = jam Lamport
+ * unit yang terakhir mengubahnya, origin = id unit (pemecah seri).
+ * Cap lebih besar menang; hapus = tombstone ber-cap, jadi urutan
+ * terima tidak berpengaruh dan semua unit konvergen.
+ * Tiap unit memberi nomor seq ke setiap perubahan di store-nya
+ * (lokal maupun hasil replikasi); log-nya ring terbatas. Pesan UDP,
+ * satu datagram per pesan (little-endian, seperti ESP32 & x86):
+ *   HELLO  tiap REPL_HELLO_MS: {epoch, seq} pengirim
+ *   PUSH   perubahan seq base+1..seq — broadcast saat terjadi, atau
+ *          unicast jawaban PULL. base > yang dikenal penerima = celah
+ *   PULL   minta perubahan sesudah seq S dari epoch E. Di luar log /
+ *          epoch beda → dijawab snapshot penuh (PUSH FULL ber-part,
+ *          paket terakhir LAST), lalu lanjut delta dari titik itu.
+ *          Part hilang → PULL FULL {titik snapshot, part}: dilanjutkan
+ *          dari part itu kalau store pengirim belum berubah
+ *   STALE  "record hidupmu ber-cap ≤ floor (seq, base) tidak kukenal —
+ *          mungkin sudah kuhapus, tombstone-nya tergusur". Penerima
+ *          mengambil snapshot penuh pengirim dengan penanda BEGIN / END
+ *          (record uidLen 0) dan menghapus user ber-cap ≤ floor yang
+ *          tidak ada di snapshot itu (lihat ReplTombs)
+ * epoch = acak per boot: seq mulai dari 0 lagi setelah reboot.
+ * Tiap datagram diakhiri tag HMAC-SHA256 (REPL_TAG byte) dengan kunci
+ * lokasi; paket tanpa tag yang cocok dibuang sebelum isinya dibaca.
+ * Paket sah yang diputar ulang tidak berbahaya: LWW idempoten.
+ * ReplNode tidak menyentuh store; semua lewat ReplIo (di ESP32 record
+ * masuk diantrekan ke task UI pemilik users.bin).
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host
+ * (tools/repl_node.cpp: beberapa instance lewat loopback).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "sha256.h"
+#include "user_store.h"
+
+#define REPL_MAGIC      0x52534241UL // "ABSR"
+#define REPL_PROTO      2            // 2: tag HMAC di ujung paket
+#define REPL_TAG        16           // byte tag HMAC-SHA256 (dipotong)
+#define REPL_PEERS      8
+#define REPL_MAX_RECS   28           // record per datagram (≤ 1200 B dengan tag)
+#define REPL_HELLO_MS   2000UL
+#define REPL_PULL_MS    1500UL       // jeda PULL ulang ke peer yang sama
+#define REPL_PEER_TTL  20000UL       // peer tanpa kabar selama ini dilupakan
+#define REPL_FULL_BURST 4            // paket snapshot per tick()
+#define REPL_FULL_TRIES 3            // snapshot diulang kalau store berubah di tengah jalan
+#define REPL_VER_JUMP   0x100000UL   // cap remote maksimum sejauh ini di depan jam lokal
+
+struct ReplStamp {
+  uint32_t ver;                      // jam Lamport
+  uint32_t origin;                   // id unit
+};
+
+inline bool replNewer(const ReplStamp& a, const ReplStamp& b) {
+  return a.ver != b.ver ? a.ver > b.ver : a.origin > b.origin;
+}
+
+// Jam lokasi naik satu per perubahan; cap yang melompat jauh ke depan
+// (bug / unit rusak) akan menyeret jam semua unit ke ujung uint32 lalu
+// membuat setiap perubahan berikutnya kalah → ditolak penerima.
+inline bool replSane(const ReplStamp& st, uint32_t clock) {
+  return st.ver <= clock || st.ver - clock <= REPL_VER_JUMP;
+}
+
+// Satu perubahan di kabel (40 B)
+struct ReplRec {
+  uint8_t   uid[UID_MAX];
+  uint8_t   uidLen;
+  uint8_t   deleted;                 // 1 = tombstone, name diabaikan
+  char      name[NAME_SIZE];
+  ReplStamp st;
+};
+
+enum ReplType : uint8_t { RP_HELLO = 1, RP_PULL, RP_PUSH, RP_STALE };
+
+// ReplRec.deleted untuk penanda rekonsiliasi (uidLen 0, st = floor);
+// hanya dibuat ReplNode penerima, tidak pernah dari kabel
+#define REPL_MARK_BEGIN 2
+#define REPL_MARK_END   3
+
+#define RPF_FULL 1                   // bagian snapshot penuh
+#define RPF_LAST 2                   // paket terakhir snapshot
+
+struct ReplHdr {
+  uint32_t magic;
+  uint8_t  proto, type, flags, count;  // count = record di paket PUSH
+  uint32_t site;                     // crc32 nama lokasi — lokasi lain diabaikan
+  uint32_t unit;                     // pengirim
+  uint32_t epoch;                    // pengirim
+  uint32_t seq;                      // HELLO: seq terakhir; PUSH: seq record terakhir
+                                     //   (FULL: titik snapshot); PULL: sejak
+                                     //   (PULL FULL: titik snapshot yang dilanjutkan)
+  uint32_t base;                     // PUSH: seq sebelum record pertama;
+                                     //   PULL: epoch target yang dikenal (0 = belum)
+  uint32_t target;                   // unit tujuan, 0 = semua
+  uint16_t part;                     // PUSH FULL: nomor paket; PULL FULL: part pertama yang hilang
+  uint16_t _rsv;
+};
+
+// ── Tombstone: UID yang dihapus + cap hapusnya ─────────
+// Penuh → tombstone tertua (ver terkecil) diganti dan cap-nya menaikkan
+// floor. UID tanpa user & tombstone dengan cap ≤ floor mungkin sudah
+// dihapus di sini (buried) → record hidupnya tidak diterapkan, pengirim
+// diminta rekonsiliasi (RP_STALE). Batasnya: perubahan ber-cap ≤ floor
+// dari unit yang terputus lebih lama dari N penghapusan tidak bisa
+// dibedakan dari user terhapus, jadi ikut hilang.
+struct ReplTomb {
+  UidKey    key;
+  ReplStamp st;
+};
+
+template <uint16_t N>
+class ReplTombs {
+public:
+  ReplTombs() : _n(0) { _floor.ver = _floor.origin = 0; }
+
+  int find(const UidKey& k) const {
+    for (uint16_t i = 0; i < _n; i++) if (_t[i].key == k) return i;
+    return -1;
+  }
+
+  void put(const UidKey& k, const ReplStamp& st) {
+    int i = find(k);
+    if (i < 0 && _n < N) i = _n++;
+    if (i < 0) {
+      i = 0;
+      for (uint16_t j = 1; j < N; j++) if (replNewer(_t[i].st, _t[j].st)) i = j;
+      if (!replNewer(st, _t[i].st)) { raise(st); return; }    // lebih tua dari semua: cukup floor
+      raise(_t[i].st);
+    }
+    _t[i].key = k; _t[i].st = st;
+  }
+
+  bool buried(const ReplStamp& st) const { return !replNewer(st, _floor); }
+
+  void erase(const UidKey& k) {
+    int i = find(k);
+    if (i >= 0) _t[i] = _t[--_n];
+  }
+
+  uint16_t        count() const      { return _n; }
+  const ReplTomb& at(uint16_t i) const { return _t[i]; }
+  static uint16_t capacity()         { return N; }
+  const ReplStamp& floor() const     { return _floor; }
+
+  // Isi dari file (pemanggil sudah cek CRC)
+  ReplTomb* data()                   { return _t; }
+  void      setCount(uint16_t n)     { _n = n > N ? N : n; }
+  void      setFloor(const ReplStamp& st) { _floor = st; }
+
+private:
+  void raise(const ReplStamp& st) { if (replNewer(st, _floor)) _floor = st; }
+
+  ReplTomb  _t[N];
+  uint16_t  _n;
+  ReplStamp _floor;                  // cap tombstone tergusur terbaru
+};
+
+// ── Antarmuka ke store & jaringan (disediakan pemanggil) ──
+struct ReplIo {
+  void     (*send)(uint32_t ip, uint16_t port, const uint8_t* d, size_t n);  // ip 0 = semua peer
+  uint32_t (*seq)();                                  // seq perubahan terakhir
+  bool     (*change)(uint32_t seq, ReplRec& r);       // perubahan ke-seq; false = sudah keluar log
+  bool     (*snap)(uint32_t i, ReplRec& r);           // record ke-i snapshot; false = habis
+  bool     (*deliver)(uint32_t from, const ReplRec* r, uint8_t n);  // terapkan (LWW); false = penuh, coba lagi nanti
+};
+
+struct ReplPeer {
+  uint32_t      unit;                // 0 = slot kosong
+  uint32_t      ip;
+  uint16_t      port;
+  uint16_t      fullPart;            // part snapshot berikutnya yang ditunggu
+  uint32_t      fullEpoch, fullAt;   // snapshot yang sedang diterima (epoch, titik seq)
+  uint32_t      epoch, known;        // seq peer yang sudah diterapkan berurutan
+  uint32_t      advEpoch, adv;       // epoch / seq terakhir yang diumumkan peer
+  bool          synced;              // known berlaku untuk epoch
+  bool          inFull;
+  bool          reconcile;           // peer minta rekonsiliasi: snapshot berikutnya diberi penanda
+  ReplStamp     sweepFloor;          // floor dari STALE peer
+  unsigned long heard, pulled, staled;
+};
+
+struct ReplStats {
+  uint32_t pushes, pulls, fulls;     // paket PUSH dikirim, PULL dikirim, snapshot dilayani
+  uint32_t records;                  // record remote diteruskan ke deliver()
+  uint32_t gaps, busy;               // celah seq terdeteksi, deliver() penuh
+  uint32_t forged;                   // paket dengan tag HMAC salah (dibuang)
+  uint32_t stales;                   // STALE dikirim
+};
+
+class ReplNode {
+public:
+  ReplNode() : _unit(0), _site(0), _epoch(0), _port(0), _sent(0), _helloAt(0) {
+    memset(_peer, 0, sizeof(_peer));
+    memset(&_job, 0, sizeof(_job));
+    memset(&_st, 0, sizeof(_st));
+  }
+
+  // Perubahan sebelum begin() (mis. impor saat boot) hanya sampai lewat snapshot.
+  // key = kunci rahasia lokasi, sama di semua unit
+  void begin(uint32_t unit, uint32_t site, uint32_t epoch, uint16_t port, const ReplIo& io,
+             const void* key, size_t keyLen) {
+    _unit = unit; _site = site; _epoch = epoch; _port = port; _io = io;
+    _mac.setKey(key, keyLen);
+    _sent = _io.seq();
+  }
+
+  uint32_t         unit()  const { return _unit; }
+  uint32_t         epoch() const { return _epoch; }
+  const ReplStats& stats() const { return _st; }
+  const ReplPeer&  peer(uint8_t i) const { return _peer[i]; }
+  static uint8_t   peerSlots()   { return REPL_PEERS; }
+
+  void onPacket(uint32_t ip, uint16_t port, const uint8_t* d, size_t n, unsigned long now) {
+    if (n < sizeof(ReplHdr) + REPL_TAG) return;
+    ReplHdr h;
+    memcpy(&h, d, sizeof(h));
+    if (h.magic != REPL_MAGIC || h.proto != REPL_PROTO || h.site != _site || h.unit == _unit) return;
+    if (h.target && h.target != _unit) return;
+    n -= REPL_TAG;
+    if (!_mac.verify(d, n, d + n)) { _st.forged++; return; }
+    ReplPeer* p = peerOf(h.unit, now);
+    if (!p) return;
+    p->ip = ip; p->port = port; p->heard = now;
+    if (h.type == RP_PULL) { onPull(*p, h); return; }
+    if (h.type == RP_STALE) {
+      p->reconcile = true; p->sweepFloor.ver = h.seq; p->sweepFloor.origin = h.base;
+      p->synced = false; p->inFull = false;            // snapshot baru dari part 0
+      p->pulled = now - REPL_PULL_MS;
+      return;
+    }
+    bool delta = h.type == RP_PUSH && !(h.flags & RPF_FULL);
+    if (h.type == RP_HELLO || (delta && (h.epoch != p->advEpoch || h.seq > p->adv))) {
+      p->advEpoch = h.epoch; p->adv = h.seq;
+    }
+    if (h.type != RP_PUSH || n < sizeof(ReplHdr) + (size_t)h.count * sizeof(ReplRec)) return;
+    // Record disalin supaya rata (buffer UDP belum tentu 4-aligned)
+    ReplRec r[REPL_MAX_RECS];
+    uint8_t cnt = h.count > REPL_MAX_RECS ? REPL_MAX_RECS : h.count;
+    memcpy(r, d + sizeof(ReplHdr), cnt * sizeof(ReplRec));
+    for (uint8_t i = 0; i < cnt; i++) if (!r[i].uidLen) r[i].deleted = 0;   // bukan penanda
+    if (h.flags & RPF_FULL) onFull(*p, h, r, cnt);
+    else                    onDelta(*p, h, r, cnt);
+  }
+
+  // Record hidup dari unit ini terkubur di bawah floor tombstone kita →
+  // minta unit itu rekonsiliasi dengan snapshot kita (maks. sekali per REPL_PULL_MS)
+  void stale(uint32_t unit, const ReplStamp& floor, unsigned long now) {
+    for (uint8_t i = 0; i < REPL_PEERS; i++) {
+      ReplPeer& p = _peer[i];
+      if (p.unit != unit || now - p.staled < REPL_PULL_MS) continue;
+      p.staled = now;
+      ReplHdr h = header(RP_STALE, unit);
+      h.seq = floor.ver; h.base = floor.origin;
+      _st.stales++;
+      emitHdr(p.ip, p.port, h);
+    }
+  }
+
+  // Panggil sesering mungkin (tiap putaran task jaringan)
+  void tick(unsigned long now) {
+    uint32_t s = _io.seq();
+    if (s != _sent) { sendChanges(0, 0, 0, _sent, s); _sent = s; }
+    if (now - _helloAt >= REPL_HELLO_MS) { _helloAt = now; hello(); }
+    if (_job.active) fullStep();
+    for (uint8_t i = 0; i < REPL_PEERS; i++) {
+      ReplPeer& p = _peer[i];
+      if (!p.unit) continue;
+      if (now - p.heard > REPL_PEER_TTL) { p.unit = 0; continue; }
+      bool behind = !p.synced || p.advEpoch != p.epoch || p.adv > p.known;
+      if (behind && now - p.pulled >= REPL_PULL_MS) pull(p, now);
+    }
+  }
+
+private:
+  struct FullJob {
+    bool     active;
+    uint32_t ip;
+    uint16_t port, part;
+    uint32_t unit, next, seqAt;
+    uint8_t  tries;
+  };
+
+  ReplPeer* peerOf(uint32_t unit, unsigned long now) {
+    ReplPeer* free = nullptr;
+    for (uint8_t i = 0; i < REPL_PEERS; i++) {
+      if (_peer[i].unit == unit) return &_peer[i];
+      if (!_peer[i].unit && !free) free = &_peer[i];
+    }
+    if (free) {
+      memset(free, 0, sizeof(*free));
+      free->unit = unit;
+      free->pulled = now - REPL_PULL_MS;   // boleh langsung PULL
+      free->staled = now - REPL_PULL_MS;
+    }
+    return free;
+  }
+
+  ReplHdr header(ReplType type, uint32_t target) const {
+    ReplHdr h;
+    memset(&h, 0, sizeof(h));
+    h.magic = REPL_MAGIC; h.proto = REPL_PROTO; h.type = type;
+    h.site = _site; h.unit = _unit; h.epoch = _epoch; h.target = target;
+    return h;
+  }
+
+  // buf: n byte paket + REPL_TAG byte ruang untuk tag
+  void emit(uint32_t ip, uint16_t port, uint8_t* buf, size_t n) {
+    _mac.tag(buf, n, buf + n);
+    _io.send(ip, port, buf, n + REPL_TAG);
+  }
+
+  void emitHdr(uint32_t ip, uint16_t port, const ReplHdr& h) {
+    uint8_t buf[sizeof(ReplHdr) + REPL_TAG];
+    memcpy(buf, &h, sizeof(h));
+    emit(ip, port, buf, sizeof(h));
+  }
+
+  void hello() {
+    ReplHdr h = header(RP_HELLO, 0);
+    h.seq = _io.seq();
+    emitHdr(0, _port, h);
+  }
+
+  void pull(ReplPeer& p, unsigned long now) {
+    ReplHdr h = header(RP_PULL, p.unit);
+    bool delta = p.synced && p.epoch == p.advEpoch;
+    h.seq  = delta ? p.known : 0;
+    h.base = delta ? p.epoch : 0;
+    if (p.inFull && p.fullEpoch == p.advEpoch) {
+      h.flags = RPF_FULL; h.seq = p.fullAt; h.part = p.fullPart;
+    }
+    p.pulled = now;
+    _st.pulls++;
+    emitHdr(p.ip, p.port, h);
+  }
+
+  // Perubahan from+1..to per paket; yang sudah keluar log dilewati
+  // (penerima melihat celah lalu PULL → snapshot)
+  void sendChanges(uint32_t ip, uint16_t port, uint32_t target, uint32_t from, uint32_t to) {
+    uint8_t buf[sizeof(ReplHdr) + REPL_MAX_RECS * sizeof(ReplRec) + REPL_TAG];
+    ReplHdr h = header(RP_PUSH, target);
+    ReplRec* r = (ReplRec*)(buf + sizeof(ReplHdr));
+    h.base = from;
+    for (uint32_t s = from; s != to; ) {
+      s++;
+      bool ok = _io.change(s, r[h.count]);
+      if (ok) { h.count++; h.seq = s; }
+      if (h.count && (!ok || h.count == REPL_MAX_RECS || s == to)) {
+        memcpy(buf, &h, sizeof(h));
+        emit(ip, port, buf, sizeof(ReplHdr) + h.count * sizeof(ReplRec));
+        _st.pushes++;
+        h.count = 0;
+      }
+      if (!h.count) h.base = s;
+    }
+  }
+
+  void onPull(ReplPeer& p, const ReplHdr& h) {
+    uint32_t s = _io.seq();
+    ReplRec r;
+    bool delta = h.base == _epoch && h.seq <= s && (h.seq == s || _io.change(h.seq + 1, r));
+    if (delta) { sendChanges(p.ip, p.port, p.unit, h.seq, s); return; }
+    if (_job.active && _job.unit != p.unit) return;      // satu snapshot sekaligus; peer PULL ulang
+    // Lanjutan hanya kalau index belum bergeser (tidak ada perubahan sejak titik snapshot)
+    bool resume = (h.flags & RPF_FULL) && h.seq == s;
+    _job.active = true; _job.ip = p.ip; _job.port = p.port; _job.unit = p.unit;
+    _job.part  = resume ? h.part : 0;
+    _job.next  = (uint32_t)_job.part * REPL_MAX_RECS;    // part selain terakhir selalu penuh
+    _job.seqAt = s; _job.tries = 0;
+    if (!resume) _st.fulls++;
+  }
+
+  void fullStep() {
+    uint8_t buf[sizeof(ReplHdr) + REPL_MAX_RECS * sizeof(ReplRec) + REPL_TAG];
+    ReplRec* r = (ReplRec*)(buf + sizeof(ReplHdr));
+    for (uint8_t k = 0; k < REPL_FULL_BURST && _job.active; k++) {
+      ReplHdr h = header(RP_PUSH, _job.unit);
+      h.flags = RPF_FULL; h.part = _job.part++; h.seq = _job.seqAt;
+      bool end = false;
+      while (h.count < REPL_MAX_RECS && !(end = !_io.snap(_job.next, r[h.count]))) { h.count++; _job.next++; }
+      if (end) {
+        // Store berubah selama snapshot (swap-remove menggeser index) → ulang dari part 0
+        uint32_t s = _io.seq();
+        if (s != _job.seqAt && ++_job.tries < REPL_FULL_TRIES) {
+          _job.next = 0; _job.part = 0; _job.seqAt = s;
+          end = false;
+        } else {
+          h.flags |= RPF_LAST;
+          _job.active = false;
+        }
+      }
+      if (h.count || end) {
+        memcpy(buf, &h, sizeof(h));
+        emit(_job.ip, _job.port, buf, sizeof(ReplHdr) + h.count * sizeof(ReplRec));
+        _st.pushes++;
+      }
+    }
+  }
+
+  void onFull(ReplPeer& p, const ReplHdr& h, const ReplRec* r, uint8_t n) {
+    if (!p.inFull || h.epoch != p.fullEpoch || h.seq != p.fullAt) {
+      if (h.part != 0) return;
+      p.inFull = true; p.fullEpoch = h.epoch; p.fullAt = h.seq; p.fullPart = 0;
+    }
+    if (h.part != p.fullPart) return;                    // paket hilang → PULL FULL dari fullPart
+    // Rekonsiliasi: penanda ikut deliver() yang sama dengan record di sekitarnya
+    bool last = h.flags & RPF_LAST;
+    ReplRec b[REPL_MAX_RECS + 2];
+    uint8_t m = 0;
+    if (p.reconcile && h.part == 0) mark(b[m++], REPL_MARK_BEGIN, p.sweepFloor);
+    memcpy(b + m, r, n * sizeof(ReplRec));
+    m += n;
+    if (p.reconcile && last) mark(b[m++], REPL_MARK_END, p.sweepFloor);
+    if (m && !_io.deliver(p.unit, b, m)) { _st.busy++; return; }
+    _st.records += n;
+    p.fullPart++;
+    if (last) {
+      p.inFull = false; p.synced = true; p.reconcile = false;
+      p.epoch = h.epoch; p.known = h.seq;
+      if (p.advEpoch != h.epoch) { p.advEpoch = h.epoch; p.adv = h.seq; }
+    }
+  }
+
+  void onDelta(ReplPeer& p, const ReplHdr& h, const ReplRec* r, uint8_t n) {
+    if (!p.synced || h.epoch != p.epoch) return;          // belum punya titik awal → PULL di tick()
+    if (h.base > p.known) { _st.gaps++; return; }
+    if (h.seq <= p.known) return;
+    uint32_t skip = p.known - h.base;
+    if (skip > n) return;
+    if (!_io.deliver(p.unit, r + skip, n - skip)) { _st.busy++; return; }
+    _st.records += n - skip;
+    p.known = h.seq;
+  }
+
+  static void mark(ReplRec& r, uint8_t type, const ReplStamp& floor) {
+    memset(&r, 0, sizeof(r));
+    r.deleted = type;
+    r.st = floor;
+  }
+
+  ReplIo        _io;
+  HmacSha256<REPL_TAG> _mac;
+  uint32_t      _unit, _site, _epoch;
+  uint16_t      _port;
+  uint32_t      _sent;               // seq terakhir yang sudah di-broadcast
+  unsigned long _helloAt;
+  ReplPeer      _peer[REPL_PEERS];
+  FullJob       _job;
+  ReplStats     _st;
+};
@@ -0,0 +1,229 @@
+#pragma once
+/*
+ * user_store.h — Daftar user di /users.bin (record biner fixed-width)
+ *   [DbHeader 16B][DbRecord 44B][DbRecord 44B]...
+ *   DbRecord = uid[10] + uidLen + name[20] + cap LWW + crc32
+ *   Edit di tempat: tambah = tulis 1 record + header,
+ *   rename = tulis 1 record, hapus = record terakhir
+ *   pindah ke slot yang dihapus (swap-remove) + header.
+ *   RAM hanya menyimpan keys[] + indeks hash; nama dibaca
+ *   dari file saat dibutuhkan.
+ * F = tipe file dengan seek/read/write/flush seperti fs::File
+ * (di host: file palsu di RAM). Buka/migrasi file tetap urusan
+ * pemanggil. Kunci antar task lewat setLock().
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "uid_index.h"
+
+#define NAME_SIZE 20
+#define UID_STR   (UID_MAX * 3)  // "AA:BB:..:JJ" + '\0'
+
+#define DB_MAGIC    0x55534241UL // "ABSU"
+#define DB_VERSION  3            // 1 = UID 4 byte, 2 = tanpa cap (dimigrasi pemanggil)
+
+struct User {
+  uint8_t  uid[UID_MAX];
+  uint8_t  uidLen;               // 4, 7 atau 10 (sisa uid[] = 0)
+  uint8_t  _rsv;                 // 0
+  char     name[NAME_SIZE];
+  uint32_t ver;                  // cap replikasi LWW (user_repl.h): jam Lamport
+  uint32_t origin;               //   + id unit yang terakhir mengubah
+};
+
+struct DbHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recSize;
+  uint32_t count;
+  uint32_t crc;                  // crc32 12 byte pertama
+};
+
+struct DbRecord {
+  User     u;
+  uint32_t crc;                  // crc32 dari u
+};
+
+// v2: User tanpa _rsv & cap; crc32 dari 31 byte pertama
+struct DbRecordV2 {
+  uint8_t  uid[UID_MAX];
+  uint8_t  uidLen;
+  char     name[NAME_SIZE];
+  uint32_t crc;
+};
+
+struct DbRecordV1 {
+  uint8_t  uid[4];
+  char     name[NAME_SIZE];
+  uint32_t crc;
+};
+
+// CRC-32 (IEEE) bitwise — dipakai juga record jurnal
+inline uint32_t crc32(const void* data, size_t len, uint32_t crc = 0) {
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+inline DbHeader dbHeaderOf(uint32_t count) {
+  DbHeader h = { DB_MAGIC, DB_VERSION, (uint16_t)sizeof(DbRecord), count, 0 };
+  h.crc = crc32(&h, offsetof(DbHeader, crc));
+  return h;
+}
+
+// "AA:BB:CC:DD[:..]" — out minimal size*3 byte
+inline void uidFmt(char* out, const uint8_t* uid, uint8_t size) {
+  static const char HEXD[] = "0123456789ABCDEF";
+  for (uint8_t i = 0; i < size; i++) {
+    *out++ = HEXD[uid[i] >> 4];
+    *out++ = HEXD[uid[i] & 0xF];
+    if (i + 1 < size) *out++ = ':';
+  }
+  *out = '\0';
+}
+
+// Kebalikan uidFmt; return panjang UID (0 = tidak valid)
+inline uint8_t strToUid(const char* str, uint8_t* uid) {
+  uint8_t n = 0;
+  memset(uid, 0, UID_MAX);
+  while (n < UID_MAX && isxdigit((unsigned char)str[0]) && isxdigit((unsigned char)str[1])) {
+    char h[3] = { str[0], str[1], '\0' };
+    uid[n++] = (uint8_t)strtol(h, nullptr, 16);
+    str += 2;
+    if (*str != ':') break;
+    str++;
+  }
+  return n;
+}
+
+template <class F, int MAX, uint32_t SLOTS>
+class UserStore {
+public:
+  UserStore() : _index(&_keys[0]), _count(0), _writes(0), _maxVer(0), _lock(nullptr), _unlock(nullptr) {}
+
+  // File dibaca satu task & ditulis task lain → seek + read/write satu paket
+  void setLock(void (*lock)(), void (*unlock)()) { _lock = lock; _unlock = unlock; }
+
+  F&             file()              { return _f; }
+  int            count() const       { return _count; }
+  const UidKey&  key(int i) const    { return _keys[i]; }
+  int            find(const UidKey& k) const { return _index.find(k); }
+  static int     capacity()          { return MAX; }
+  uint32_t       writes() const      { return _writes; }   // write ke file sejak boot
+  uint32_t       maxVer() const      { return _maxVer; }   // cap ver terbesar yang pernah ditulis / dimuat
+
+  bool writeHeader() {
+    DbHeader h = dbHeaderOf((uint32_t)_count);
+    lock();
+    _f.seek(0);
+    bool ok = _f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+    _f.flush();
+    _writes++;
+    unlock();
+    return ok;
+  }
+
+  bool writeUser(int idx, const User& u) {
+    DbRecord r; r.u = u; r.crc = crc32(&r.u, sizeof(User));
+    if (u.ver > _maxVer) _maxVer = u.ver;
+    lock();
+    _f.seek(offset(idx));
+    bool ok = _f.write((const uint8_t*)&r, sizeof(r)) == sizeof(r);
+    _f.flush();
+    _writes++;
+    unlock();
+    return ok;
+  }
+
+  bool readRecord(int idx, DbRecord& r) {
+    lock();
+    bool ok = _f.seek(offset(idx)) &&
+              _f.read((uint8_t*)&r, sizeof(r)) == sizeof(r);
+    unlock();
+    return ok && r.crc == crc32(&r.u, sizeof(User));
+  }
+
+  // Record rusak / di luar daftar → nama "?" supaya UI tetap jalan
+  bool read(int idx, User& u) {
+    DbRecord r;
+    if (idx >= 0 && idx < _count && readRecord(idx, r)) {
+      u = r.u; u.name[NAME_SIZE-1] = '\0';
+      return true;
+    }
+    memset(&u, 0, sizeof(u));
+    strcpy(u.name, "?");
+    return false;
+  }
+
+  // total record dari header yang valid. Record rusak / UID dobel
+  // (mis. mati listrik di tengah swap-remove) dibuang dan sisanya
+  // dipadatkan di tempat; header ditulis ulang kalau ada yang dibuang.
+  void load(uint32_t total, bool dirty) {
+    _count = 0;
+    _index.clear();
+    if (total > (uint32_t)MAX) total = MAX;
+    DbRecord r;
+    for (uint32_t i = 0; i < total; i++) {
+      if (!readRecord(i, r))      { dirty = true; continue; }
+      UidKey k = uidKeyOf(r.u.uid, r.u.uidLen);
+      if (_index.find(k) >= 0)    { dirty = true; continue; }
+      if (r.u.ver > _maxVer) _maxVer = r.u.ver;
+      if ((int)i != _count) writeUser(_count, r.u);
+      _keys[_count] = k;
+      _index.insert(k, _count);
+      _count++;
+    }
+    if (dirty) writeHeader();
+  }
+
+  // Record dulu, baru header. Return index baru, -1 = dobel / penuh / gagal
+  int add(const User& u, bool header) {
+    UidKey k = uidKeyOf(u.uid, u.uidLen);
+    if (_index.find(k) >= 0 || _count >= MAX || !writeUser(_count, u)) return -1;
+    _keys[_count] = k;
+    _index.insert(k, _count);
+    _count++;
+    if (header) writeHeader();
+    return _count - 1;
+  }
+
+  // Swap-remove: user terakhir mengisi slot idx, jadi cukup 1 record + header
+  bool remove(int idx) {
+    if (idx < 0 || idx >= _count) return false;
+    int last = _count - 1;
+    _index.erase(_keys[idx], idx);
+    if (idx != last) {
+      User u;
+      read(last, u);
+      writeUser(idx, u);
+      _index.relabel(_keys[last], last, idx);
+      _keys[idx] = _keys[last];
+    }
+    _count--;
+    writeHeader();
+    return true;
+  }
+
+private:
+  static size_t offset(int idx) { return sizeof(DbHeader) + (size_t)idx * sizeof(DbRecord); }
+  void lock()   { if (_lock)   _lock();   }
+  void unlock() { if (_unlock) _unlock(); }
+
+  F                   _f;
+  UidKey              _keys[MAX];        // urutan = record di file
+  UidIndex<SLOTS>     _index;
+  int                 _count;
+  uint32_t            _writes;
+  uint32_t            _maxVer;
+  void              (*_lock)();
+  void              (*_unlock)();
+};
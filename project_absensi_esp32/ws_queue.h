@@ -0,0 +1,119 @@
+#pragma once
+/*
+ * ws_queue.h — Antrean kirim per client WebSocket (byte ring tetap)
+ * Frame disimpan berurutan: [WsFrameHdr 4B][payload, dibulatkan 4].
+ * Frame yang tidak muat di ujung buffer mulai lagi dari offset 0
+ * (sisa ujung dilewati), jadi payload selalu satu potong utuh dan
+ * bisa langsung dikirim tanpa salin.
+ * Frame ber-key (mis. status) menggantikan frame key sama yang
+ * belum terkirim: yang lama ditandai mati, hanya yang terbaru jalan.
+ * Penuh → push() false; kebijakan (putus client) urusan pemanggil.
+ * Tidak bergantung Arduino — bisa di-compile & diuji di host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define WQ_KEYS 4                // key 1..WQ_KEYS-1, 0 = tanpa penggabungan
+
+struct WsFrameHdr {
+  uint16_t len;
+  uint8_t  flags;
+  uint8_t  key;
+};
+
+#define WQ_BIN  1
+#define WQ_DEAD 2                // digantikan frame key sama yang lebih baru
+#define WQ_WRAP 4                // penanda: frame berikutnya di offset 0
+
+template <uint16_t BYTES>
+class WsQueue {
+  static_assert(BYTES % 4 == 0 && BYTES <= 32768, "BYTES kelipatan 4, maks 32 KB");
+
+public:
+  WsQueue() : _drops(0), _coalesced(0), _peak(0) { clear(); }
+
+  void clear() {
+    _head = _tail = 0;
+    _frames = 0;
+    memset(_keyAt, 0xFF, sizeof(_keyAt));
+  }
+
+  // Muat frame len byte sekarang?
+  bool fits(uint16_t len) const { uint16_t at; return place(need(len), at); }
+
+  bool push(const void* d, uint16_t len, bool bin, uint8_t key) {
+    uint16_t at, n = need(len);
+    if (!_frames) _head = _tail = 0;
+    if (!place(n, at)) { _drops++; return false; }
+    if (at != _tail) hdr(_tail) = { 0, WQ_WRAP, 0 };   // _tail < BYTES di sini (lihat place)
+    if (key && _keyAt[key] != NONE) { hdr(_keyAt[key]).flags |= WQ_DEAD; _coalesced++; }
+    hdr(at) = { len, (uint8_t)(bin ? WQ_BIN : 0), key };
+    memcpy(_buf + at + sizeof(WsFrameHdr), d, len);
+    if (key) _keyAt[key] = at;
+    _tail = at + n;
+    if (_tail == BYTES) _tail = 0;
+    _frames++;
+    if (bytes() > _peak) _peak = bytes();
+    return true;
+  }
+
+  // Frame hidup terdepan; frame mati dibuang sambil jalan
+  bool front(const uint8_t*& d, uint16_t& len, bool& bin) {
+    while (_frames) {
+      if (hdr(_head).flags & WQ_WRAP) _head = 0;
+      const WsFrameHdr& h = hdr(_head);
+      if (h.flags & WQ_DEAD) { pop(); continue; }
+      d = _buf + _head + sizeof(WsFrameHdr); len = h.len; bin = h.flags & WQ_BIN;
+      return true;
+    }
+    return false;
+  }
+
+  void pop() {
+    if (!_frames) return;
+    if (hdr(_head).flags & WQ_WRAP) _head = 0;
+    const WsFrameHdr& h = hdr(_head);
+    if (h.key && _keyAt[h.key] == _head) _keyAt[h.key] = NONE;
+    _head += need(h.len);
+    if (_head == BYTES) _head = 0;
+    if (!--_frames) _head = _tail = 0;
+  }
+
+  uint16_t frames() const { return _frames; }            // termasuk yang mati
+  uint16_t bytes()  const {
+    if (!_frames) return 0;
+    return _tail > _head ? _tail - _head : BYTES - _head + _tail;
+  }
+  static uint16_t capacity() { return BYTES; }
+  uint16_t peak()      const { return _peak; }
+  uint32_t drops()     const { return _drops; }          // push gagal karena penuh
+  uint32_t coalesced() const { return _coalesced; }      // frame digantikan yang lebih baru
+
+private:
+  static const uint16_t NONE = 0xFFFF;
+
+  static uint16_t need(uint16_t len) { return sizeof(WsFrameHdr) + ((len + 3) & ~3); }
+
+  // Offset tulis untuk n byte. Data di [head, tail) atau, kalau sudah
+  // memutar, [head, BYTES) + [0, tail). head == tail berarti penuh
+  // kalau ada frame.
+  bool place(uint16_t n, uint16_t& at) const {
+    if (!_frames) { at = 0; return n <= BYTES; }
+    if (_tail > _head) {
+      if (BYTES - _tail >= n) { at = _tail; return true; }
+      at = 0;
+      return _head >= n;
+    }
+    at = _tail;
+    return _head - _tail >= n;
+  }
+
+  WsFrameHdr& hdr(uint16_t at) { return *(WsFrameHdr*)(_buf + at); }
+
+  alignas(4) uint8_t _buf[BYTES];
+  uint16_t _head, _tail, _frames;
+  uint16_t _keyAt[WQ_KEYS];
+  uint32_t _drops, _coalesced;
+  uint16_t _peak;
+};
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""
+gzip_page.py — Bangun halaman_gz.h dari halaman.h
+
+  HTML_PAGE (halaman.h) → minify ringan → gzip -9 → array PROGMEM
+  + ETag (hash isi) untuk If-None-Match / 304.
+
+Jalankan ulang setiap kali halaman.h diubah:
+  python3 tools/gzip_page.py
+Hanya pakai library standar Python 3.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC  = os.path.join(ROOT, "project_absensi_esp32", "halaman.h")
+DST  = os.path.join(ROOT, "project_absensi_esp32", "halaman_gz.h")
+
+
+def extract(text):
+    m = re.search(r'R"rawhtml\((.*)\)rawhtml"', text, re.S)
+    if not m:
+        sys.exit("HTML_PAGE tidak ditemukan di halaman.h")
+    return m.group(1)
+
+
+# Minify konservatif: hanya yang pasti aman untuk HTML/CSS/JS di halaman ini.
+#   - komentar <!-- --> dan /* */ (khusus di dalam <style>)
+#   - baris komentar JS yang diawali //
+#   - indentasi & baris kosong. Baris baru tetap ada (ASI JavaScript).
+def minify(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+
+    def css(m):
+        body = re.sub(r"/\*.*?\*/", "", m.group(2), flags=re.S)
+        body = re.sub(r"\s*([{};:,>])\s*", r"\1", body)
+        return m.group(1) + body + m.group(3)
+    html = re.sub(r"(<style>)(.*?)(</style>)", css, html, flags=re.S)
+
+    out = []
+    for line in html.split("\n"):
+        s = line.strip()
+        if not s or s.startswith("//"):
+            continue
+        out.append(s)
+    return "\n".join(out)
+
+
+def main():
+    with open(SRC, encoding="utf-8") as f:
+        page = extract(f.read())
+    raw  = page.encode("utf-8")
+    mini = minify(page).encode("utf-8")
+    gz   = gzip.compress(mini, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(mini).hexdigest()[:16]
+
+    rows = []
+    for i in range(0, len(gz), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+
+    with open(DST, "w", encoding="utf-8", newline="\n") as f:
+        f.write("#pragma once\n")
+        f.write("/*\n")
+        f.write(" * halaman_gz.h — DIBUAT OTOMATIS oleh tools/gzip_page.py, jangan diedit.\n")
+        f.write(" * Sumber: HTML_PAGE di halaman.h → minify → gzip -9\n")
+        f.write(" *   asli %d B → minify %d B → gzip %d B\n" % (len(raw), len(mini), len(gz)))
+        f.write(" */\n\n")
+        f.write("#define HTML_PAGE_GZ_LEN %d\n" % len(gz))
+        f.write('#define HTML_PAGE_ETAG   "\\"%s\\""\n\n' % etag)
+        f.write("const uint8_t HTML_PAGE_GZ[] PROGMEM = {\n")
+        f.write("\n".join(rows) + "\n")
+        f.write("};\n")
+
+    print("halaman_gz.h: %d B → %d B minify → %d B gzip (%.1f%%), ETag %s"
+          % (len(raw), len(mini), len(gz), 100.0 * len(gz) / len(raw), etag))
+
+
+if __name__ == "__main__":
+    main()
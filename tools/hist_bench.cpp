@@ -0,0 +1,191 @@
+/*
+ * hist_bench.cpp — Ukuran & kecepatan arsip riwayat (hist_codec.h) di host
+ * Membangkitkan tap sintetis (karyawan × hari kerja: masuk pagi,
+ * pulang sore, sebagian tap dobel / tidak masuk), mengarsipkannya
+ * persis seperti task net di ESP32 (kamus UID di "flash" + blok
+ * HIST_BLOCK tap), lalu mengukur:
+ *   - byte/tap: jurnal mentah, ring RAM, arsip kolom
+ *   - baca kamus per tap (probe hash di file, tanpa salinan RAM)
+ *   - dekode saja dan dekode + baris CSV (nama, UID, epoch, waktu)
+ * Hasil dekode dibandingkan dengan input (berhenti kalau beda).
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I project_absensi_esp32 tools/hist_bench.cpp -o /tmp/hist_bench
+ *   (ukuran blok lain: -DHIST_BLOCK=512)
+ * Pakai:
+ *   /tmp/hist_bench [KARYAWAN=2000] [HARI=90] [SEED=1]
+ * Karyawan > KEY_SLOTS / 2 (= MAX_USERS): UID sisanya ditulis inline
+ * (ref 0), byte/tap naik.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "civil_time.h"
+#include "log_ring.h"
+#include "hist_codec.h"
+
+#ifndef HIST_BLOCK
+#define HIST_BLOCK 256           // sama dengan sketch
+#endif
+#define KEY_SLOTS  4096          // = HIST_KEY_SLOTS
+#define HIST_MAX_KB 640          // = sketch
+#define TZ_MIN     420           // WIB
+#define JOURNAL_REC 24           // sizeof(JournalRec) di sketch
+
+struct Tap {
+  UidKey   key;
+  uint32_t ts;
+};
+
+// keys.bin di RAM: seek/read/write seperti fs::File, hitung baca
+struct MemFile {
+  std::vector<uint8_t> d;
+  size_t pos = 0, reads = 0;
+  bool   seek(size_t p) { pos = p; return p <= d.size(); }
+  size_t read(uint8_t* b, size_t n) {
+    reads++;
+    n = std::min(n, d.size() - std::min(pos, d.size()));
+    memcpy(b, d.data() + pos, n);
+    pos += n;
+    return n;
+  }
+  size_t write(const uint8_t* b, size_t n) {
+    if (pos + n > d.size()) d.resize(pos + n);
+    memcpy(d.data() + pos, b, n);
+    pos += n;
+    return n;
+  }
+  void flush() {}
+};
+
+static HistKeys<MemFile, KEY_SLOTS> dict;
+static HistEncoder<HIST_BLOCK>      enc;
+
+static double secsSince(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char** argv) {
+  int employees = argc > 1 ? atoi(argv[1]) : 2000;
+  int days      = argc > 2 ? atoi(argv[2]) : 90;
+  std::mt19937 rng(argc > 3 ? atoi(argv[3]) : 1);
+
+  // Karyawan: 80% kartu 4 byte, sisanya 7 byte; nama "Karyawan N"
+  std::vector<UidKey> staff(employees);
+  std::vector<std::string> names(employees);
+  for (int i = 0; i < employees; i++) {
+    uint8_t uid[UID_MAX];
+    uint8_t len = rng() % 5 ? 4 : 7;
+    for (uint8_t b = 0; b < len; b++) uid[b] = (uint8_t)rng();
+    staff[i] = uidKeyOf(uid, len);
+    names[i] = "Karyawan " + std::to_string(i + 1);
+  }
+
+  // Hari kerja Senin–Jumat mulai 2026-01-05 (Senin) 00:00 WIB
+  CivilTime start = { 2026, 1, 5, 0, 0, 0 };
+  uint32_t t0 = epochOf(start) - TZ_MIN * 60;
+  std::normal_distribution<double> arrive(7.5 * 3600, 1200), leave(17 * 3600, 1800);
+  std::vector<Tap> taps;
+  std::vector<Tap> day;
+  for (int d = 0; d < days; d++) {
+    if (d % 7 >= 5) continue;
+    day.clear();
+    uint32_t base = t0 + d * 86400UL;
+    for (int i = 0; i < employees; i++) {
+      if (rng() % 100 < 5) continue;                          // cuti / sakit
+      uint32_t a = base + (uint32_t)std::max(0.0, arrive(rng));
+      uint32_t b = base + (uint32_t)std::max(12.0 * 3600, leave(rng));
+      day.push_back({ staff[i], a });
+      if (rng() % 100 < 5) day.push_back({ staff[i], a + 3 + (uint32_t)(rng() % 60) });   // tap dobel
+      day.push_back({ staff[i], b });
+    }
+    std::stable_sort(day.begin(), day.end(), [](const Tap& x, const Tap& y) { return x.ts < y.ts; });
+    taps.insert(taps.end(), day.begin(), day.end());
+  }
+  if (taps.empty()) { fprintf(stderr, "tidak ada tap\n"); return 1; }
+
+  // Arsip: sama dengan histAdd()/histFlushBlock() di sketch
+  dict.file().d.assign(dict.FILE_SIZE, 0);   // = histKeysLoad() file baru
+  std::vector<uint8_t> file;
+  size_t blocks = 0;
+  auto flush = [&]() {
+    HistBlockHdr h;
+    const uint8_t* p = enc.pack(h);
+    file.insert(file.end(), (uint8_t*)&h, (uint8_t*)&h + sizeof(h));
+    file.insert(file.end(), p, p + h.len);
+    blocks++;
+  };
+  auto tEnc = std::chrono::steady_clock::now();
+  for (const Tap& t : taps) {
+    enc.add(dict.add(t.key) + 1, t.key, t.ts);
+    if (enc.full()) flush();
+  }
+  if (enc.taps()) flush();
+  double encS = secsSince(tEnc);
+  double probes = (double)dict.file().reads / taps.size();
+
+  // Nama di-resolve saat ekspor: slot kamus → index karyawan (di ESP32:
+  // indeks hash users.bin + baca record)
+  std::vector<int> owner(KEY_SLOTS, -1);
+  for (uint32_t s = 0; s < KEY_SLOTS; s++) {
+    UidKey k;
+    if (dict.key(s, k)) owner[s] = (int)(std::find(staff.begin(), staff.end(), k) - staff.begin());
+  }
+
+  size_t csvBytes = 0, decoded = 0;
+  char line[96], uid[UID_STR], when[32];
+  double decS = 0, csvS = 0;
+  for (int pass = 0; pass < 2; pass++) {                      // 0 = dekode saja, 1 = + CSV
+    auto tp = std::chrono::steady_clock::now();
+    size_t at = 0, k = 0, no = 0;
+    while (at < file.size()) {
+      HistBlockHdr h;
+      memcpy(&h, &file[at], sizeof(h));
+      const uint8_t* payload = &file[at + sizeof(h)];
+      if (!histCheck(h, payload)) { fprintf(stderr, "blok rusak di %zu\n", at); return 1; }
+      at += sizeof(h) + h.len;
+      HistReader rd(h, payload);
+      uint32_t ref, ts;
+      UidKey key;
+      while (rd.next(ref, key, ts)) {
+        if (ref && !dict.key(ref - 1, key)) { fprintf(stderr, "slot %u kosong\n", ref - 1); return 1; }
+        if (key != taps[k].key || ts != taps[k].ts) { fprintf(stderr, "tap %zu beda\n", k); return 1; }
+        k++;
+        if (!pass) continue;
+        CivilTime c = civilOf(ts + TZ_MIN * 60);
+        snprintf(when, sizeof(when), "%04u-%02u-%02u %02u:%02u:%02u",
+                 c.year, c.month, c.day, c.hour, c.minute, c.second);
+        uint8_t b[UID_MAX];
+        uidFmt(uid, b, uidKeyBytes(key, b));
+        int n = snprintf(line, sizeof(line), "%zu,%s,%s,%u,%s\r\n", ++no,
+                         ref ? names[owner[ref - 1]].c_str() : "?", uid, ts, when);
+        csvBytes += n;
+      }
+    }
+    if (k != taps.size()) { fprintf(stderr, "%zu dari %zu tap terbaca\n", k, taps.size()); return 1; }
+    (pass ? csvS : decS) = secsSince(tp);
+    decoded = k;
+  }
+
+  double n = (double)taps.size();
+  printf("tap          : %zu (%d karyawan, %d hari, %zu blok × %d)\n",
+         taps.size(), employees, days, blocks, HIST_BLOCK);
+  printf("kamus UID    : %u UID, keys.bin %zu KB di flash, 0 byte RAM, %.2f baca/tap saat arsip\n",
+         (unsigned)dict.count(), dict.FILE_SIZE / 1024, probes);
+  printf("byte/tap     : jurnal %d, ring RAM %zu, arsip %.2f\n", JOURNAL_REC, sizeof(LogEntry), file.size() / n);
+  printf("arsip        : %zu KB (jurnal mentah %zu KB, %.1fx lebih kecil)\n",
+         file.size() / 1024, taps.size() * JOURNAL_REC / 1024, taps.size() * JOURNAL_REC / (double)file.size());
+  printf("arsip %d KB : ~%.0f tap = ~%.1f bulan untuk %d karyawan\n", HIST_MAX_KB,
+         HIST_MAX_KB * 1024.0 / (file.size() / n), HIST_MAX_KB * 1024.0 / file.size() * days / 30.4, employees);
+  printf("encode       : %.1f Mtap/s\n", n / encS / 1e6);
+  printf("dekode       : %.1f Mtap/s\n", decoded / decS / 1e6);
+  printf("dekode + CSV : %.1f Mtap/s, %.1f MB/s CSV (%zu MB)\n",
+         decoded / csvS / 1e6, csvBytes / csvS / 1e6, csvBytes >> 20);
+  return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * hist_test.cpp — arsip /hist di build host
+ * Dua segmen jurnal penuh → histStep() mengarsip yang sudah ditutup
+ * (kamus UID di keys.bin, tanpa salinan RAM) → CSV dari arsip + jurnal
+ * memuat semua tap tepat sekali, juga sesudah boot ulang. Riwayat
+ * lebih panjang dari JOURNAL_SEGMENTS: semua halaman /api/logs (jurnal
+ * lalu arsip) = semua tap, terbaru dulu, tepat sekali; filter user +
+ * rentang waktu di segmen yang hanya ada di arsip.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R hist_test)
+ */
+
+#include "host_sketch.h"
+
+#include <vector>
+
+static const char* FS = "hist_fs";
+#define USERS 50
+#define TAPS  (2 * JOURNAL_SEG_RECS + 100)
+
+static size_t csvRows(const std::string& rsp) {
+  std::string body = hostBody(rsp);
+  return std::count(body.begin(), body.end(), '\n') - 1;      // tanpa baris judul
+}
+
+static void archive() {
+  hostBoot(FS);
+  hostEnroll(USERS);
+  for (uint32_t i = 0; i < TAPS; i++) journalAppend(userDb.key(i % USERS), i % USERS, EPOCH_MIN + i * 60);
+  journalFlush();
+  CHECK(jrnSeq == 3);
+  for (int i = 0; i < 200 && histDone < 2; i++) netRound();
+  CHECK(histDone == 2);
+  CHECK(histKeys.count() == USERS);
+  CHECK(histBytes > 0 && histBytes < 2 * JOURNAL_SEG_RECS * 4);      // ±3 byte/tap
+  CHECK(csvRows(hostHttp("GET", "/api/logs/csv")) == TAPS);
+}
+
+static void reboot() {
+  hostBoot(FS, false);
+  CHECK(histDone == 2);
+  CHECK(histKeys.count() == USERS);
+  CHECK(csvRows(hostHttp("GET", "/api/logs/csv")) == TAPS);
+  // rentang waktu: hanya tap di blok arsip pertama yang cocok
+  char q[64];
+  snprintf(q, sizeof(q), "/api/logs/csv?from=%lu&to=%lu", EPOCH_MIN, EPOCH_MIN + 99 * 60);
+  CHECK(csvRows(hostHttp("GET", q)) == 100);
+}
+
+// ts semua item /api/logs, mengikuti "next" sampai null
+static std::vector<uint32_t> logsAll(const std::string& query) {
+  std::vector<uint32_t> ts;
+  std::string cursor;
+  for (;;) {
+    std::string path = "/api/logs?limit=" + std::to_string(LOG_PAGE_MAX) + query + cursor;
+    std::string body = hostBody(hostHttp("GET", path.c_str()));
+    for (size_t at = body.find("\"ts\":"); at != std::string::npos; at = body.find("\"ts\":", at + 1))
+      ts.push_back(strtoul(body.c_str() + at + 5, nullptr, 10));
+    size_t at = body.rfind("\"next\":");
+    CHECK(at != std::string::npos);
+    if (!body.compare(at + 7, 4, "null")) return ts;
+    cursor = "&cursor=" + std::to_string(strtoul(body.c_str() + at + 7, nullptr, 10));
+  }
+}
+
+#define LONG_TAPS ((JOURNAL_SEGMENTS + 2) * JOURNAL_SEG_RECS)
+
+static void paging() {
+  hostBoot("hist_long_fs");
+  hostEnroll(USERS);
+  for (uint32_t i = 0; i < LONG_TAPS; i++) {
+    journalAppend(userDb.key(i % USERS), i % USERS, EPOCH_MIN + i * 60);
+    while (jrnSeq > histDone + JOURNAL_SEGMENTS - 1) netRound();   // arsip mengejar
+  }
+  journalFlush();
+  CHECK(histFirst == 1 && jrnFirstSeq > 2);                       // segmen 1..2 hanya di arsip
+
+  std::vector<uint32_t> ts = logsAll("");
+  CHECK(ts.size() == LONG_TAPS);
+  for (uint32_t i = 0; i < LONG_TAPS; i++) CHECK(ts[i] == EPOCH_MIN + (LONG_TAPS - 1 - i) * 60);
+
+  char q[96], uid[UID_STR];
+  uint8_t b[4];
+  hostUid(7, b);
+  uidFmt(uid, b, 4);
+  snprintf(q, sizeof(q), "&from=%lu&to=%lu&user=%s", EPOCH_MIN, EPOCH_MIN + 999 * 60, uid);
+  ts = logsAll(q);
+  CHECK(ts.size() == 1000 / USERS);
+  for (size_t i = 0; i < ts.size(); i++) CHECK(ts[i] == EPOCH_MIN + (950 + 7 - i * USERS) * 60);
+}
+
+int main() {
+  CHECK(hostFork(archive) == 0);
+  CHECK(hostFork(reboot) == 0);
+  CHECK(hostFork(paging) == 0);
+  printf("hist_test OK\n");
+  return 0;
+}
@@ -0,0 +1,132 @@
+#pragma once
+/*
+ * host_sketch.h — sketch absensi di dalam test / benchmark host
+ * Meng-include sketch.cpp hasil tools/ino2cpp.py (lihat CMakeLists.txt),
+ * jadi semua global sketch (userDb, logRing, jrn*, hist*, …) bisa
+ * dipakai langsung. Jam manual, tanpa thread: test memanggil loop()
+ * dan netRound() sendiri lewat hostRun().
+ *
+ *   hostBoot("dir")      flash kosong di dir, setup(), layar absen
+ *   hostUid(i, uid)      UID 4 byte unik untuk user ke-i
+ *   hostEnroll(n)        n user langsung ke users.bin
+ *   hostRun(ms)          loop() + netRound() tiap 1 ms jam palsu
+ *   hostHttp / hostRaw   request ke server sketch, tunggu respons utuh
+ *
+ * setup() hanya boleh sekali per proses (global sketch); test yang
+ * perlu boot ulang / listrik mati memakai fork() — lihat HOST_POWER_CUT.
+ */
+
+#include "sketch.cpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CHECK(c) do { if (!(c)) { \
+  fprintf(stderr, "%s:%d: CHECK gagal: %s\n", __FILE__, __LINE__, #c); exit(1); } } while (0)
+
+inline void hostUid(uint32_t i, uint8_t uid[4]) {
+  uint32_t h = (i + 1) * 2654435761u;          // sebar seperti kartu sungguhan
+  uid[0] = (uint8_t)(h >> 24); uid[1] = (uint8_t)(h >> 16);
+  uid[2] = (uint8_t)(h >> 8);  uid[3] = (uint8_t)h;
+}
+
+// Port jaringan per proses: ctest -j menjalankan beberapa test sekaligus
+inline void hostBoot(const char* dir, bool wipe = true) {
+  hostFsRoot = dir;
+  if (wipe) LittleFS.format();
+  hostPortBase = (uint16_t)(20000 + (getpid() % 400) * 100);
+  hostClockManual(true);
+  hostTasksThreaded(false);
+  hostSerialQuiet(true);
+  setup();
+  goTo(MODE_ATTEND);
+}
+
+inline void hostRun(unsigned long ms) {
+  for (unsigned long i = 0; i < ms; i++) {
+    loop();
+    netRound();
+    hostClockAdvance(1000);
+  }
+}
+
+inline void hostEnroll(uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) {
+    User u;
+    memset(&u, 0, sizeof(u));
+    hostUid(i, u.uid);
+    u.uidLen = 4;
+    snprintf(u.name, NAME_SIZE, "User %u", (unsigned)i);
+    ReplStamp st = replStampNew();
+    u.ver = st.ver; u.origin = st.origin;
+    userDb.add(u, false);
+  }
+  userDb.writeHeader();
+}
+
+// Socket TCP ke port ESP32 port (server sketch); -1 = gagal
+inline int hostConnect(uint16_t port = 80) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(hostPort(port));
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr*)&a, sizeof(a))) { close(fd); return -1; }
+  return fd;
+}
+
+// Kirim req apa adanya; netRound() diputar sampai server menutup
+// koneksi. Kembalikan seluruh respons (header + body).
+inline std::string hostRaw(const std::string& req) {
+  int fd = hostConnect();
+  if (fd < 0) return "";
+  send(fd, req.data(), req.size(), 0);
+  std::string rsp;
+  for (int idle = 0; idle < 2000; idle++) {
+    netRound();
+    hostClockAdvance(1000);
+    char b[4096];
+    ssize_t k = recv(fd, b, sizeof(b), MSG_DONTWAIT);
+    if (k == 0) break;
+    if (k > 0) { rsp.append(b, k); idle = 0; }
+  }
+  close(fd);
+  return rsp;
+}
+
+// Request HTTP/1.1 biasa (Host = AP_DOMAIN, Connection: close)
+inline std::string hostHttp(const char* method, const char* path, const char* body = "") {
+  char req[512];
+  snprintf(req, sizeof(req), "%s %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n"
+           "Content-Length: %u\r\n\r\n%s", method, path, AP_DOMAIN, (unsigned)strlen(body), body);
+  return hostRaw(req);
+}
+
+// Body respons hostHttp(): header dibuang, chunked di-decode
+inline std::string hostBody(const std::string& rsp) {
+  size_t at = rsp.find("\r\n\r\n");
+  if (at == std::string::npos) return "";
+  at += 4;
+  if (rsp.find("Transfer-Encoding: chunked") > at) return rsp.substr(at);
+  std::string body;
+  for (;;) {
+    size_t n = strtoul(rsp.c_str() + at, nullptr, 16), eol = rsp.find("\r\n", at);
+    if (!n || eol == std::string::npos) break;
+    body.append(rsp, eol + 2, n);
+    at = eol + 2 + n + 2;
+  }
+  return body;
+}
+
+// Jalankan fn di proses anak; kembalikan status keluarnya
+template <class Fn> int hostFork(Fn fn) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) { fn(); fflush(stdout); _exit(0); }
+  int st = 0;
+  waitpid(pid, &st, 0);
+  return WIFEXITED(st) ? WEXITSTATUS(st) : -1;
+}
@@ -0,0 +1,57 @@
+/*
+ * host_smoke_test.cpp — sketch utuh di build host, satu siklus:
+ * boot flash kosong → daftar user → tap dikenal / tak dikenal →
+ * jurnal di-flush → boot ulang (proses baru) → user & tap masih ada,
+ * dilayani lewat HTTP.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R host_smoke)
+ */
+
+#include "host_sketch.h"
+
+static const char* FS = "smoke_fs";
+
+static void firstBoot() {
+  hostBoot(FS);
+  hostEnroll(3);
+  CHECK(userDb.count() == 3);
+
+  uint8_t uid[4];
+  hostUid(1, uid);
+  hostCardTap(uid, 4);
+  hostRun(5);
+  CHECK(currentMode == MODE_ATTEND_OK);
+  CHECK(logRing.count() == 1);
+  CHECK(tapStat.count == 1);
+
+  uint8_t stranger[4] = { 0xDE, 0xAD, 0xBE, 0xEF };
+  hostRun(SCAN_COOLDOWN);
+  hostCardTap(stranger, 4);
+  hostRun(5);
+  CHECK(currentMode == MODE_ATTEND_FAIL);
+  CHECK(logRing.count() == 1);
+
+  hostRun(JOURNAL_FLUSH_MS + 10);
+  CHECK(jrnSegRecs >= 2);                         // penanda boot + tap
+
+  std::string root = hostHttp("GET", "/");
+  CHECK(root.compare(0, 12, "HTTP/1.1 200") == 0);
+}
+
+static void secondBoot() {
+  hostBoot(FS, false);
+  CHECK(userDb.count() == 3);
+  CHECK(bootNo == 1);
+  std::string logs = hostHttp("GET", "/api/logs");
+  CHECK(logs.compare(0, 12, "HTTP/1.1 200") == 0);
+  CHECK(logs.find("User 1") != std::string::npos);
+  std::string csv = hostHttp("GET", "/api/logs/csv");
+  CHECK(csv.find("\"User 1\"") != std::string::npos);
+}
+
+int main() {
+  CHECK(hostFork(firstBoot) == 0);
+  CHECK(hostFork(secondBoot) == 0);
+  printf("host_smoke_test OK\n");
+  return 0;
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+http_load.py — Uji beban HTTP: banyak client paralel + probe captive
+
+  1. Buka N client (thread) dengan koneksi keep-alive masing-masing.
+  2. Tiap client mengulang campuran request selama --seconds:
+       probe captive (Host asing, /generate_204 → 302 jalur cepat),
+       /api/stats/ws (JSON kecil), / (dashboard, revalidasi ETag → 304).
+  3. Opsional --csv: satu client terus mengunduh /api/logs/csv, jadi
+     terlihat apakah probe ikut antre di belakang download besar.
+  4. Cetak jumlah, error, latensi p50/p99/max per jenis request,
+     ditambah counter absensi_http_* dari /api/metrics.
+
+Contoh (laptop terkonek ke AP AbsensiESP32):
+  python3 tools/http_load.py --clients 50 --seconds 20 --csv
+Slot koneksi di perangkat HTTP_CONNS (6): client lebih dari itu
+bergiliran — keep-alive yang diam dilepas, sisanya dapat 503 (dihitung).
+Hanya pakai library standar Python 3.
+"""
+
+import argparse
+import http.client
+import threading
+import time
+
+KINDS = ("captive", "api", "page", "csv")
+
+
+class Client(threading.Thread):
+    """Satu koneksi keep-alive; sambung ulang kalau ditutup server."""
+
+    def __init__(self, host, until, csv):
+        super().__init__(daemon=True)
+        self.host, self.until, self.csv = host, until, csv
+        self.lat = {k: [] for k in KINDS}
+        self.err = {k: 0 for k in KINDS}
+        self.busy = 0
+        self.etag = None
+        self.conn = None
+
+    def request(self, kind, path, headers):
+        if self.conn is None:
+            self.conn = http.client.HTTPConnection(self.host, 80, timeout=10)
+        t = time.perf_counter()
+        try:
+            self.conn.request("GET", path, headers=headers)
+            r = self.conn.getresponse()
+            body = r.read()
+            if r.will_close:
+                self.conn.close()
+                self.conn = None
+        except (OSError, http.client.HTTPException):
+            self.err[kind] += 1
+            if self.conn:
+                self.conn.close()
+            self.conn = None
+            return None, None
+        self.lat[kind].append(time.perf_counter() - t)
+        if r.status == 503:
+            self.busy += 1
+        return r, body
+
+    def run(self):
+        i = 0
+        while time.time() < self.until:
+            if self.csv:
+                self.request("csv", "/api/logs/csv", {})
+                continue
+            step = i % 4
+            i += 1
+            if step in (0, 2):
+                self.request("captive", "/generate_204", {"Host": "connectivitycheck.gstatic.com"})
+            elif step == 1:
+                self.request("api", "/api/stats/ws", {})
+            else:
+                h = {"Accept-Encoding": "gzip"}
+                if self.etag:
+                    h["If-None-Match"] = self.etag
+                r, _ = self.request("page", "/", h)
+                if r is not None and r.getheader("ETag"):
+                    self.etag = r.getheader("ETag")
+
+
+def pct(xs, p):
+    if not xs:
+        return 0.0
+    xs = sorted(xs)
+    return xs[min(len(xs) - 1, int(len(xs) * p / 100))] * 1000
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("--host", default="192.168.4.1")
+    ap.add_argument("--clients", type=int, default=50)
+    ap.add_argument("--seconds", type=float, default=20)
+    ap.add_argument("--csv", action="store_true", help="tambah 1 client unduh CSV terus-menerus")
+    a = ap.parse_args()
+
+    until = time.time() + a.seconds
+    clients = [Client(a.host, until, False) for _ in range(a.clients)]
+    if a.csv:
+        clients.append(Client(a.host, until, True))
+    for c in clients:
+        c.start()
+    for c in clients:
+        c.join(a.seconds + 15)
+
+    print("%d client, %.0f detik" % (a.clients, a.seconds))
+    print("  %-8s %7s %6s %9s %9s %9s" % ("jenis", "jumlah", "error", "p50 ms", "p99 ms", "max ms"))
+    for k in KINDS:
+        lat = [x for c in clients for x in c.lat[k]]
+        err = sum(c.err[k] for c in clients)
+        if not lat and not err:
+            continue
+        print("  %-8s %7d %6d %9.1f %9.1f %9.1f"
+              % (k, len(lat), err, pct(lat, 50), pct(lat, 99), max(lat) * 1000 if lat else 0))
+    print("  503 (slot penuh): %d" % sum(c.busy for c in clients))
+
+    try:
+        conn = http.client.HTTPConnection(a.host, 80, timeout=10)
+        conn.request("GET", "/api/metrics")
+        text = conn.getresponse().read().decode()
+        print("Perangkat (/api/metrics)")
+        for line in text.splitlines():
+            if line.startswith("absensi_http_") and "_bucket" not in line:
+                print("  " + line)
+    except (OSError, http.client.HTTPException) as e:
+        print("gagal baca /api/metrics: %s" % e)
+
+
+if __name__ == "__main__":
+    main()
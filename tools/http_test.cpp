@@ -0,0 +1,170 @@
+/*
+ * http_test.cpp — server HTTP sketch di build host
+ * Client yang berhenti membaca di tengah CSV besar tidak menahan
+ * putaran task net (DNS, request lain, WS tetap dilayani); CSV tetap
+ * utuh sesudah client lanjut membaca, arsip menunggu selama ekspor.
+ * HEAD tanpa body / framing chunk; batas header & body sendiri;
+ * body chunked / encoding lain ditolak 411 / 501. JSON statistik
+ * (/api/repl dengan REPL_PEERS peer, /api/stats/ws, /api/stats/tap) utuh dan
+ * Content-Length sama dengan body.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R http_test)
+ */
+
+#include "host_sketch.h"
+
+#include <chrono>
+#include <poll.h>
+
+static const char* FS = "http_fs";
+#define USERS 50
+#define TAPS  (2 * JOURNAL_SEG_RECS + 100)
+
+static size_t csvRows(const std::string& rsp) {
+  std::string body = hostBody(rsp);
+  return std::count(body.begin(), body.end(), '\n') - 1;      // tanpa baris judul
+}
+
+static bool starts(const std::string& s, const char* p) { return !s.compare(0, strlen(p), p); }
+
+// POST /api/rename dengan header tambahan; Content-Length dari body
+// kalau extra tidak menentukan panjang sendiri
+static std::string post(const std::string& extra, const std::string& body) {
+  char b[160];
+  snprintf(b, sizeof(b), "POST /api/rename HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n"
+           "Content-Type: application/x-www-form-urlencoded\r\n", AP_DOMAIN);
+  std::string len;
+  if (extra.find("Content-Length") == std::string::npos && extra.find("Transfer-Encoding") == std::string::npos)
+    len = "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  return hostRaw(b + extra + len + "\r\n" + body);
+}
+
+// Client lambat: jendela terima kecil, tidak membaca sampai disuruh
+static void slowClient() {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  int rcv = 4096;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcv, sizeof(rcv));
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(hostPort(80));
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  CHECK(!connect(fd, (sockaddr*)&a, sizeof(a)));
+  char req[160];
+  int n = snprintf(req, sizeof(req), "GET /api/logs/csv HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", AP_DOMAIN);
+  send(fd, req, n, 0);
+
+  // Socket penuh: tiap putaran tetap singkat, DNS dilayani tiap putaran
+  uint32_t dns = hostDnsPolls, done = histDone;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < 500; i++) { netRound(); hostClockAdvance(1000); }
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  printf("500 putaran dengan CSV macet: %.1f ms, dns +%u\n", ms, (unsigned)(hostDnsPolls - dns));
+  CHECK(hostDnsPolls - dns == 500);
+  CHECK(ms < 2000);
+  CHECK(server.streams() == 1 && csvExports == 1);
+  CHECK(histDone == done);                        // arsip menunggu ekspor
+
+  // Request lain dijawab selama CSV tertahan
+  std::string sum = hostHttp("GET", "/api/summary");
+  CHECK(starts(sum, "HTTP/1.1 200"));
+  CHECK(hostBody(sum).find("\"present\":") != std::string::npos);
+
+  // Client lanjut membaca: CSV utuh, tiap tap tepat sekali
+  std::string rsp;
+  for (int idle = 0; idle < 2000; idle++) {
+    netRound();
+    hostClockAdvance(1000);
+    char b[8192];
+    ssize_t k = recv(fd, b, sizeof(b), MSG_DONTWAIT);
+    if (k == 0) break;
+    if (k > 0) { rsp.append(b, k); idle = 0; }
+  }
+  close(fd);
+  CHECK(csvRows(rsp) == TAPS);
+  CHECK(server.streams() == 0 && csvExports == 0);
+  for (int i = 0; i < 200 && histDone < 2; i++) netRound();
+  CHECK(histDone == 2);
+}
+
+// Body JSON lengkap: panjang sesuai header, diakhiri '}', tanpa '\0'
+static std::string json(const char* path) {
+  std::string rsp = hostHttp("GET", path);
+  CHECK(starts(rsp, "HTTP/1.1 200"));
+  size_t at = rsp.find("Content-Length: ");
+  CHECK(at != std::string::npos);
+  std::string body = hostBody(rsp);
+  CHECK(strtoul(rsp.c_str() + at + 16, nullptr, 10) == body.size());
+  CHECK(body.back() == '}' && body.find('\0') == std::string::npos);
+  return body;
+}
+
+// Peer palsu: HELLO langsung ke repl sketch, angka & IP terpanjang
+static uint8_t fakeFrom;
+static void fakeSend(uint32_t, uint16_t, const uint8_t* d, size_t n) {
+  repl.onPacket(0xF0FFFFFFu - fakeFrom, REPL_PORT, d, n, millis());
+}
+static uint32_t fakeSeq() { return 4000000000u; }
+static bool fakeChange(uint32_t, ReplRec&) { return false; }
+static bool fakeSnap(uint32_t, ReplRec&) { return false; }
+static bool fakeDeliver(uint32_t, const ReplRec*, uint8_t) { return true; }
+
+static void statsJson() {
+  static const char KEY[] = "uji";
+  static const ReplIo IO = { fakeSend, fakeSeq, fakeChange, fakeSnap, fakeDeliver };
+  uint32_t site = crc32(SITE_NAME, strlen(SITE_NAME));
+  repl.begin(unitId, site, 4000000000u, REPL_PORT, IO, KEY, strlen(KEY));
+  static ReplNode peers[REPL_PEERS];
+  for (fakeFrom = 0; fakeFrom < REPL_PEERS; fakeFrom++) {
+    peers[fakeFrom].begin(4000000001u + fakeFrom, site, 4000000000u, REPL_PORT, IO, KEY, strlen(KEY));
+    peers[fakeFrom].tick(millis() + REPL_HELLO_MS);
+  }
+  hostClockAdvance(REPL_PEER_TTL / 2 * 1000LL);                 // ageMs 5 digit
+  std::string body = json("/api/repl");
+  size_t units = 0;
+  for (size_t at = body.find("\"unit\":"); at != std::string::npos; at = body.find("\"unit\":", at + 1)) units++;
+  printf("/api/repl %d peer: %zu byte\n", REPL_PEERS, body.size());
+  CHECK(units == REPL_PEERS + 1 && body.size() > 1024);
+  json("/api/stats/ws");
+  json("/api/stats/tap");
+}
+
+static void run() {
+  hostBoot(FS);
+  hostEnroll(USERS);
+  for (uint32_t i = 0; i < TAPS; i++) journalAppend(userDb.key(i % USERS), i % USERS, EPOCH_MIN + i * 60);
+  journalFlush();
+  for (int i = 0; i < 200 && histDone < 1; i++) netRound();
+  CHECK(histDone == 1);                           // CSV = arsip segmen 1 + jurnal 2..3
+
+  slowClient();
+  statsJson();
+
+  // HEAD: header sama dengan GET, tanpa body maupun chunk penutup
+  std::string head = hostHttp("HEAD", "/api/logs/csv");
+  CHECK(starts(head, "HTTP/1.1 200"));
+  CHECK(head.find("Transfer-Encoding: chunked") != std::string::npos);
+  CHECK(head.size() == head.find("\r\n\r\n") + 4);
+  CHECK(csvExports == 0);
+  head = hostHttp("HEAD", "/");
+  CHECK(starts(head, "HTTP/1.1 200") && head.size() == head.find("\r\n\r\n") + 4);
+
+  // Header panjang tidak memakan jatah body, dan sebaliknya
+  std::string pad = "X-Pad: " + std::string(HTTP_HEAD_MAX - 400, 'a') + "\r\n";
+  CHECK(starts(post(pad, "idx=0&name=Budi"), "HTTP/1.1 200"));
+  hostRun(50);                                    // rename diterapkan task UI
+  User u;
+  userDb.read(0, u);
+  CHECK(!strcmp(u.name, "Budi"));
+  CHECK(starts(post("X-Pad: " + std::string(HTTP_HEAD_MAX, 'a') + "\r\n", ""), "HTTP/1.1 431"));
+  CHECK(starts(post("", "idx=0&name=" + std::string(HTTP_BODY_MAX, 'a')), "HTTP/1.1 413"));
+
+  // Body hanya lewat Content-Length
+  CHECK(starts(post("Transfer-Encoding: chunked\r\n", "5\r\nidx=0\r\n0\r\n\r\n"), "HTTP/1.1 411"));
+  CHECK(starts(post("Transfer-Encoding: gzip\r\n", ""), "HTTP/1.1 501"));
+}
+
+int main() {
+  CHECK(hostFork(run) == 0);
+  printf("http_test OK\n");
+  return 0;
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+ino2cpp.py — ubah sketch .ino jadi .cpp biasa (seperti arduino-cli)
+
+Arduino menambahkan `#include <Arduino.h>` dan prototipe semua fungsi
+tingkat atas sebelum fungsi pertama, supaya fungsi boleh dipanggil
+sebelum didefinisikan. Build host (CMakeLists.txt) memakai skrip ini
+untuk meng-compile project_absensi_esp32.ino apa adanya; #line
+menjaga pesan error tetap menunjuk baris .ino.
+
+Pemakaian:
+  python3 tools/ino2cpp.py project_absensi_esp32/project_absensi_esp32.ino out.cpp
+"""
+
+import os
+import re
+import sys
+
+# Definisi fungsi tingkat atas satu baris: "tipe nama(arg) {" (argumen
+# boleh berisi default). Deklarasi static / template / tipe diabaikan.
+FUNC = re.compile(
+    r'^(?!static\b|return\b|else\b|if\b|for\b|while\b|switch\b|case\b|typedef\b|'
+    r'struct\b|enum\b|class\b|namespace\b|template\b|using\b|#|//|\s)'
+    r'([A-Za-z_][\w:<>\*& ]*?[\s\*&]+)([A-Za-z_]\w*)\s*\(([^;{}]*)\)\s*(const\s*)?\{')
+
+
+def strip(line):
+    line = re.sub(r'"(\\.|[^"\\])*"', '""', line)
+    line = re.sub(r"'(\\.|[^'\\])'", "''", line)
+    return re.sub(r'//.*', '', line)
+
+
+def convert(src, name):
+    lines = src.split('\n')
+    protos, first, depth, comment = [], None, 0, False
+    for i, line in enumerate(lines):
+        if depth == 0 and not comment:
+            m = FUNC.match(line)
+            if m:
+                args = re.sub(r'\s*=\s*[^,)]+', '', m.group(3))
+                protos.append('%s %s(%s);' % (m.group(1).strip(), m.group(2), args))
+                if first is None:
+                    first = i
+        t = strip(line)
+        if comment:
+            if '*/' not in t:
+                continue
+            t, comment = t.split('*/', 1)[1], False
+        t = re.sub(r'/\*.*?\*/', '', t)
+        if '/*' in t:
+            t, comment = t.split('/*', 1)[0], True
+        depth += t.count('{') - t.count('}')
+
+    out = ['#include <Arduino.h>', '#line 1 "%s"' % name]
+    for i, line in enumerate(lines):
+        if i == first:
+            out += protos + ['#line %d "%s"' % (i + 1, name)]
+        out.append(line)
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().split('\n')[-1])
+    src, dst = sys.argv[1], sys.argv[2]
+    with open(src, encoding='utf-8') as f:
+        text = convert(f.read(), os.path.abspath(src))
+    with open(dst, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+/*
+ * journal_test.cpp — pemulihan ekor jurnal di build host
+ * Segmen aktif dengan ekor terpotong (record setengah jadi) dipulihkan
+ * saat boot. Listrik dipotong di setiap op flash selama pemulihan
+ * (hostFsFault.cutAfterOps = 0, 1, 2, …): sesudah boot normal berikut
+ * semua tap sebelum robekan tetap ada, tidak ada .tmp yang tersisa.
+ * Flash penuh saat menyalin → file asli tidak dihapus, ekor ditimpa
+ * di tempat oleh tap berikutnya. Flash penuh saat flush → tap ditahan
+ * di antrean dan ditulis ulang tanpa celah; antrean penuh → jrnLost.
+ * Segmen aktif kosong sesudah rotasi → nomor boot tetap naik.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R journal_test)
+ */
+
+#include "host_sketch.h"
+
+#include <sys/stat.h>
+
+static const char* FS = "journal_fs";
+#define USERS 5
+#define TAPS  100
+
+static size_t taps() {
+  std::string body = hostBody(hostHttp("GET", "/api/logs/csv"));
+  return std::count(body.begin(), body.end(), '\n') - 1;      // tanpa baris judul
+}
+
+static bool tmpLeft() {
+  struct stat st;
+  return !stat((std::string(FS) + journalPath(jrnSeq).c_str() + ".tmp").c_str(), &st);
+}
+
+// Flash baru: TAPS tap di segmen aktif, lalu record setengah jadi
+static void tornImage() {
+  hostBoot(FS);
+  hostEnroll(USERS);
+  for (uint32_t i = 0; i < TAPS; i++) journalAppend(userDb.key(i % USERS), i % USERS, EPOCH_MIN + i * 60);
+  journalFlush();
+  File f = LittleFS.open(journalPath(jrnSeq), "a");
+  uint8_t half[sizeof(JournalRec) / 2];
+  memset(half, 0xA5, sizeof(half));
+  f.write(half, sizeof(half));
+  f.close();
+}
+
+// Boot dengan listrik dipotong sesudah `ops` op flash
+static void cutBoot(long ops) {
+  hostFsFault.cutAfterOps = ops;
+  hostBoot(FS, false);
+}
+
+static void verify(size_t want) {
+  hostBoot(FS, false);
+  CHECK(!tmpLeft());
+  CHECK(taps() == want);
+}
+
+static void flashFull() {
+  hostFsFault.full = true;                        // salinan .tmp gagal
+  hostBoot(FS, false);
+  hostFsFault.full = false;
+  CHECK(!tmpLeft());
+  for (uint32_t i = 0; i < 10; i++) journalAppend(userDb.key(0), 0, EPOCH_MIN + (TAPS + i) * 60);
+  journalFlush();
+}
+
+// Write pendek di tengah batch, lalu flash penuh sama sekali
+static void flushFull() {
+  hostBoot(FS);
+  hostEnroll(USERS);
+  journalFlush();
+  uint32_t recs = jrnSegRecs;
+  hostFsFault.spaceBytes = 5 * sizeof(JournalRec) / 2;
+  for (uint32_t i = 0; i < 10; i++) journalAppend(userDb.key(i % USERS), i % USERS, EPOCH_MIN + i * 60);
+  journalFlush();
+  CHECK(jrnPendingN == 10 && jrnSegRecs == recs);
+  hostRun(JOURNAL_FLUSH_MS + 10);                 // masih penuh: tetap ditahan
+  CHECK(jrnPendingN == 10);
+  hostFsFault.spaceBytes = -1;
+  hostRun(JOURNAL_FLUSH_MS + 10);
+  CHECK(jrnPendingN == 0 && jrnSegRecs == recs + 10);
+  File f = LittleFS.open(journalPath(jrnSeq), "r");
+  CHECK(f.size() == jrnSegRecs * sizeof(JournalRec));   // potongan setengah jadi tertimpa
+  f.close();
+
+  hostFsFault.full = true;
+  for (uint32_t i = 0; i < JOURNAL_BATCH + 5; i++) journalAppend(userDb.key(0), 0, EPOCH_MIN + (10 + i) * 60);
+  CHECK(jrnPendingN == JOURNAL_BATCH && jrnLost == 5);
+  hostFsFault.full = false;
+  journalFlush();
+  CHECK(jrnPendingN == 0);
+}
+
+// Mati listrik tepat sesudah rotasi: segmen aktif kosong
+static void emptyActive() {
+  hostBoot(FS);
+  hostEnroll(USERS);
+  CHECK(bootNo == 0);
+  for (uint32_t i = 0; i <= JOURNAL_SEG_RECS; i++) journalAppend(userDb.key(0), 0, EPOCH_MIN + i);
+  journalFlush();
+  CHECK(jrnSeq == 2);
+  LittleFS.open(journalPath(jrnSeq), "w").close();
+}
+
+static void bootAfter(uint16_t want) {
+  hostBoot(FS, false);
+  CHECK(bootNo == want);
+}
+
+int main() {
+  int cuts = 0;
+  for (long ops = 0;; ops++) {
+    CHECK(hostFork(tornImage) == 0);
+    int st = hostFork([ops] { cutBoot(ops); });
+    CHECK(st == 0 || st == HOST_POWER_CUT);
+    CHECK(hostFork([] { verify(TAPS); }) == 0);
+    if (st == 0) break;                           // pemulihan selesai tanpa terpotong
+    cuts++;
+  }
+  printf("%d titik potong selama boot + pemulihan, semua tap utuh\n", cuts);
+  CHECK(cuts > 5);
+
+  CHECK(hostFork(tornImage) == 0);
+  CHECK(hostFork(flashFull) == 0);
+  CHECK(hostFork([] { verify(TAPS + 10); }) == 0);
+
+  CHECK(hostFork(flushFull) == 0);
+  CHECK(hostFork([] { verify(10 + JOURNAL_BATCH); }) == 0);
+
+  CHECK(hostFork(emptyActive) == 0);
+  CHECK(hostFork([] { bootAfter(1); }) == 0);
+  CHECK(hostFork([] { bootAfter(2); }) == 0);
+  printf("journal_test OK\n");
+  return 0;
+}
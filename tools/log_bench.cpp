@@ -0,0 +1,92 @@
+/*
+ * log_bench.cpp — Biaya per tap ring log RAM (log_ring.h) vs geser array
+ * Geser = cara lama: kalau penuh, semua entri digeser satu ke depan
+ * (logs[i] = logs[i+1]) lalu entri baru ditulis di ujung. Ring =
+ * LogRing (head maju, satu slot ditulis). Keduanya diisi penuh dulu,
+ * lalu diukur ns/tap dalam keadaan tunak (setiap tap membuang entri
+ * tertua) untuk kapasitas MIN_LOG (200) dan MAX_LOG (2000). Isi kedua
+ * cara dibandingkan entri per entri sesudah pengukuran.
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I project_absensi_esp32 tools/log_bench.cpp -o /tmp/log_bench
+ *   (atau lihat CMakeLists.txt)
+ * Pakai:
+ *   /tmp/log_bench [TAP=200000]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "log_ring.h"
+
+static double secsSince(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// addLog() sebelum ring: array tetap, geser kalau penuh
+struct ShiftLog {
+  std::vector<LogEntry> e;
+  int count = 0;
+  explicit ShiftLog(int cap) : e(cap) {}
+  void add(const char* name, const char* uid, uint32_t ts) {
+    int cap = (int)e.size();
+    if (count >= cap) {
+      for (int i = 0; i < cap-1; i++) e[i] = e[i+1];
+      count = cap-1;
+    }
+    strncpy(e[count].name, name, NAME_SIZE-1);
+    e[count].name[NAME_SIZE-1] = '\0';
+    strncpy(e[count].uid, uid, UID_STR-1);
+    e[count].uid[UID_STR-1] = '\0';
+    e[count].ts = ts;
+    count++;
+  }
+};
+
+static const char* NAMES[4] = { "Andi", "Budi Santoso", "Citra", "Dewi Lestari" };
+static const char* UIDS[4]  = { "11:22:33:44", "A1:B2:C3:D4", "04:5F:21:9A:3B:80:01", "DE:AD:BE:EF" };
+
+static void run(int cap, long taps) {
+  ShiftLog shift(cap);
+  std::vector<LogEntry> buf(cap);
+  LogRing ring;
+  ring.init(buf.data(), cap);
+  for (int i = 0; i < cap; i++) {                   // isi penuh dulu
+    shift.add(NAMES[i & 3], UIDS[i & 3], i);
+    ring.add(NAMES[i & 3], UIDS[i & 3], i);
+  }
+
+  long shiftN = taps / (cap / 100);                 // geser 2000 entri: sampel lebih kecil
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < shiftN; i++) shift.add(NAMES[i & 3], UIDS[i & 3], cap + i);
+  double shiftNs = secsSince(t0) * 1e9 / shiftN;
+
+  t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < taps; i++) ring.add(NAMES[i & 3], UIDS[i & 3], cap + i);
+  double ringNs = secsSince(t0) * 1e9 / taps;
+
+  // cap tap terakhir sama untuk kedua cara → isi harus sama persis
+  for (long i = taps; i < taps + cap; i++) {
+    shift.add(NAMES[i & 3], UIDS[i & 3], cap + i);
+    ring.add(NAMES[i & 3], UIDS[i & 3], cap + i);
+  }
+  for (int i = 0; i < cap; i++) {
+    const LogEntry &a = shift.e[i], &b = ring.at(i);
+    if (a.ts != b.ts || strcmp(a.name, b.name) || strcmp(a.uid, b.uid)) {
+      fprintf(stderr, "isi beda di entri %d (cap %d)\n", i, cap);
+      exit(1);
+    }
+  }
+  printf("%5d entri (%6zu byte)  geser %9.1f ns/tap  ring %6.1f ns/tap  x%.0f\n",
+         cap, cap * sizeof(LogEntry), shiftNs, ringNs, shiftNs / ringNs);
+}
+
+int main(int argc, char** argv) {
+  long taps = argc > 1 ? atol(argv[1]) : 200000;
+  printf("tap: %ld per ukuran, ring sudah penuh (tiap tap membuang entri tertua)\n", taps);
+  run(200, taps);
+  run(2000, taps);
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * logs_bench.cpp — Query satu hari dari riwayat 100000 tap di build host
+ * Riwayat sintetis: USERS karyawan × DAYS hari × PER_DAY tap (jam
+ * 07:00–17:00, urut waktu) ditulis lewat journalAppend(); segmen
+ * yang ditutup diarsip ke /hist seperti di ESP32, jadi hari lama ada
+ * di arsip dan ±JOURNAL_SEGMENTS × 4096 tap terakhir di jurnal.
+ * Diukur per query (HTTP sungguhan ke server sketch, rata-rata REPS
+ * kali): waktu, baris, byte dibaca dari "flash" (hostFsReadBytes).
+ *   /api/logs ?from&to       satu hari di jurnal / di arsip, semua halaman (cursor)
+ *   /api/logs ?from&to&user  satu hari di jurnal, satu orang (bloom per blok)
+ *   /api/logs/csv ?from&to   satu hari di jurnal / di arsip
+ * Pembanding: semua halaman /api/logs tanpa filter (dashboard memuat
+ * seluruh jurnal lalu menyaring sendiri) dan CSV penuh.
+ * Byte dibaca termasuk users.bin untuk nama tiap baris. Angka host
+ * bukan angka ESP32 — byte dibaca yang menentukan di flash.
+ *
+ * Build: lihat CMakeLists.txt (target logs_bench, ctest -R logs_bench)
+ *   cd build/run/logs_bench && ../../logs_bench [REPS=5]
+ */
+
+#include "host_sketch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#define USERS   500
+#define DAYS    100
+#define PER_DAY 1000             // USERS × 2 tap (masuk, pulang)
+
+static uint32_t day0;            // 00:00 UTC hari pertama
+
+static uint32_t dayFrom(int d) { return day0 + (uint32_t)d * 86400UL; }
+
+static void history() {
+  std::mt19937 rng(1);
+  std::vector<uint32_t> at(PER_DAY);
+  for (int d = 0; d < DAYS; d++) {
+    for (uint32_t& t : at) t = dayFrom(d) + 7 * 3600 + rng() % (10 * 3600);
+    std::sort(at.begin(), at.end());
+    for (int i = 0; i < PER_DAY; i++) {
+      int u = rng() % USERS;
+      journalAppend(userDb.key(u), u, at[i]);
+      // arsip mengejar sebelum segmen tertua perlu dihapus
+      while (jrnSeq > histDone + JOURNAL_SEGMENTS - 1) netRound();
+    }
+  }
+  journalFlush();
+  for (int k = 0; k < 1000 && jrnSeq > histDone + 1; k++) netRound();
+  hostRun(10);
+}
+
+struct Result {
+  double   ms;
+  size_t   rows, pages;
+  uint64_t readBytes;
+};
+
+static size_t count(const std::string& s, const char* what) {
+  size_t n = 0;
+  for (size_t at = s.find(what); at != std::string::npos; at = s.find(what, at + 1)) n++;
+  return n;
+}
+
+// Semua halaman /api/logs mengikuti "next"
+static Result logsAll(const std::string& query) {
+  Result r = { 0, 0, 0, 0 };
+  std::string cursor;
+  for (;;) {
+    std::string path = "/api/logs?limit=" + std::to_string(LOG_PAGE_MAX) + query + cursor;
+    std::string body = hostBody(hostHttp("GET", path.c_str()));
+    CHECK(body.size() > 10);
+    r.rows += count(body, "\"ts\":");
+    r.pages++;
+    size_t at = body.rfind("\"next\":");
+    CHECK(at != std::string::npos);
+    if (body.compare(at + 7, 4, "null") == 0) break;
+    cursor = "&cursor=" + std::to_string(strtoul(body.c_str() + at + 7, nullptr, 10));
+  }
+  return r;
+}
+
+static Result csv(const std::string& query) {
+  std::string path = "/api/logs/csv" + (query.empty() ? query : "?" + query.substr(1));
+  std::string body = hostBody(hostHttp("GET", path.c_str()));
+  Result r = { 0, count(body, "\n") - 1, 1, 0 };
+  return r;
+}
+
+template <class Fn> static Result measure(const char* what, int reps, size_t want, Fn fn) {
+  Result r = { 0, 0, 0, 0 };
+  uint64_t read0 = hostFsReadBytes;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < reps; i++) r = fn();
+  r.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / reps;
+  r.readBytes = (hostFsReadBytes - read0) / reps;
+  printf("  %-36s %8.2f ms  %6zu baris  %4zu hlm  %9llu byte dibaca\n", what, r.ms, r.rows,
+         r.pages, (unsigned long long)r.readBytes);
+  if (want) CHECK(r.rows == want);
+  return r;
+}
+
+int main(int argc, char** argv) {
+  int reps = argc > 1 ? atoi(argv[1]) : 5;
+  hostBoot("logs_fs");
+  tzMinutes = 0;
+  hostEnroll(USERS);
+  day0 = (EPOCH_MIN / 86400 + 1) * 86400;
+
+  auto t0 = std::chrono::steady_clock::now();
+  history();
+  printf("riwayat: %d tap, %d hari, %d user (%.1f dtk); jurnal segmen %lu..%lu, arsip %lu..%lu (%lu KB)\n",
+         DAYS * PER_DAY, DAYS, USERS,
+         std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count(),
+         (unsigned long)jrnFirstSeq, (unsigned long)jrnSeq, (unsigned long)histFirst,
+         (unsigned long)histDone, (unsigned long)(histBytes / 1024));
+
+  // Hari terakhir-2 pasti di jurnal; hari ke-DAYS/2 hanya di arsip
+  char recent[64], old[64], user[128];
+  snprintf(recent, sizeof(recent), "&from=%lu&to=%lu", (unsigned long)dayFrom(DAYS - 3),
+           (unsigned long)(dayFrom(DAYS - 2) - 1));
+  snprintf(old, sizeof(old), "&from=%lu&to=%lu", (unsigned long)dayFrom(DAYS / 2),
+           (unsigned long)(dayFrom(DAYS / 2 + 1) - 1));
+  char uid[UID_STR];
+  uint8_t b[4];
+  hostUid(7, b);
+  uidFmt(uid, b, 4);
+  snprintf(user, sizeof(user), "%s&user=%s", recent, uid);
+
+  printf("query (rata-rata %d kali):\n", reps);
+  measure("/api/logs 1 hari (jurnal)", reps, PER_DAY, [&] { return logsAll(recent); });
+  measure("/api/logs 1 hari (arsip)", reps, PER_DAY, [&] { return logsAll(old); });
+  measure("/api/logs 1 hari + user", reps, 0, [&] { return logsAll(user); });
+  measure("/api/logs/csv 1 hari (jurnal)", reps, PER_DAY, [&] { return csv(recent); });
+  measure("/api/logs/csv 1 hari (arsip)", reps, PER_DAY, [&] { return csv(old); });
+  printf("pembanding:\n");
+  measure("/api/logs semua halaman, tanpa filter", reps, 0, [&] { return logsAll(""); });
+  measure("/api/logs/csv penuh", reps, 0, [&] { return csv(""); });
+  return 0;
+}
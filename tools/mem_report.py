@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+mem_report.py — Laporan RAM statis firmware (.data + .bss)
+
+  1. arduino-cli ada: compile sketch untuk ESP32 (--fqbn), cetak
+     ringkasan "Global variables use …" dari arduino-cli, lalu N objek
+     statis terbesar dari ELF (xtensa-esp32-elf-nm dari paket esp32).
+  2. arduino-cli tidak ada: ukur build host (absensi_host dari
+     CMakeLists.txt) dengan nm. Pointer / size_t 8 byte di x86-64
+     (4 di ESP32) dan HAL palsu ikut terhitung, jadi angkanya batas
+     atas kasar — untuk membandingkan perubahan, bukan ukuran firmware.
+
+Contoh:
+  python3 tools/mem_report.py                       # ESP32 kalau bisa
+  python3 tools/mem_report.py --host build --top 30
+Hanya pakai library standar Python 3.
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT   = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCH = os.path.join(ROOT, "project_absensi_esp32")
+STATIC = set("bBdD")             # simbol .bss / .data
+
+
+def statics(nm, elf):
+    """[(ukuran, nama)] objek statis, terbesar dulu."""
+    out = subprocess.run([nm, "-S", "--size-sort", "-C", elf],
+                         capture_output=True, text=True, check=True).stdout
+    syms = []
+    for line in out.splitlines():
+        m = re.match(r"[0-9a-fA-F]+ ([0-9a-fA-F]+) (\w) (.+)", line)
+        if m and m.group(2) in STATIC:
+            syms.append((int(m.group(1), 16), m.group(3)))
+    return sorted(syms, reverse=True)
+
+
+def report(title, syms, top):
+    total = sum(s for s, _ in syms)
+    print(f"{title}: {len(syms)} objek statis, {total} byte")
+    for size, name in syms[:top]:
+        print(f"  {size:8d}  {name}")
+
+
+def esp32(cli, fqbn, top):
+    build = tempfile.mkdtemp(prefix="absensi_mem_")
+    r = subprocess.run([cli, "compile", "--fqbn", fqbn, "--build-path", build, SKETCH],
+                       capture_output=True, text=True)
+    if r.returncode:
+        sys.exit(r.stdout + r.stderr)
+    for line in r.stdout.splitlines():
+        if line.startswith(("Sketch uses", "Global variables")):
+            print(line)
+    elf = glob.glob(os.path.join(build, "*.elf"))
+    home = os.path.expanduser("~/.arduino15/packages/esp32/tools")
+    nm = (glob.glob(os.path.join(home, "*", "*", "bin", "xtensa-esp32-elf-nm")) +
+          [shutil.which("xtensa-esp32-elf-nm")])
+    nm = [n for n in nm if n]
+    if not elf or not nm:
+        print("ELF / xtensa-esp32-elf-nm tidak ditemukan — rincian per objek dilewati")
+        return
+    report(f"ESP32 ({fqbn})", statics(nm[0], elf[0]), top)
+
+
+def host(build, top):
+    exe = os.path.join(build, "absensi_host")
+    if not os.path.exists(exe):
+        sys.exit(f"{exe} tidak ada — build dulu: cmake -S . -B {build} && cmake --build {build}")
+    syms = statics(shutil.which("nm") or "nm", exe)
+    report("Host x86-64 (bukan ukuran ESP32)", syms, top)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("--fqbn", default="esp32:esp32:esp32")
+    ap.add_argument("--host", metavar="BUILD", help="ukur build host di direktori ini")
+    ap.add_argument("--top", type=int, default=20)
+    a = ap.parse_args()
+
+    cli = shutil.which("arduino-cli")
+    if cli and not a.host:
+        esp32(cli, a.fqbn, a.top)
+        return
+    if not a.host:
+        print("arduino-cli tidak ditemukan — memakai build host (build/)")
+    host(a.host or os.path.join(ROOT, "build"), a.top)
+
+
+if __name__ == "__main__":
+    main()
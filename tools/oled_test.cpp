@@ -0,0 +1,87 @@
+/*
+ * oled_test.cpp — byte tile OLED per transisi layar di build host
+ * Layar dijalankan lewat jalur sungguhan (tap kartu, tombol, jam).
+ * Tiap langkah: byte tile yang lewat updateDisplayArea (hostOled)
+ * dibandingkan dengan sendBuffer() penuh per oledFlush() (cara lama,
+ * 1024 byte tiap flush). Sesudah tiap langkah isi panel harus sama
+ * persis dengan buffer U8g2 — diff tidak boleh melewatkan tile.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R oled_test)
+ */
+
+#include "host_sketch.h"
+
+#define FULL 1024                                 // 128x64 / 8
+
+struct Step {
+  uint64_t bytes;
+  uint32_t flushes;
+};
+
+static uint64_t totalDiff, totalFull;
+
+template <class Fn> static Step step(const char* what, Fn fn) {
+  uint64_t b0 = hostOled.tileBytes;
+  uint32_t f0 = metric[M_OLED_FLUSH].count;
+  fn();
+  Step s = { hostOled.tileBytes - b0, metric[M_OLED_FLUSH].count - f0 };
+  CHECK(!memcmp(hostOledPanel(), u8g2.getBufferPtr(), FULL));
+  CHECK(hostOled.frames == 0);                    // tidak ada sendBuffer() penuh
+  totalDiff += s.bytes;
+  totalFull += (uint64_t)s.flushes * FULL;
+  printf("  %-34s %3u flush  %6llu byte  (penuh: %6u)\n", what, (unsigned)s.flushes,
+         (unsigned long long)s.bytes, (unsigned)(s.flushes * FULL));
+  return s;
+}
+
+static void press(uint8_t pin, unsigned long ms) {
+  hostPinSet(pin, LOW);
+  hostRun(ms);
+  hostPinSet(pin, HIGH);
+  hostRun(50);
+}
+
+int main() {
+  hostBoot("oled_fs");
+  hostEnroll(3);
+  uint8_t uid[4];
+
+  Step s = step("attend: uptime mm:ss (5 dtk)", [] { hostRun(5000); });
+  CHECK(s.flushes >= 4 && s.bytes <= 4 * 8 * s.flushes);      // hanya digit jam
+
+  s = step("attend -> ABSEN OK (tap dikenal)", [&] {
+    hostUid(1, uid); hostCardTap(uid, 4); hostRun(20);
+  });
+  CHECK(currentMode == MODE_ATTEND_OK && s.bytes < (uint64_t)s.flushes * FULL);
+
+  s = step("ABSEN OK: satu langkah bar (50 ms)", [] { hostRun(50); });
+  CHECK(s.flushes >= 1 && s.bytes <= 2 * 8 * s.flushes);       // ujung bar (page 6-7) atau 0
+
+  s = step("ABSEN OK: bar sampai habis", [] { hostRun(RESULT_TIMEOUT); });
+  CHECK(currentMode == MODE_ATTEND && s.bytes * 4 < (uint64_t)s.flushes * FULL);
+
+  s = step("attend -> KARTU UNKNOWN", [&] {
+    hostUid(100, uid); hostCardTap(uid, 4); hostRun(20);
+  });
+  CHECK(currentMode == MODE_ATTEND_FAIL);
+  step("KARTU UNKNOWN -> attend", [] { hostRun(RESULT_TIMEOUT + 100); });
+  CHECK(currentMode == MODE_ATTEND);
+
+  s = step("attend -> ADMIN MENU (tahan kiri)", [] { press(BTN_LEFT, HOLD_DURATION + 100); });
+  CHECK(currentMode == MODE_ADMIN_MENU);
+  s = step("ADMIN MENU: geser pilihan", [] { press(BTN_LEFT, 100); });
+  CHECK(menuIndex == 1 && s.bytes <= (uint64_t)s.flushes * FULL / 2);    // page sorotan lama + baru saja
+
+  s = step("ADMIN MENU -> scan HAPUS", [] { press(BTN_RIGHT, 100); });
+  CHECK(currentMode == MODE_ADMIN_DELETE);
+  s = step("scan: animasi titik (1 dtk)", [] { hostRun(1000); });
+  CHECK(s.flushes >= 2 && s.bytes <= 8 * 8 * s.flushes);        // tiga titik di page 6-7
+
+  s = step("gambar ulang identik", [] { displayAdminScan("  HAPUS KARTU  "); displayAdminScan("  HAPUS KARTU  "); });
+  CHECK(s.flushes == 2 && s.bytes == 0);                       // tidak ada tile berubah
+
+  printf("total: %llu byte tile vs %llu byte sendBuffer() (x%.1f)\n",
+         (unsigned long long)totalDiff, (unsigned long long)totalFull, (double)totalFull / totalDiff);
+  printf("oled_test OK\n");
+  return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * repl_node.cpp — Satu "unit" replikasi user di host (Linux / macOS)
+ * Memakai ReplNode yang sama dengan ESP32 (user_repl.h) di atas
+ * store RAM + UDP loopback, jadi beberapa unit bisa diuji di satu
+ * mesin tanpa hardware. Broadcast diganti kirim ke semua port peer.
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I project_absensi_esp32 tools/repl_node.cpp -o /tmp/repl_node
+ * Contoh 3 unit (terminal terpisah):
+ *   /tmp/repl_node 1 4201 4202 4203
+ *   /tmp/repl_node 2 4202 4201 4203
+ *   /tmp/repl_node 3 4203 4201 4202
+ * Perintah stdin:
+ *   add AA:BB:CC:DD Budi   tambah / ganti nama (cap baru)
+ *   del AA:BB:CC:DD        hapus (tombstone)
+ *   list                   daftar user + cap, lalu "sum" (hash isi)
+ *   peers                  status peer & counter
+ *   quit
+ * Log ring sengaja sama dengan USER_OPS (64): unit yang dimatikan
+ * lalu dinyalakan lagi sesudah >64 perubahan disinkron lewat snapshot.
+ * Kunci HMAC dari env REPL_KEY (default "absensi"); unit dengan kunci
+ * beda saling membuang paket (lihat "forged" di perintah peers).
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "user_repl.h"
+
+#define LOG_RING 64
+
+static ReplNode              node;
+static int                   sock = -1;
+static uint32_t              unitId;
+static std::vector<uint16_t> peerPorts;
+static uint32_t              clockL = 0;        // jam Lamport
+static uint32_t              seqNo = 0;         // perubahan terakhir di store ini
+static ReplRec               logRing[LOG_RING];
+static std::map<std::string, ReplRec> store;    // key = UID teks; deleted = tombstone
+
+static unsigned long nowMs() {
+  timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (unsigned long)(tv.tv_sec * 1000UL + tv.tv_usec / 1000);
+}
+
+static std::string uidText(const ReplRec& r) {
+  char s[UID_STR];
+  uidFmt(s, r.uid, r.uidLen);
+  return s;
+}
+
+// Setara opPush(): satu seq per perubahan yang diterapkan
+static void record(const ReplRec& r) {
+  seqNo++;
+  logRing[seqNo % LOG_RING] = r;
+  store[uidText(r)] = r;
+}
+
+// LWW — sama dengan replApplyIn() di sketch, tanpa antrean antar task.
+// Tombstone disimpan selamanya (map), jadi tidak ada floor / STALE;
+// penanda rekonsiliasi (uidLen 0) dilewati — unit host tidak menyapu
+static bool apply(uint32_t, const ReplRec* r, uint8_t n) {
+  for (uint8_t i = 0; i < n; i++) {
+    if (!r[i].uidLen || r[i].uidLen > UID_MAX) continue;
+    if (!replSane(r[i].st, clockL)) { printf("[repl] cap %u terlalu jauh, ditolak\n", r[i].st.ver); continue; }
+    if (r[i].st.ver > clockL) clockL = r[i].st.ver;
+    auto it = store.find(uidText(r[i]));
+    if (it != store.end() && !replNewer(r[i].st, it->second.st)) continue;
+    record(r[i]);
+    printf("[repl] %s %s (ver %u dari %u)\n", r[i].deleted ? "del" : "set",
+           uidText(r[i]).c_str(), r[i].st.ver, r[i].st.origin);
+  }
+  return true;
+}
+
+static void ioSend(uint32_t ip, uint16_t port, const uint8_t* d, size_t n) {
+  sockaddr_in a;
+  memset(&a, 0, sizeof(a));
+  a.sin_family      = AF_INET;
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (ip) {
+    a.sin_port = htons(port);
+    sendto(sock, d, n, 0, (sockaddr*)&a, sizeof(a));
+    return;
+  }
+  for (uint16_t p : peerPorts) {
+    a.sin_port = htons(p);
+    sendto(sock, d, n, 0, (sockaddr*)&a, sizeof(a));
+  }
+}
+
+static uint32_t ioSeq() { return seqNo; }
+
+static bool ioChange(uint32_t seq, ReplRec& r) {
+  if (seqNo - seq >= LOG_RING) return false;
+  r = logRing[seq % LOG_RING];
+  return true;
+}
+
+// std::map: urutan tetap selama store tidak berubah (ReplNode mengulang kalau berubah)
+static bool ioSnap(uint32_t i, ReplRec& r) {
+  if (i >= store.size()) return false;
+  auto it = store.begin();
+  std::advance(it, i);
+  r = it->second;
+  return true;
+}
+
+static void local(const char* uidStr, const char* name, bool del) {
+  ReplRec r;
+  memset(&r, 0, sizeof(r));
+  r.uidLen = strToUid(uidStr, r.uid);
+  if (!r.uidLen) { printf("UID tidak valid\n"); return; }
+  auto it = store.find(uidText(r));
+  if (del && (it == store.end() || it->second.deleted)) { printf("tidak ada\n"); return; }
+  r.deleted = del;
+  if (!del) strncpy(r.name, name, NAME_SIZE - 1);
+  r.st.ver = ++clockL;
+  r.st.origin = unitId;
+  record(r);
+}
+
+static void list() {
+  uint32_t sum = 0, live = 0;
+  for (auto& kv : store) {
+    const ReplRec& r = kv.second;
+    sum = crc32(&r, sizeof(r), sum);
+    if (r.deleted) continue;
+    live++;
+    printf("  %-29s %-20s ver %u/%u\n", kv.first.c_str(), r.name, r.st.ver, r.st.origin);
+  }
+  printf("sum %08x user %u tombstone %zu seq %u\n", sum, live, store.size() - live, seqNo);
+}
+
+static void peers() {
+  const ReplStats& s = node.stats();
+  for (uint8_t i = 0; i < ReplNode::peerSlots(); i++) {
+    const ReplPeer& p = node.peer(i);
+    if (!p.unit) continue;
+    printf("  unit %u port %u known %u adv %u %s\n", p.unit, p.port, p.known, p.adv,
+           p.synced && p.epoch == p.advEpoch ? "sync" : "belum");
+  }
+  printf("push %u pull %u full %u record %u celah %u forged %u\n", s.pushes, s.pulls, s.fulls, s.records,
+         s.gaps, s.forged);
+}
+
+static void command(char* line) {
+  char cmd[8] = "", uid[UID_STR + 1] = "", name[NAME_SIZE] = "";
+  if (sscanf(line, "%7s %30s %19[^\n]", cmd, uid, name) < 1) return;
+  if      (!strcmp(cmd, "add"))   local(uid, name[0] ? name : "User", false);
+  else if (!strcmp(cmd, "del"))   local(uid, "", true);
+  else if (!strcmp(cmd, "list"))  list();
+  else if (!strcmp(cmd, "peers")) peers();
+  else if (!strcmp(cmd, "quit"))  exit(0);
+  else printf("perintah: add UID NAMA | del UID | list | peers | quit\n");
+  fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "pakai: %s UNIT PORT [PORT_PEER...]\n", argv[0]);
+    return 1;
+  }
+  unitId = (uint32_t)strtoul(argv[1], nullptr, 0);
+  uint16_t port = (uint16_t)atoi(argv[2]);
+  for (int i = 3; i < argc; i++) peerPorts.push_back((uint16_t)atoi(argv[i]));
+
+  sock = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in a;
+  memset(&a, 0, sizeof(a));
+  a.sin_family      = AF_INET;
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  a.sin_port        = htons(port);
+  if (sock < 0 || bind(sock, (sockaddr*)&a, sizeof(a)) < 0) { perror("bind"); return 1; }
+
+  std::random_device rd;
+  const ReplIo io = { ioSend, ioSeq, ioChange, ioSnap, apply };
+  const char* key = getenv("REPL_KEY");
+  if (!key || !*key) key = "absensi";
+  node.begin(unitId, crc32("absensi", 7), rd() | 1, port, io, key, strlen(key));
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+  setvbuf(stdin, nullptr, _IONBF, 0);     // poll() hanya melihat fd, jangan ada baris tertahan di buffer stdio
+
+  char line[128];
+  uint8_t buf[sizeof(ReplHdr) + REPL_MAX_RECS * sizeof(ReplRec) + REPL_TAG];
+  bool stdinOpen = true;         // EOF: tetap jalan sebagai replika
+  for (;;) {
+    pollfd fds[2] = { { sock, POLLIN, 0 }, { stdinOpen ? 0 : -1, POLLIN, 0 } };
+    poll(fds, 2, 20);
+    if (fds[0].revents & POLLIN) {
+      sockaddr_in from;
+      socklen_t fl = sizeof(from);
+      ssize_t n = recvfrom(sock, buf, sizeof(buf), 0, (sockaddr*)&from, &fl);
+      if (n > 0) node.onPacket(ntohl(from.sin_addr.s_addr), ntohs(from.sin_port), buf, n, nowMs());
+    }
+    if (fds[1].revents & (POLLIN | POLLHUP)) {
+      if (fgets(line, sizeof(line), stdin)) command(line);
+      else stdinOpen = false;
+    }
+    node.tick(nowMs());
+  }
+}
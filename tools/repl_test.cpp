@@ -0,0 +1,297 @@
+/*
+ * repl_test.cpp — replikasi user (user_repl.h) di build host
+ * Tiga ReplNode di satu proses, disambung "jaringan" antrean RAM:
+ * unit dengan SITE_KEY beda / paket yang diubah di jalan dibuang
+ * (stats.forged), sisanya tetap konvergen; STALE → snapshot ber-
+ * penanda BEGIN / END. Di sketch: cap yang melompat lebih dari
+ * REPL_VER_JUMP ditolak; tombstone tergusur menaikkan floor (ikut
+ * /tombs.bin), record hidup di bawahnya tidak menghidupkan user lagi,
+ * dan sweep rekonsiliasi menghapus user yang tidak ada di snapshot.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R repl_test)
+ */
+
+#include "host_sketch.h"
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <vector>
+
+static const char* FS = "repl_fs";
+
+// ── Unit uji: store RAM seperti tools/repl_node.cpp ───
+#define UNITS    3
+#define LOG_RING 64
+
+struct Unit {
+  ReplNode node;
+  uint32_t clock, seq;
+  ReplRec  log[LOG_RING];
+  std::map<std::string, ReplRec> store;         // deleted = tombstone
+  std::vector<ReplRec> marks;                   // penanda rekonsiliasi yang diterima
+};
+
+struct Pkt {
+  uint32_t from, to;                            // ip = index unit + 1; to 0 = semua
+  std::vector<uint8_t> d;
+};
+
+static Unit          units[UNITS];
+static std::deque<Pkt> wire;
+static unsigned long netNow = 0;
+static std::function<void(Pkt&)> tamper;        // diubah di jalan (kosong = tidak)
+
+static std::string keyOf(const ReplRec& r) { return std::string((const char*)r.uid, r.uidLen); }
+
+static void record(Unit& u, const ReplRec& r) {
+  u.seq++;
+  u.log[u.seq % LOG_RING] = r;
+  u.store[keyOf(r)] = r;
+}
+
+template <int U> void ioSend(uint32_t ip, uint16_t, const uint8_t* d, size_t n) {
+  wire.push_back({ U + 1u, ip, std::vector<uint8_t>(d, d + n) });
+}
+template <int U> uint32_t ioSeq() { return units[U].seq; }
+template <int U> bool ioChange(uint32_t s, ReplRec& r) {
+  if (units[U].seq - s >= LOG_RING) return false;
+  r = units[U].log[s % LOG_RING];
+  return true;
+}
+template <int U> bool ioSnap(uint32_t i, ReplRec& r) {
+  if (i >= units[U].store.size()) return false;
+  auto it = units[U].store.begin();
+  std::advance(it, i);
+  r = it->second;
+  return true;
+}
+template <int U> bool ioDeliver(uint32_t, const ReplRec* r, uint8_t n) {
+  Unit& u = units[U];
+  for (uint8_t i = 0; i < n; i++) {
+    if (!r[i].uidLen && r[i].deleted) u.marks.push_back(r[i]);
+    if (!r[i].uidLen || r[i].uidLen > UID_MAX || !replSane(r[i].st, u.clock)) continue;
+    if (r[i].st.ver > u.clock) u.clock = r[i].st.ver;
+    auto it = u.store.find(keyOf(r[i]));
+    if (it == u.store.end() || replNewer(r[i].st, it->second.st)) record(u, r[i]);
+  }
+  return true;
+}
+
+template <int U> void unitBegin(const char* key) {
+  const ReplIo io = { ioSend<U>, ioSeq<U>, ioChange<U>, ioSnap<U>, ioDeliver<U> };
+  units[U].node.begin(U + 1, crc32("absensi", 7), 0x1000 + U, REPL_PORT, io, key, strlen(key));
+}
+
+static void localSet(int u, uint8_t id, const char* name) {
+  ReplRec r;
+  memset(&r, 0, sizeof(r));
+  r.uid[0] = 0xAB; r.uid[1] = id; r.uidLen = 4;
+  strncpy(r.name, name, NAME_SIZE - 1);
+  r.st.ver = ++units[u].clock; r.st.origin = u + 1;
+  record(units[u], r);
+}
+
+static const ReplRec* find(int u, uint8_t id) {
+  uint8_t uid[4] = { 0xAB, id, 0, 0 };
+  auto it = units[u].store.find(std::string((const char*)uid, 4));
+  return it == units[u].store.end() ? nullptr : &it->second;
+}
+
+// ms milidetik: tick semua unit tiap 10 ms, paket diantar langsung
+static void netRun(unsigned long ms) {
+  for (unsigned long t = 0; t < ms; t += 10) {
+    netNow += 10;
+    for (int i = 0; i < UNITS; i++) units[i].node.tick(netNow);
+    while (!wire.empty()) {
+      Pkt p = wire.front();
+      wire.pop_front();
+      if (tamper) tamper(p);
+      for (uint32_t i = 0; i < UNITS; i++)
+        if (i + 1 != p.from && (!p.to || p.to == i + 1))
+          units[i].node.onPacket(p.from, REPL_PORT, p.d.data(), p.d.size(), netNow);
+    }
+  }
+}
+
+static std::string hex(const uint8_t* d, size_t n) {
+  std::string s;
+  char b[3];
+  for (size_t i = 0; i < n; i++) { snprintf(b, sizeof(b), "%02x", d[i]); s += b; }
+  return s;
+}
+
+// FIPS 180-2 "abc" dan RFC 4231 test case 2
+static void vectors() {
+  uint8_t d[32];
+  Sha256 s;
+  s.update("abc", 3);
+  s.final(d);
+  CHECK(hex(d, 32) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  HmacSha256<32> m;
+  m.setKey("Jefe", 4);
+  const char* msg = "what do ya want for nothing?";
+  m.tag(msg, strlen(msg), d);
+  CHECK(hex(d, 32) == "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+  CHECK(m.verify(msg, strlen(msg), d));
+  d[31] ^= 1;
+  CHECK(!m.verify(msg, strlen(msg), d));
+}
+
+static void authenticated() {
+  unitBegin<0>("rahasia-lokasi");
+  unitBegin<1>("rahasia-lokasi");
+  unitBegin<2>("kunci-lain");                   // SITE_NAME sama, kunci beda
+  localSet(0, 1, "Budi");
+  localSet(2, 2, "Penyusup");
+  netRun(5000);
+  CHECK(find(1, 1) && !strcmp(find(1, 1)->name, "Budi"));
+  CHECK(!find(0, 2) && !find(1, 2) && !find(2, 1));
+  CHECK(units[0].node.stats().forged > 0 && units[1].node.stats().forged > 0);
+
+  // Satu byte nama diubah di jalan → paket dibuang, bukan diterapkan
+  uint32_t forged = units[1].node.stats().forged;
+  tamper = [](Pkt& p) {
+    if (p.from == 1 && p.d.size() > sizeof(ReplHdr) + REPL_TAG) p.d[sizeof(ReplHdr) + UID_MAX + 2] ^= 0x20;
+  };
+  localSet(0, 3, "Sari");
+  netRun(3000);
+  CHECK(!find(1, 3));
+  CHECK(units[1].node.stats().forged > forged);
+  tamper = nullptr;                             // jaringan pulih → PULL ulang
+  netRun(5000);
+  CHECK(find(1, 3) && !strcmp(find(1, 3)->name, "Sari"));
+
+  // STALE: unit 1 mengambil snapshot unit 0 diapit penanda ber-floor
+  CHECK(units[1].marks.empty());
+  ReplStamp floor = { 2, 7 };
+  units[0].node.stale(2, floor, netNow);
+  netRun(3000);
+  CHECK(units[0].node.stats().stales == 1);
+  CHECK(units[1].marks.size() == 2);
+  CHECK(units[1].marks[0].deleted == REPL_MARK_BEGIN && units[1].marks[1].deleted == REPL_MARK_END);
+  CHECK(units[1].marks[1].st.ver == 2 && units[1].marks[1].st.origin == 7);
+  units[0].node.stale(2, floor, netNow);        // dibatasi sekali per REPL_PULL_MS
+  units[0].node.stale(2, floor, netNow);
+  CHECK(units[0].node.stats().stales == 2);
+  netRun(3000);
+  CHECK(units[1].marks.size() == 4);
+}
+
+// Penuh: yang tergusur / lebih tua dari semua menaikkan floor
+static void tombFloor() {
+  ReplTombs<4> t;
+  UidKey k[6];
+  for (uint8_t i = 0; i < 6; i++) { uint8_t uid[4] = { 9, i, 0, 0 }; k[i] = uidKeyOf(uid, 4); }
+  for (uint8_t i = 0; i < 4; i++) t.put(k[i], { 10u + i, 1 });
+  CHECK(t.floor().ver == 0 && !t.buried({ 1, 1 }));
+  t.put(k[4], { 20, 1 });                       // gusur ver 10
+  CHECK(t.find(k[0]) < 0 && t.find(k[4]) >= 0 && t.floor().ver == 10);
+  t.put(k[5], { 5, 1 });                        // lebih tua dari semua: tidak disimpan
+  CHECK(t.find(k[5]) < 0 && t.floor().ver == 10);
+  CHECK(t.buried({ 10, 1 }) && t.buried({ 5, 9 }) && !t.buried({ 10, 2 }) && !t.buried({ 11, 0 }));
+}
+
+// Sketch: cap remote maksimum REPL_VER_JUMP di depan replClock
+static void verJump() {
+  hostBoot(FS);
+  ReplRec r;
+  memset(&r, 0, sizeof(r));
+  hostUid(0, r.uid);
+  r.uidLen = 4;
+  strcpy(r.name, "Lompat");
+  r.st.ver = replClock + REPL_VER_JUMP + 1; r.st.origin = 99;
+  replInQ.push({ r, 99 });
+  hostRun(5);
+  CHECK(userDb.count() == 0 && replJumps == 1);
+  CHECK(replClock < REPL_VER_JUMP);
+  r.st.ver = replClock + REPL_VER_JUMP;
+  replInQ.push({ r, 99 });
+  hostRun(5);
+  CHECK(userDb.count() == 1 && replJumps == 1);
+}
+
+static ReplRec liveRec(uint32_t i, uint32_t ver, uint32_t origin) {
+  ReplRec r;
+  memset(&r, 0, sizeof(r));
+  hostUid(i, r.uid);
+  r.uidLen = 4;
+  snprintf(r.name, NAME_SIZE, "Lama %u", (unsigned)i);
+  r.st.ver = ver; r.st.origin = origin;
+  return r;
+}
+
+static ReplRec marker(uint8_t type, const ReplStamp& floor) {
+  ReplRec r;
+  memset(&r, 0, sizeof(r));
+  r.deleted = type;
+  r.st = floor;
+  return r;
+}
+
+// Sketch: lebih dari REPL_TOMBS hapus → floor; user lama dari unit
+// yang terputus tidak hidup lagi, unit itu diminta rekonsiliasi
+#define GONE (REPL_TOMBS + 8)
+
+static void buried() {
+  hostBoot(FS);
+  hostEnroll(GONE);
+  User u;
+  userDb.read(0, u);
+  ReplStamp first = { u.ver, u.origin };
+  for (int i = 0; i < GONE; i++) removeUser(0);
+  CHECK(userDb.count() == 0 && tombs.count() == REPL_TOMBS);
+  CHECK(tombs.floor().ver >= first.ver + 7);
+  replInQ.push({ liveRec(0, first.ver, first.origin), 77 });
+  hostRun(5);
+  CHECK(userDb.count() == 0 && replBuried == 1 && replStaleTo == 77);
+  replInQ.push({ liveRec(GONE + 1, replClock + 1, 77), 77 });    // user baru: tetap diterima
+  hostRun(5);
+  CHECK(userDb.count() == 1);
+}
+
+// Boot ulang: floor ikut /tombs.bin
+static void floorKept() {
+  hostBoot(FS, false);
+  CHECK(tombs.count() == REPL_TOMBS && tombs.floor().ver > 0);
+  CHECK(replClock >= tombs.floor().ver);
+  CHECK(userDb.count() == 1);
+}
+
+// Sweep: user ber-cap ≤ floor yang tidak ada di snapshot peer dihapus
+static void sweep() {
+  hostBoot(FS);
+  hostEnroll(6);                                // cap 1..6
+  ReplStamp floor = { 4, 0xFFFFFFFFu };
+  User keep;
+  userDb.read(1, keep);
+  replInQ.push({ marker(REPL_MARK_BEGIN, floor), 77 });
+  replInQ.push({ liveRec(1, keep.ver, keep.origin), 77 });       // user 1 ada di snapshot
+  replInQ.push({ liveRec(40, 3, 77), 77 });                      // user baru dari peer
+  hostRun(5);
+  CHECK(replSweep && userDb.count() == 7);
+  removeUser(0);                                // user 40 (sudah ditandai) pindah ke slot 0
+  replInQ.push({ marker(REPL_MARK_END, floor), 77 });
+  hostRun(5);
+  CHECK(!replSweep);
+  // User 0 dihapus lokal, 2 & 3 disapu; tersisa 1 & 40 (ada di snapshot), 4 & 5 (cap > floor)
+  CHECK(userDb.count() == 4 && replSwept == 2);
+  CHECK(findKey(uidKeyOf(keep.uid, 4)) >= 0);
+  uint8_t uid[4];
+  hostUid(40, uid);
+  CHECK(findKey(uidKeyOf(uid, 4)) >= 0);
+  for (uint32_t i : { 4u, 5u }) { hostUid(i, uid); CHECK(findKey(uidKeyOf(uid, 4)) >= 0); }
+  for (uint16_t i = 0; i < tombs.count(); i++) CHECK(replNewer(tombs.at(i).st, floor));
+}
+
+int main() {
+  vectors();
+  tombFloor();
+  authenticated();
+  CHECK(hostFork(verJump) == 0);
+  CHECK(hostFork(buried) == 0);
+  CHECK(hostFork(floorKept) == 0);
+  CHECK(hostFork(sweep) == 0);
+  printf("repl_test OK\n");
+  return 0;
+}
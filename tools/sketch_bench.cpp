@@ -0,0 +1,215 @@
+/*
+ * sketch_bench.cpp — benchmark jalur panas sketch di host (Google Benchmark)
+ * Kode sketch apa adanya (tools/host_sketch.h), flash = direktori
+ * host, jam manual. Yang diukur:
+ *   tap       : kartu → rfidService → attendQ → netPump (log RAM,
+ *               rekap, siaran WS), dikenal / tak dikenal
+ *   persisten : flush jurnal satu batch, tulis record users.bin
+ *   serialisasi: halaman JSON /api/users.json & /api/logs
+ *   format WS  : pesan status, attend & daftar user penuh, JSON vs
+ *               MessagePack (encoder sketch apa adanya); counter
+ *               "bytes" = ukuran satu pesan di kabel (tanpa header WS)
+ * Angka host bukan angka ESP32 (flash & CPU jauh lebih cepat) —
+ * dipakai untuk membandingkan perubahan, bukan target absolut.
+ *
+ * Build: lihat CMakeLists.txt (target sketch_bench, butuh benchmark)
+ *   ./sketch_bench --benchmark_filter=Tap
+ */
+
+#include "host_sketch.h"
+
+#include <benchmark/benchmark.h>
+
+#define BENCH_USERS 1000
+
+static void BM_TapKnown(benchmark::State& st) {
+  uint8_t uid[4];
+  uint32_t i = 0;
+  for (auto _ : st) {
+    hostUid(i++ % BENCH_USERS, uid);
+    hostCardTap(uid, 4);
+    loop();
+    netRound();
+    st.PauseTiming();
+    hostClockAdvance((SCAN_COOLDOWN + 1) * 1000);   // cooldown per UID lewat
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_TapKnown);
+
+static void BM_TapUnknown(benchmark::State& st) {
+  uint8_t uid[4];
+  uint32_t i = 0;
+  for (auto _ : st) {
+    hostUid(BENCH_USERS + i++, uid);
+    hostCardTap(uid, 4);
+    loop();
+    netRound();
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_TapUnknown);
+
+static void BM_JournalFlush(benchmark::State& st) {
+  UidKey k = userDb.key(0);
+  for (auto _ : st) {
+    for (int i = 0; i < JOURNAL_BATCH; i++) journalAppend(k, 0, nowTs());   // batch penuh → flush
+  }
+  st.SetItemsProcessed(st.iterations() * JOURNAL_BATCH);
+  st.SetBytesProcessed(st.iterations() * JOURNAL_BATCH * sizeof(JournalRec));
+}
+BENCHMARK(BM_JournalFlush);
+
+static void BM_UserWrite(benchmark::State& st) {
+  char name[NAME_SIZE];
+  uint32_t i = 0;
+  for (auto _ : st) {
+    snprintf(name, sizeof(name), "Nama %u", (unsigned)i);
+    benchmark::DoNotOptimize(renameUser(i++ % BENCH_USERS, name));
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_UserWrite);
+
+static void BM_UsersJson(benchmark::State& st) {
+  static char buf[WS_PAGE_SIZE * 64];
+  size_t bytes = 0;
+  for (auto _ : st) {
+    JsonBuf o(buf, sizeof(buf));
+    User u;
+    o.raw("{\"users\":[");
+    for (int i = 0; i < userDb.count(); i++) {
+      userDb.read(i, u);
+      if (i) o.ch(',');
+      writeUserItem(o, u);
+    }
+    o.raw("]}");
+    bytes += o.length();
+  }
+  st.SetItemsProcessed(st.iterations() * userDb.count());
+  st.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_UsersJson);
+
+static void BM_LogsJson(benchmark::State& st) {
+  static char buf[WS_PAGE_SIZE * 32];
+  size_t bytes = 0;
+  for (auto _ : st) {
+    JsonBuf o(buf, sizeof(buf));
+    o.raw("{\"logs\":[");
+    for (int i = 0; i < LOG_PAGE_MAX && i < logRing.count(); i++) {
+      if (i) o.ch(',');
+      writeLogItem(o, logRing.at(i));
+    }
+    o.raw("]}");
+    bytes += o.length();
+  }
+  st.SetItemsProcessed(st.iterations() * std::min(LOG_PAGE_MAX, logRing.count()));
+  st.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_LogsJson);
+
+static void BM_StatusJson(benchmark::State& st) {
+  char buf[128];
+  size_t n = 0;
+  uint32_t up = 0;
+  for (auto _ : st) {
+    JsonBuf j(buf, sizeof(buf));
+    writeStatus(j, up++);
+    benchmark::DoNotOptimize(n = j.length());
+  }
+  st.counters["bytes"] = n;
+}
+BENCHMARK(BM_StatusJson);
+
+static void BM_StatusMp(benchmark::State& st) {
+  uint8_t buf[64];
+  size_t n = 0;
+  uint32_t up = 0;
+  for (auto _ : st) {
+    MpBuf m(buf, sizeof(buf));
+    mpStatus(m, up++);
+    benchmark::DoNotOptimize(n = m.length());
+  }
+  st.counters["bytes"] = n;
+}
+BENCHMARK(BM_StatusMp);
+
+static void BM_AttendJson(benchmark::State& st) {
+  char buf[160];
+  size_t n = 0;
+  const LogEntry& e = logRing.at(0);
+  for (auto _ : st) {
+    JsonBuf j(buf, sizeof(buf));
+    writeAttend(j, e);
+    benchmark::DoNotOptimize(n = j.length());
+  }
+  st.counters["bytes"] = n;
+}
+BENCHMARK(BM_AttendJson);
+
+static void BM_AttendMp(benchmark::State& st) {
+  uint8_t buf[128];
+  size_t n = 0;
+  const LogEntry& e = logRing.at(0);
+  for (auto _ : st) {
+    MpBuf m(buf, sizeof(buf));
+    mpAttend(m, e);
+    benchmark::DoNotOptimize(n = m.length());
+  }
+  st.counters["bytes"] = n;
+}
+BENCHMARK(BM_AttendMp);
+
+// Daftar user penuh sebagai satu pesan (di WS dipecah per WS_PAGE_SIZE)
+static void BM_UserListJson(benchmark::State& st) {
+  static char buf[WS_PAGE_SIZE * 64];
+  size_t n = 0;
+  for (auto _ : st) {
+    JsonBuf j(buf, sizeof(buf));
+    User u;
+    j.raw("{\"type\":\"users\",\"count\":").num(userDb.count()).raw(",\"users\":[");
+    for (int i = 0; i < userDb.count(); i++) {
+      userDb.read(i, u);
+      if (i) j.ch(',');
+      writeUserItem(j, u);
+    }
+    j.raw("]}");
+    n = j.length();
+  }
+  st.counters["bytes"] = n;
+  st.SetItemsProcessed(st.iterations() * userDb.count());
+}
+BENCHMARK(BM_UserListJson);
+
+static void BM_UserListMp(benchmark::State& st) {
+  static uint8_t buf[WS_PAGE_SIZE * 64];
+  size_t n = 0;
+  for (auto _ : st) {
+    MpBuf m(buf, sizeof(buf));
+    User u;
+    m.map(3).key("type").str("users").key("count").uint(userDb.count()).key("users");
+    size_t at = m.arrLater();
+    for (int i = 0; i < userDb.count(); i++) {
+      userDb.read(i, u);
+      mpUserItem(m, u);
+    }
+    m.patchArr(at, userDb.count());
+    n = m.length();
+  }
+  st.counters["bytes"] = n;
+  st.SetItemsProcessed(st.iterations() * userDb.count());
+}
+BENCHMARK(BM_UserListMp);
+
+int main(int argc, char** argv) {
+  hostBoot("bench_fs");
+  hostEnroll(BENCH_USERS);
+  for (int i = 0; i < logRing.capacity(); i++) addLog("User 1", "11:22:33:44", EPOCH_MIN + i);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * stream_test.cpp — memori keluaran besar (JsonBuf / chunked) di build host
+ * Untuk 200, 5000 dan 50000 tap (jurnal + arsip, ring RAM penuh,
+ * user = min(tap, MAX_USERS)) dihitung alokasi heap (operator new)
+ * dan puncak byte hidup di atas titik awal selama:
+ *   csv   : GET /api/logs/csv (semua tap, chunked)
+ *   users : GET /api/users.json
+ *   ws    : connect WebSocket + "sync" + "getLogs" (halaman WS_PAGE_SIZE)
+ * Pembanding: CSV yang sama dibangun dengan String += (cara lama).
+ * Puncak untuk 50000 tap tidak boleh lebih besar dari 200 tap + sedikit,
+ * beda dengan String += yang tumbuh sebesar output. Alokasi CSV datang
+ * dari LittleFS.open() tiap langkah (path di HAL, FILE VFS di ESP32),
+ * langsung dilepas: jumlahnya ikut jumlah chunk, bukan baris.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R stream_test)
+ */
+
+#include "host_sketch.h"
+
+#include <malloc.h>
+#include <poll.h>
+#include <new>
+
+static const char* FS = "stream_fs";
+static const char* PEAKS = "stream_peaks.txt";      // hasil per ukuran (antar fork)
+
+// ── Hitung alokasi: semua operator new/delete proses ini ──
+static size_t liveBytes, peakBytes, allocs;
+
+static void* counted(size_t n) {
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  allocs++;
+  liveBytes += malloc_usable_size(p);
+  if (liveBytes > peakBytes) peakBytes = liveBytes;
+  return p;
+}
+static void uncounted(void* p) {
+  if (!p) return;
+  liveBytes -= malloc_usable_size(p);
+  free(p);
+}
+void* operator new(size_t n)                     { return counted(n); }
+void* operator new[](size_t n)                   { return counted(n); }
+void  operator delete(void* p) noexcept          { uncounted(p); }
+void  operator delete[](void* p) noexcept        { uncounted(p); }
+void  operator delete(void* p, size_t) noexcept  { uncounted(p); }
+void  operator delete[](void* p, size_t) noexcept { uncounted(p); }
+
+struct Mem {
+  size_t allocs, peak, bytes;
+};
+
+// Mulai mengukur dari keadaan sekarang
+static size_t base;
+static void memStart() { allocs = 0; base = peakBytes = liveBytes; }
+static Mem  memStop(size_t bytes) { return { allocs, peakBytes - base, bytes }; }
+
+// ── Klien tanpa alokasi: buffer tetap, hanya hitung byte ──
+// Idle = 200 putaran tanpa data, tiap putaran menunggu ≤ 1 ms waktu
+// nyata (loopback tidak langsung sampai, jam sketch manual)
+static size_t drain(int fd) {
+  size_t total = 0;
+  for (int idle = 0; idle < 200; idle++) {
+    netRound();
+    hostClockAdvance(1000);
+    pollfd p = { fd, POLLIN, 0 };
+    if (poll(&p, 1, 1) <= 0) continue;
+    char b[4096];
+    ssize_t k = recv(fd, b, sizeof(b), MSG_DONTWAIT);
+    if (k == 0) break;
+    if (k > 0) { total += k; idle = 0; }
+  }
+  return total;
+}
+
+static Mem httpGet(const char* path) {
+  char req[256];
+  int n = snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n",
+                   path, AP_DOMAIN);
+  memStart();
+  int fd = hostConnect();
+  CHECK(fd >= 0);
+  send(fd, req, n, 0);
+  size_t got = drain(fd);
+  close(fd);
+  return memStop(got);
+}
+
+// Frame teks dari client: FIN + opcode 1, mask 0 (payload tidak berubah)
+static void wsText(int fd, const char* s) {
+  uint8_t f[128];
+  size_t n = strlen(s);
+  f[0] = 0x81; f[1] = 0x80 | (uint8_t)n;
+  memset(f + 2, 0, 4);
+  memcpy(f + 6, s, n);
+  send(fd, f, n + 6, 0);
+}
+
+static Mem wsSync() {
+  static const char UPGRADE[] =
+    "GET / HTTP/1.1\r\nHost: x\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  memStart();
+  int fd = hostConnect(81);
+  CHECK(fd >= 0);
+  send(fd, UPGRADE, sizeof(UPGRADE) - 1, 0);
+  size_t got = drain(fd);
+  wsText(fd, "{\"cmd\":\"sync\"}");
+  wsText(fd, "{\"cmd\":\"getLogs\"}");
+  got += drain(fd);
+  close(fd);
+  return memStop(got);
+}
+
+// Cara lama: satu String berisi seluruh CSV
+static Mem stringCsv(uint32_t taps) {
+  memStart();
+  {
+    String csv = "No,Nama,UID,Waktu\r\n";
+    for (uint32_t i = 0; i < taps; i++)
+      csv += String(i+1) + ",\"User " + String(i % MAX_USERS) + "\",\"11:22:33:44\","
+           + "2024-01-01 08:00:00\r\n";
+    return memStop(csv.length());
+  }
+}
+
+static void print(const char* what, const Mem& m) {
+  printf("  %-6s %9zu byte keluar  %7zu alokasi  puncak %9zu byte\n", what, m.bytes, m.allocs, m.peak);
+}
+
+static void measure(uint32_t taps) {
+  hostBoot(FS);
+  uint32_t users = std::min<uint32_t>(taps, MAX_USERS);
+  hostEnroll(users);
+  char uid[UID_STR];
+  uint8_t b[4];
+  for (uint32_t i = 0; i < taps; i++) {
+    int u = i % users;
+    journalAppend(userDb.key(u), u, EPOCH_MIN + i * 60);
+    hostUid(u, b);
+    uidFmt(uid, b, 4);
+    addLog("User", uid, EPOCH_MIN + i * 60);
+    if (jrnSeq > histDone + 2) for (int k = 0; k < 50 && jrnSeq > histDone + 1; k++) netRound();
+  }
+  journalFlush();
+  for (int k = 0; k < 200 && jrnSeq > histDone + 1; k++) netRound();
+  hostRun(10);
+
+  printf("%u tap, %u user, ring %d:\n", (unsigned)taps, (unsigned)users, logRing.count());
+  Mem csv = httpGet("/api/logs/csv");
+  Mem usr = httpGet("/api/users.json");
+  Mem ws  = wsSync();
+  Mem old = stringCsv(taps);
+  print("csv", csv);
+  print("users", usr);
+  print("ws", ws);
+  print("String", old);
+  CHECK(csv.bytes > taps * 20);                     // semua baris terkirim
+  CHECK(usr.bytes > users * 20);
+  CHECK(ws.bytes > (size_t)logRing.count() * 20);
+  CHECK(csv.allocs <= csv.bytes / sizeof(httpBuf) * 8 + 100);
+
+  FILE* f = fopen(PEAKS, "a");
+  fprintf(f, "%u %zu %zu %zu %zu\n", (unsigned)taps, csv.peak, usr.peak, ws.peak, old.peak);
+  fclose(f);
+}
+
+int main() {
+  remove(PEAKS);
+  for (uint32_t taps : { 200u, 5000u, 50000u }) CHECK(hostFork([taps] { measure(taps); }) == 0);
+
+  FILE* f = fopen(PEAKS, "r");
+  unsigned t;
+  size_t csv, usr, ws, old, csv0 = 0, usr0 = 0, ws0 = 0;
+  while (fscanf(f, "%u %zu %zu %zu %zu", &t, &csv, &usr, &ws, &old) == 5) {
+    if (t == 200) { csv0 = csv; usr0 = usr; ws0 = ws; continue; }
+    CHECK(csv <= csv0 + 4096);                      // konstan: tidak ikut jumlah tap
+    CHECK(usr <= usr0 + 4096);
+    CHECK(ws  <= ws0  + 4096);
+    CHECK(old > csv * 10);                          // String += tumbuh sebesar output
+  }
+  fclose(f);
+  printf("stream_test OK\n");
+  return 0;
+}
@@ -0,0 +1,314 @@
+/*
+ * tap_replay.cpp — Uji beban ujung ke ujung di build host
+ * Tap dari trace (rekaman atau sintetis) masuk lewat antrean kartu
+ * MFRC522 palsu (hostCardTap), jadi tiap tap melewati jalur yang sama
+ * dengan kartu sungguhan: rfidService → cooldown → lookup →
+ * journalAppend → attendQ → netPump (logRing, rekap, siaran WS).
+ * CLIENTS client WebSocket sungguhan (socket loopback ke port 81)
+ * membaca semua frame "attend". loop() + netRound() diputar per 1 ms
+ * jam palsu, seperti hostRun().
+ *
+ * Trace: satu tap per baris "MS UID [x]" — MS = ms sejak mulai, UID
+ * seperti di CSV (DE:AD:BE:EF), x = kartu tidak terdaftar; UID lain
+ * didaftarkan dulu. Tanpa TRACE dibuat trace sintetis (TAPS tap,
+ * RATE tap/detik, UNKNOWN% kartu asing, USERS user) ke replay_trace.txt
+ * lalu dibaca lagi lewat jalur yang sama.
+ *
+ * Laporan: tap/detik (jam sketch dan kapasitas host waktu nyata),
+ * latensi kartu ditempel → frame attend diterima client (waktu nyata,
+ * p50 / p99 / max) dan bcastHist sketch, drop attendQ / antrean WS /
+ * jurnal, puncak heap (operator new). Exit 1 kalau ada tap lolos
+ * cooldown yang tidak sampai ke jurnal, logRing, rekap dan semua
+ * client tepat sekali — naikkan RATE / CLIENTS sampai titik itu.
+ *
+ * Build: lihat CMakeLists.txt (target tap_replay, ctest -R tap_replay)
+ *   cd build/run/tap_replay && ../../tap_replay [CLIENTS=4] [TAPS=600] [RATE=50] [UNKNOWN=5] [TRACE]
+ */
+
+#include "host_sketch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#define USERS 400              // < DAY_SLOTS: rekap memuat semua user
+
+static const char* FS    = "replay_fs";
+static const char* TRACE = "replay_trace.txt";
+
+// ── Hitung alokasi: semua operator new/delete proses ini (lihat stream_test) ──
+static size_t liveBytes, peakBytes;
+
+static void* counted(size_t n) {
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  liveBytes += malloc_usable_size(p);
+  if (liveBytes > peakBytes) peakBytes = liveBytes;
+  return p;
+}
+static void uncounted(void* p) {
+  if (!p) return;
+  liveBytes -= malloc_usable_size(p);
+  free(p);
+}
+void* operator new(size_t n)                     { return counted(n); }
+void* operator new[](size_t n)                   { return counted(n); }
+void  operator delete(void* p) noexcept          { uncounted(p); }
+void  operator delete[](void* p) noexcept        { uncounted(p); }
+void  operator delete(void* p, size_t) noexcept  { uncounted(p); }
+void  operator delete[](void* p, size_t) noexcept { uncounted(p); }
+
+typedef std::chrono::steady_clock Clock;
+
+static double usSince(Clock::time_point t0) {
+  return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+struct Tap {
+  uint32_t ms;
+  uint8_t  uid[UID_MAX];
+  uint8_t  len;
+  bool     known;
+  char     str[UID_STR];
+};
+
+// Kartu yang sudah ditempel (urut), untuk mencocokkan frame attend
+struct Sent {
+  const Tap*        tap;
+  Clock::time_point at;
+};
+
+static void synthTrace(uint32_t taps, uint32_t rate, uint32_t unknownPct) {
+  std::mt19937 rng(1);
+  FILE* f = fopen(TRACE, "w");
+  CHECK(f);
+  fprintf(f, "# %u tap, %u/detik, %u%% asing, %d user\n", taps, rate, unknownPct, USERS);
+  for (uint32_t i = 0; i < taps; i++) {
+    bool known = rng() % 100 >= unknownPct;
+    uint8_t uid[4];
+    hostUid(known ? rng() % USERS : 100000 + i, uid);
+    char s[UID_STR];
+    uidFmt(s, uid, 4);
+    fprintf(f, "%u %s%s\n", (unsigned)((uint64_t)i * 1000 / rate), s, known ? "" : " x");
+  }
+  fclose(f);
+}
+
+static std::vector<Tap> readTrace(const char* path) {
+  std::vector<Tap> out;
+  std::ifstream in(path);
+  CHECK(in);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream s(line);
+    std::string uid, mark;
+    Tap t = {};
+    s >> t.ms >> uid >> mark;
+    t.len = strToUid(uid.c_str(), t.uid);
+    if (!t.len) { fprintf(stderr, "trace: UID tidak valid: %s\n", line.c_str()); exit(2); }
+    t.known = mark != "x";
+    uidFmt(t.str, t.uid, t.len);
+    out.push_back(t);
+  }
+  std::stable_sort(out.begin(), out.end(), [](const Tap& a, const Tap& b) { return a.ms < b.ms; });
+  return out;
+}
+
+static void enroll(const std::vector<Tap>& trace) {
+  std::map<std::string, bool> seen;
+  for (const Tap& t : trace) {
+    if (!t.known || seen[t.str]) continue;
+    seen[t.str] = true;
+    User u;
+    memset(&u, 0, sizeof(u));
+    memcpy(u.uid, t.uid, t.len);
+    u.uidLen = t.len;
+    snprintf(u.name, NAME_SIZE, "User %u", (unsigned)userDb.count());
+    ReplStamp st = replStampNew();
+    u.ver = st.ver; u.origin = st.origin;
+    CHECK(userDb.add(u, false) >= 0);
+  }
+  userDb.writeHeader();
+}
+
+// ── Client WS: frame dari server tidak di-mask ──
+struct Client {
+  int                 fd;
+  std::string         buf;
+  bool                open;
+  size_t              next;            // Sent berikutnya yang belum diterima
+  uint32_t            attend, stray;
+  std::vector<double> latUs;
+};
+
+static bool wsOpen(Client& c) {
+  static const char UPGRADE[] =
+    "GET / HTTP/1.1\r\nHost: x\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  c = Client();
+  c.fd = hostConnect(81);
+  if (c.fd < 0) return false;
+  send(c.fd, UPGRADE, sizeof(UPGRADE) - 1, 0);
+  for (int i = 0; i < 500; i++) {
+    netRound();
+    hostClockAdvance(1000);
+    char b[4096];
+    ssize_t k = recv(c.fd, b, sizeof(b), MSG_DONTWAIT);
+    if (k == 0) break;
+    if (k > 0) c.buf.append(b, k);
+    size_t end = c.buf.find("\r\n\r\n");
+    if (end == std::string::npos) continue;
+    c.open = c.buf.compare(0, 12, "HTTP/1.1 101") == 0;
+    c.buf.erase(0, end + 4);
+    return c.open;
+  }
+  return false;
+}
+
+static void wsRead(Client& c, const std::vector<Sent>& sent) {
+  char b[8192];
+  ssize_t k;
+  while ((k = recv(c.fd, b, sizeof(b), MSG_DONTWAIT)) > 0) c.buf.append(b, k);
+  if (k == 0) c.open = false;
+  for (;;) {
+    if (c.buf.size() < 2) return;
+    const uint8_t* p = (const uint8_t*)c.buf.data();
+    size_t hdr = 2, n = p[1] & 0x7F;
+    if (n == 126) { if (c.buf.size() < 4) return; n = p[2] << 8 | p[3]; hdr = 4; }
+    else if (n == 127) { if (c.buf.size() < 10) return; n = 0; for (int i = 2; i < 10; i++) n = n << 8 | p[i]; hdr = 10; }
+    if (c.buf.size() < hdr + n) return;
+    // Tanpa alokasi di sini: heap yang diukur hanya milik sketch
+    char msg[WS_PAGE_SIZE + 64] = "";
+    bool text = (p[0] & 0x0F) == 1 && n < sizeof(msg);
+    if (text) memcpy(msg, p + hdr, n);
+    c.buf.erase(0, hdr + n);
+    if (!text || !strstr(msg, "\"type\":\"attend\"")) continue;
+    const char* uid = strstr(msg, "\"uid\":\"");
+    if (!uid) { c.stray++; continue; }
+    uid += 7;
+    size_t len = strcspn(uid, "\"");
+    // Kartu diproses urut; yang dilewati = asing / kena cooldown
+    size_t i = c.next;
+    while (i < sent.size() && (strlen(sent[i].tap->str) != len || strncmp(uid, sent[i].tap->str, len))) i++;
+    if (i == sent.size()) { c.stray++; continue; }
+    c.latUs.push_back(usSince(sent[i].at));
+    c.next = i + 1;
+    c.attend++;
+  }
+}
+
+static uint32_t jrnTotal() { return jrnSeq * JOURNAL_SEG_RECS + jrnSegRecs + jrnPendingN; }
+
+static uint32_t summaryTotal() {
+  uint32_t n = 0;
+  for (uint16_t s = 0; s < daySum.slots(); s++) n += daySum.at(s).count;
+  return n;
+}
+
+static double pct(std::vector<double>& v, double q) {
+  if (v.empty()) return 0;
+  size_t i = std::min(v.size() - 1, (size_t)(v.size() * q));
+  std::nth_element(v.begin(), v.begin() + i, v.end());
+  return v[i];
+}
+
+int main(int argc, char** argv) {
+  int      clients = argc > 1 ? atoi(argv[1]) : 4;
+  uint32_t taps    = argc > 2 ? atoi(argv[2]) : 600;
+  uint32_t rate    = argc > 3 ? atoi(argv[3]) : 50;
+  uint32_t unknown = argc > 4 ? atoi(argv[4]) : 5;
+  const char* trace = argc > 5 ? argv[5] : nullptr;
+  if (clients > WEBSOCKETS_SERVER_CLIENT_MAX) clients = WEBSOCKETS_SERVER_CLIENT_MAX;
+  if (!rate) rate = 1;
+
+  if (!trace) { synthTrace(taps, rate, unknown); trace = TRACE; }
+  std::vector<Tap> tr = readTrace(trace);
+  CHECK(!tr.empty());
+
+  hostBoot(FS);
+  enroll(tr);
+  // Pagi hari: rekap aktif, run tidak melewati tengah malam
+  timeSet(EPOCH_MIN - EPOCH_MIN % 86400 + 86400 + 7 * 3600, 0);
+  hostRun(100);
+
+  std::vector<Client> cl(clients);
+  for (Client& c : cl) CHECK(wsOpen(c));
+  std::vector<Sent> sent;
+  sent.reserve(tr.size());
+  for (Client& c : cl) { c.buf.reserve(1 << 16); c.latUs.reserve(tr.size()); }
+  for (int i = 0; i < 200; i++) {                  // status awal, sync
+    hostRun(1);
+    for (Client& c : cl) wsRead(c, sent);
+  }
+
+  bcastHist.clear();
+  uint32_t jrn0 = jrnTotal(), log0 = logRing.seq(), sum0 = summaryTotal();
+  uint32_t tap0 = tapStat.count, drop0 = attendQ.drops(), lost0 = jrnLost, evict0 = wsEvictions;
+  uint32_t wsDrop0 = 0;
+  for (int c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) wsDrop0 += wsPeer[c].q.drops();
+  size_t heap0 = peakBytes = liveBytes;
+
+  Clock::time_point w0 = Clock::now();
+  size_t next = 0;
+  uint32_t ms = 0, idle = 0, lag = 0;
+  for (;; ms++) {
+    // Pembaca hanya memegang satu kartu: tap berikutnya menunggu
+    // sampai kartu sebelumnya dibaca (antre di depan pembaca)
+    if (next < tr.size() && tr[next].ms <= ms && !hostCardsPending()) {
+      const Tap& t = tr[next++];
+      lag = std::max(lag, ms - t.ms);
+      hostCardTap(t.uid, t.len);
+      sent.push_back({ &t, Clock::now() });
+    }
+    uint32_t before = 0, after = 0;
+    for (Client& c : cl) before += c.attend;
+    loop();
+    netRound();
+    hostClockAdvance(1000);
+    for (Client& c : cl) { wsRead(c, sent); after += c.attend; }
+    if (next < tr.size() || hostCardsPending() || after != before) idle = 0;
+    else if (++idle >= 500) break;                  // 0,5 detik tanpa frame baru
+  }
+  double wallUs = usSince(w0);
+  ms -= idle;
+
+  uint32_t acc = jrnTotal() - jrn0, passed = tapStat.count - tap0;
+  uint32_t logs = logRing.seq() - log0, sums = summaryTotal() - sum0;
+  uint32_t qDrops = attendQ.drops() - drop0, lost = jrnLost - lost0, wsDrops = 0 - wsDrop0;
+  for (int c = 0; c < WEBSOCKETS_SERVER_CLIENT_MAX; c++) wsDrops += wsPeer[c].q.drops();
+  std::vector<double> lat;
+  bool ok = logs == acc && sums == acc && !qDrops && !lost && wsEvictions == evict0;
+  for (Client& c : cl) {
+    lat.insert(lat.end(), c.latUs.begin(), c.latUs.end());
+    ok = ok && c.open && c.attend == acc && !c.stray;
+  }
+
+  printf("trace %s: %zu tap dalam %.1f detik jam sketch, %d client WS\n",
+         trace, tr.size(), ms / 1000.0, clients);
+  printf("  lolos cooldown  : %u (asing %u, cooldown %zu)\n", passed, passed - acc, tr.size() - passed);
+  printf("  tercatat        : jurnal %u, logRing %u, rekap %u\n", acc, logs, sums);
+  printf("  tap/detik       : %.1f jam sketch, antre di pembaca maks %u ms\n",
+         ms ? acc * 1000.0 / ms : 0.0, lag);
+  printf("  waktu nyata     : %.0f ms, %.1f µs per putaran loop() + netRound()\n",
+         wallUs / 1000, ms ? wallUs / ms : 0.0);
+  printf("  tap → client    : p50 %.0f µs, p99 %.0f µs, max %.0f µs (waktu nyata, %zu frame)\n",
+         pct(lat, 0.5), pct(lat, 0.99), pct(lat, 1.0), lat.size());
+  printf("  tap → siaran WS : p99 <= %u µs, max %u µs (jam sketch, bcastHist)\n",
+         bcastHist.quantile(990), bcastHist.max);
+  printf("  drop            : attendQ %u, jurnal %u, antrean WS %u, client diputus %u\n",
+         qDrops, lost, wsDrops, wsEvictions - evict0);
+  printf("  heap            : puncak %zu byte di atas awal (operator new)\n", peakBytes - heap0);
+  for (size_t i = 0; i < cl.size(); i++)
+    printf("  client #%zu       : %u/%u attend%s%s\n", i, cl[i].attend, acc,
+           cl[i].stray ? " (frame tak dikenal)" : "", cl[i].open ? "" : " (terputus)");
+  for (Client& c : cl) close(c.fd);
+  printf(ok ? "tap_replay OK\n" : "tap_replay GAGAL: ada tap yang hilang\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/*
+ * timer_test.cpp — timer_wheel.h dengan jam palsu
+ * Jam diberikan langsung ke run(), tanpa sketch: after / every,
+ * cancel dengan id basi (sudah jalan, dibatalkan, slot dipakai ulang),
+ * callback yang menjadwal ulang / membatalkan di dalam fire(), jam
+ * melompat lebih dari SLOTS tick (timer jatuh tempo jalan tepat sekali,
+ * periodik tanpa burst, timer jauh tidak ikut), dan millis() wrap.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R timer_test)
+ */
+
+#include "host_sketch.h"
+
+#include <vector>
+
+#define TIMERS 8
+#define SLOTS  16
+#define TICK   10
+
+typedef TimerWheel<TIMERS, SLOTS, TICK> Wheel;
+
+struct Probe {
+  std::vector<uint32_t> at;                       // jam tiap kali jalan
+};
+
+static uint32_t now;
+
+static void hit(void* arg) { ((Probe*)arg)->at.push_back(now); }
+
+// Jam maju per ms seperti loop()
+static void step(Wheel& w, uint32_t ms) {
+  for (uint32_t i = 0; i < ms; i++) w.run(++now);
+}
+
+static void basic(uint32_t start) {
+  Wheel w;
+  now = start;
+  w.run(now);
+  Probe once, per;
+  w.after(25, hit, &once);                        // dibulatkan ke atas: 3 tick
+  w.every(50, hit, &per);
+  step(w, 29);
+  CHECK(once.at.empty());
+  step(w, 1);
+  CHECK(once.at.size() == 1 && once.at[0] == start + 30);
+  step(w, 470);
+  CHECK(once.at.size() == 1);
+  CHECK(per.at.size() == 10);
+  for (size_t i = 0; i < per.at.size(); i++) CHECK(per.at[i] == (uint32_t)(start + 50 * (i + 1)));
+  CHECK(w.pending() == 1);
+}
+
+static void cancels() {
+  Wheel w;
+  now = 0;
+  w.run(now);
+  Probe a, b;
+  TimerId done = w.after(10, hit, &a);
+  step(w, 10);
+  CHECK(a.at.size() == 1 && !w.active(done) && !w.cancel(done));    // sudah jalan
+
+  TimerId id = w.after(100, hit, &a);
+  CHECK(w.cancel(id) && !w.cancel(id));           // dua kali: yang kedua basi
+  TimerId reuse = w.after(100, hit, &b);          // slot yang sama, generasi baru
+  CHECK((reuse & 0xFF) == (id & 0xFF) && reuse != id);
+  CHECK(!w.cancel(id) && w.active(reuse));
+  step(w, 200);
+  CHECK(a.at.size() == 1 && b.at.size() == 1);
+  CHECK(!w.cancel(TIMER_NONE) && w.after(10, nullptr) == TIMER_NONE);
+
+  for (int i = 0; i < TIMERS; i++) CHECK(w.after(1000, hit, &a) != TIMER_NONE);
+  CHECK(w.after(1000, hit, &a) == TIMER_NONE);    // penuh
+}
+
+// Callback di dalam fire(): jadwal ulang diri sendiri, batalkan
+// timer lain di slot yang sama, tambah timer sejauh satu putaran
+struct Chain {
+  Wheel*  w;
+  int     left;
+  Probe   p;
+  TimerId victim;
+};
+
+static void rearm(void* arg) {
+  Chain* c = (Chain*)arg;
+  c->p.at.push_back(now);
+  if (--c->left) c->w->after(TICK, rearm, c);
+}
+
+static void killer(void* arg) {
+  Chain* c = (Chain*)arg;
+  c->p.at.push_back(now);
+  CHECK(c->w->cancel(c->victim));
+  c->w->after(SLOTS * TICK, hit, &c->p);          // slot yang sedang diproses
+}
+
+static void inFire() {
+  Wheel w;
+  now = 0;
+  w.run(now);
+  Chain c = { &w, 5, {}, TIMER_NONE };
+  w.after(TICK, rearm, &c);
+  step(w, 100);
+  CHECK(c.p.at.size() == 5);
+  for (int i = 0; i < 5; i++) CHECK(c.p.at[i] == (uint32_t)(i + 1) * TICK);
+
+  Probe victim;
+  Chain k = { &w, 0, {}, TIMER_NONE };
+  k.victim = w.after(50, hit, &victim);
+  w.after(50, killer, &k);                        // tick sama; rantai slot LIFO → killer dulu
+  uint32_t t0 = now;
+  step(w, 50);
+  CHECK(k.p.at.size() == 1 && victim.at.empty());
+  step(w, SLOTS * TICK);
+  CHECK(k.p.at.size() == 2 && k.p.at[1] == t0 + 50 + SLOTS * TICK);
+  CHECK(w.pending() == 0);
+}
+
+// loop() tertahan jauh lebih lama dari satu putaran wheel
+static void jump() {
+  Wheel w;
+  now = 1000;
+  w.run(now);
+  Probe a, b, far, per;
+  w.after(30, hit, &a);
+  w.after(170, hit, &b);                          // > SLOTS tick: tetap di slot-nya
+  w.after(2000, hit, &far);
+  w.every(40, hit, &per);
+  now += 500;
+  w.run(now);
+  CHECK(a.at.size() == 1 && b.at.size() == 1);
+  CHECK(far.at.empty());
+  CHECK(per.at.size() == 1);                      // tanpa burst
+  step(w, 40);
+  CHECK(per.at.size() == 2 && per.at[1] == 1540);
+  step(w, 1459);
+  CHECK(far.at.empty());
+  step(w, 1);
+  CHECK(far.at.size() == 1 && far.at[0] == 3000);
+}
+
+int main() {
+  basic(0);
+  basic(0xFFFFFFFFu - 260);                       // millis() wrap di tengah
+  cancels();
+  inFire();
+  jump();
+  printf("timer_test OK\n");
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * uid_bench.cpp — Cari UID: indeks hash (uid_index.h) vs scan linear
+ * Scan linear = cara lama (bandingkan keys[] satu per satu); indeks =
+ * UidIndex dengan SLOTS pangkat 2 >= 2x user, seperti userDb di sketch.
+ * Untuk 50, 1000 dan 10000 user diukur lookup/detik dengan campuran
+ * 90% kartu terdaftar + 10% kartu asing (asing = scan penuh / probe
+ * sampai slot kosong). Hasil kedua cara dibandingkan tiap lookup.
+ * 10000 user di atas MAX_USERS sketch (2048) — hanya untuk melihat
+ * skala.
+ *
+ * Build:
+ *   g++ -std=c++17 -O2 -I project_absensi_esp32 tools/uid_bench.cpp -o /tmp/uid_bench
+ *   (atau lihat CMakeLists.txt)
+ * Pakai:
+ *   /tmp/uid_bench [LOOKUP=2000000] [SEED=1]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "uid_index.h"
+
+static double secsSince(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// 80% kartu 4 byte, sisanya 7 byte (campuran kartu MIFARE di lapangan)
+static UidKey randomKey(std::mt19937& rng) {
+  uint8_t uid[UID_MAX];
+  uint8_t len = rng() % 5 ? 4 : 7;
+  for (uint8_t i = 0; i < len; i++) uid[i] = (uint8_t)rng();
+  return uidKeyOf(uid, len);
+}
+
+static int linearFind(const std::vector<UidKey>& keys, const UidKey& k) {
+  for (size_t i = 0; i < keys.size(); i++) if (keys[i] == k) return (int)i;
+  return -1;
+}
+
+template <int USERS, uint32_t SLOTS>
+static void run(long lookups, std::mt19937& rng) {
+  static_assert(SLOTS >= 2 * USERS, "load factor <= 0.5");
+  std::vector<UidKey> keys;
+  while (keys.size() < USERS) {
+    UidKey k = randomKey(rng);
+    if (linearFind(keys, k) < 0) keys.push_back(k);
+  }
+  std::unique_ptr<UidIndex<SLOTS>> idx(new UidIndex<SLOTS>(keys.data()));
+  UidIndex<SLOTS>& index = *idx;
+  for (int i = 0; i < USERS; i++) index.insert(keys[i], i);
+
+  // Urutan tap tetap, sama untuk kedua cara
+  std::vector<UidKey> taps(4096);
+  for (UidKey& t : taps) t = rng() % 10 ? keys[rng() % USERS] : randomKey(rng);
+  std::vector<int> want(taps.size());
+  for (size_t i = 0; i < taps.size(); i++) {
+    want[i] = linearFind(keys, taps[i]);
+    if (index.find(taps[i]) != want[i]) { fprintf(stderr, "indeks salah di tap %zu\n", i); exit(1); }
+  }
+
+  long sum = 0;
+  long linearN = USERS > 1000 ? lookups / 20 : lookups;     // scan 10000 user: ambil sampel lebih kecil
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < linearN; i++) sum += linearFind(keys, taps[i & 4095]);
+  double linear = linearN / secsSince(t0);
+
+  t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < lookups; i++) sum += index.find(taps[i & 4095]);
+  double hashed = lookups / secsSince(t0);
+
+  printf("%6d user  slot %5u  linear %12.0f/dtk  indeks %12.0f/dtk  x%.0f  (cek %ld)\n",
+         USERS, (unsigned)SLOTS, linear, hashed, hashed / linear, sum & 0xFF);
+}
+
+int main(int argc, char** argv) {
+  long lookups = argc > 1 ? atol(argv[1]) : 2000000;
+  std::mt19937 rng(argc > 2 ? atoi(argv[2]) : 1);
+  printf("lookup: %ld per ukuran, 10%% kartu asing\n", lookups);
+  run<50, 128>(lookups, rng);
+  run<1000, 2048>(lookups, rng);
+  run<10000, 32768>(lookups, rng);
+  return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * uid_test.cpp — uid_index.h: key UID 4/7/10 byte + indeks hash
+ * Round-trip uidKeyOf ↔ uidKeyBytes untuk UID acak campuran (termasuk
+ * byte 00/FF dan UID yang prefiks UID lain), len > UID_MAX dipotong.
+ * Churn: tambah / swap-remove acak seperti userDb.remove() (erase +
+ * relabel) pada MAX_USERS / UID_SLOTS sketch, tiap langkah dibandingkan
+ * dengan std::map; kartu asing harus -1. Kecepatan: lookup indeks pada
+ * tabel penuh harus jauh di atas scan linear.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R uid_test)
+ */
+
+#include "host_sketch.h"
+
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::mt19937 rng(7);
+
+static std::string bytesOf(const uint8_t* uid, uint8_t len) {
+  return std::string((const char*)uid, len);
+}
+
+// 4 / 7 / 10 byte merata; sebagian byte dipaksa 00 / FF
+static uint8_t randomUid(uint8_t* uid) {
+  static const uint8_t LENS[] = { 4, 7, 10 };
+  uint8_t len = LENS[rng() % 3];
+  for (uint8_t i = 0; i < len; i++) {
+    uint32_t r = rng();
+    uid[i] = r % 8 == 0 ? 0x00 : r % 8 == 1 ? 0xFF : (uint8_t)(r >> 8);
+  }
+  return len;
+}
+
+static void roundTrip() {
+  for (int n = 0; n < 100000; n++) {
+    uint8_t uid[UID_MAX], out[UID_MAX];
+    uint8_t len = randomUid(uid);
+    UidKey k = uidKeyOf(uid, len);
+    memset(out, 0xAA, sizeof(out));
+    CHECK(uidKeyBytes(k, out) == len && memcmp(out, uid, len) == 0);
+    CHECK(uidKeyOf(out, len) == k);
+    // UID sama dengan 0 di belakang / lebih pendek ≠ key yang sama
+    uint8_t pad[UID_MAX] = {};
+    memcpy(pad, uid, len);
+    if (len < UID_MAX) CHECK(uidKeyOf(pad, len == 4 ? 7 : 10) != k);
+    CHECK(uidKeyOf(uid, len - 1) != k);
+  }
+  uint8_t big[UID_MAX + 2], out[UID_MAX];
+  for (int i = 0; i < UID_MAX + 2; i++) big[i] = (uint8_t)(i + 1);
+  CHECK(uidKeyOf(big, UID_MAX + 2) == uidKeyOf(big, UID_MAX));
+  CHECK(uidKeyBytes(uidKeyOf(big, UID_MAX + 2), out) == UID_MAX && memcmp(out, big, UID_MAX) == 0);
+  CHECK(uidKeyBytes(uidKeyRaw(0xFF000001u), out) == 0);   // penanda jurnal bukan UID
+}
+
+// Tabel user dense + indeks, sama dengan UserStore tanpa file
+struct Table {
+  UidKey                   keys[MAX_USERS] = {};
+  UidIndex<UID_SLOTS>      index;
+  int                      count = 0;
+  std::map<std::string, int> ref;              // bytes UID → index
+
+  Table() : index(keys) {}
+
+  void add(const uint8_t* uid, uint8_t len) {
+    keys[count] = uidKeyOf(uid, len);
+    index.insert(keys[count], count);
+    ref[bytesOf(uid, len)] = count++;
+  }
+
+  void remove(int idx) {
+    int last = count - 1;
+    uint8_t b[UID_MAX];
+    ref.erase(bytesOf(b, uidKeyBytes(keys[idx], b)));
+    index.erase(keys[idx], idx);
+    if (idx != last) {
+      index.relabel(keys[last], last, idx);
+      keys[idx] = keys[last];
+      ref[bytesOf(b, uidKeyBytes(keys[idx], b))] = idx;
+    }
+    count--;
+  }
+
+  void verify() {
+    CHECK((int)ref.size() == count);
+    for (auto& e : ref) {
+      UidKey k = uidKeyOf((const uint8_t*)e.first.data(), (uint8_t)e.first.size());
+      CHECK(index.find(k) == e.second && keys[e.second] == k);
+    }
+  }
+};
+
+static void churn() {
+  static Table t;
+  uint8_t uid[UID_MAX];
+  int steps = 0;
+  for (int round = 0; round < 4; round++) {
+    // Isi sampai penuh, lalu kuras ke ±10% — probe chain panjang terbentuk dan dibongkar
+    while (t.count < MAX_USERS) {
+      uint8_t len = randomUid(uid);
+      if (t.ref.count(bytesOf(uid, len))) continue;
+      if (t.count && rng() % 3 == 0) t.remove(rng() % t.count);
+      t.add(uid, len);
+      if (++steps % 97 == 0) t.verify();
+    }
+    t.verify();
+    while (t.count > MAX_USERS / 10) {
+      t.remove(rng() % t.count);
+      if (rng() % 4 == 0) {
+        uint8_t len = randomUid(uid);
+        if (!t.ref.count(bytesOf(uid, len))) t.add(uid, len);
+      }
+      if (++steps % 97 == 0) t.verify();
+    }
+    t.verify();
+  }
+  for (int n = 0; n < 20000; n++) {                // kartu asing
+    uint8_t len = randomUid(uid);
+    if (!t.ref.count(bytesOf(uid, len))) CHECK(t.index.find(uidKeyOf(uid, len)) == -1);
+  }
+  // Hapus semua, indeks kosong lagi
+  while (t.count) t.remove(rng() % t.count);
+  for (int n = 0; n < 1000; n++) {
+    uint8_t len = randomUid(uid);
+    CHECK(t.index.find(uidKeyOf(uid, len)) == -1);
+  }
+  printf("churn: %d langkah sampai %d user\n", steps, MAX_USERS);
+}
+
+static double secsSince(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// Tabel penuh (load factor 0.5), 10% kartu asing
+static void speed() {
+  static Table t;
+  uint8_t uid[UID_MAX];
+  while (t.count < MAX_USERS) {
+    uint8_t len = randomUid(uid);
+    if (!t.ref.count(bytesOf(uid, len))) t.add(uid, len);
+  }
+  std::vector<UidKey> taps(4096);
+  for (UidKey& k : taps) {
+    if (rng() % 10) { k = t.keys[rng() % t.count]; continue; }
+    uint8_t len = randomUid(uid);
+    k = uidKeyOf(uid, len);
+  }
+
+  const long N = 2000000, LN = N / 50;
+  long sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < LN; i++) {
+    const UidKey& k = taps[i & 4095];
+    int f = -1;
+    for (int j = 0; j < t.count; j++) if (t.keys[j] == k) { f = j; break; }
+    sum += f;
+  }
+  double linear = LN / secsSince(t0);
+  t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < N; i++) sum += t.index.find(taps[i & 4095]);
+  double hashed = N / secsSince(t0);
+  printf("%d user: linear %.0f/dtk, indeks %.0f/dtk, x%.0f (cek %ld)\n",
+         t.count, linear, hashed, hashed / linear, sum & 0xFF);
+  CHECK(hashed > 20 * linear);
+}
+
+int main() {
+  roundTrip();
+  churn();
+  speed();
+  printf("uid_test OK\n");
+  return 0;
+}
@@ -0,0 +1,204 @@
+/*
+ * users_test.cpp — /users.bin v3 di build host
+ * Round-trip: UID 4/7/10 byte, rename, swap-remove → boot ulang →
+ * isi & cap LWW sama persis. Korupsi: record dengan CRC salah / UID
+ * dobel dibuang saat boot dan file dipadatkan (boot berikutnya
+ * stabil); file terpotong → hanya record utuh; header rusak → kosong.
+ * Migrasi: users.bin v2 (tanpa cap) → v3, cap {0, 0}.
+ *
+ * Build: lihat CMakeLists.txt (ctest -R users_test)
+ */
+
+#include "host_sketch.h"
+
+#include <fstream>
+#include <set>
+#include <sstream>
+
+static const char* FS = "users_fs";
+static const char* EXPECT = "users_expect.txt";      // isi users.bin yang diharapkan (antar fork)
+#define USERS 20
+
+static std::string line(const User& u) {
+  char uid[UID_STR];
+  uidFmt(uid, u.uid, u.uidLen);
+  std::ostringstream s;
+  s << uid << ' ' << (int)u.uidLen << ' ' << u.name << '|' << u.ver << ' ' << u.origin;
+  return s.str();
+}
+
+static std::set<std::string> current() {
+  std::set<std::string> s;
+  for (int i = 0; i < userDb.count(); i++) {
+    User u;
+    CHECK(userDb.read(i, u));
+    CHECK(userDb.find(userDb.key(i)) == i);
+    s.insert(line(u));
+  }
+  return s;
+}
+
+static std::set<std::string> expected() {
+  std::set<std::string> s;
+  std::ifstream f(EXPECT);
+  for (std::string l; std::getline(f, l); ) s.insert(l);
+  return s;
+}
+
+static void saveExpected() {
+  std::ofstream f(EXPECT);
+  for (const std::string& l : current()) f << l << '\n';
+}
+
+static DbHeader header() {
+  DbHeader h;
+  memset(&h, 0, sizeof(h));
+  File f = LittleFS.open(USERS_DB, "r");
+  f.read((uint8_t*)&h, sizeof(h));
+  return h;
+}
+
+// Tulis n byte di offset users.bin apa adanya (di luar userDb)
+static void poke(size_t at, const void* d, size_t n) {
+  File f = LittleFS.open(USERS_DB, "r+");
+  CHECK(f && f.seek(at));
+  CHECK(f.write((const uint8_t*)d, n) == n);
+}
+
+static size_t recAt(int i) { return sizeof(DbHeader) + (size_t)i * sizeof(DbRecord); }
+
+static void fill() {
+  hostBoot(FS);
+  for (int i = 0; i < USERS; i++) {
+    uint8_t uid[UID_MAX];
+    uint8_t len = i % 3 == 0 ? 4 : i % 3 == 1 ? 7 : 10;
+    for (uint8_t k = 0; k < len; k++) uid[k] = (uint8_t)(i * 31 + k * 7 + 1);
+    CHECK(addUser(uid, len));
+  }
+  CHECK(renameUser(3, "Nama Baru"));
+  CHECK(removeUser(5));                            // user terakhir pindah ke slot 5
+  CHECK(userDb.count() == USERS - 1);
+  saveExpected();
+}
+
+static void roundTrip() {
+  hostBoot(FS, false);
+  DbHeader h = header();
+  CHECK(h.magic == DB_MAGIC && h.version == DB_VERSION && h.recSize == sizeof(DbRecord));
+  CHECK(h.count == USERS - 1);
+  CHECK(current() == expected());
+  CHECK(replClock >= userDb.maxVer());
+}
+
+// Record 2: satu byte nama dibalik (CRC salah); record 7 = salinan record 0
+static void corrupt() {
+  hostFsRoot = FS;
+  DbRecord r0, r2;
+  File f = LittleFS.open(USERS_DB, "r");
+  f.seek(recAt(0)); f.read((uint8_t*)&r0, sizeof(r0));
+  f.seek(recAt(2)); f.read((uint8_t*)&r2, sizeof(r2));
+  f.close();
+  std::set<std::string> want = expected();
+  User bad = r2.u;
+  bad.name[NAME_SIZE - 1] = '\0';
+  want.erase(line(bad));
+  DbRecord hit;                                    // record 7 asli, tertimpa
+  f = LittleFS.open(USERS_DB, "r");
+  f.seek(recAt(7)); f.read((uint8_t*)&hit, sizeof(hit));
+  f.close();
+  hit.u.name[NAME_SIZE - 1] = '\0';
+  want.erase(line(hit.u));
+  r2.u.name[0] ^= 0x01;
+  poke(recAt(2), &r2, sizeof(r2));
+  poke(recAt(7), &r0, sizeof(r0));
+
+  std::ofstream o(EXPECT);
+  for (const std::string& l : want) o << l << '\n';
+}
+
+static void afterCorrupt() {
+  hostBoot(FS, false);
+  CHECK(userDb.count() == USERS - 3);
+  CHECK(current() == expected());
+  CHECK(header().count == USERS - 3);              // dipadatkan + header ditulis ulang
+}
+
+// Header menyebut lebih banyak record dari isi file (terpotong di tengah record)
+static void truncated() {
+  hostFsRoot = FS;
+  File f = LittleFS.open(USERS_DB, "r");
+  std::string all;
+  uint8_t b[256];
+  for (size_t k; (k = f.read(b, sizeof(b))) > 0; ) all.append((const char*)b, k);
+  f.close();
+  size_t keep = recAt(USERS - 3) - sizeof(DbRecord) / 2;
+  f = LittleFS.open(USERS_DB, "w");
+  f.write((const uint8_t*)all.data(), keep);
+  f.close();
+}
+
+static void afterTruncate() {
+  hostBoot(FS, false);
+  CHECK(userDb.count() == USERS - 4);
+  CHECK(header().count == USERS - 4);
+}
+
+static void badHeader() {
+  hostFsRoot = FS;
+  DbHeader h = header();
+  h.crc ^= 1;
+  poke(0, &h, sizeof(h));
+}
+
+static void afterBadHeader() {
+  hostBoot(FS, false);
+  CHECK(userDb.count() == 0);
+  DbHeader h = header();
+  CHECK(h.magic == DB_MAGIC && h.count == 0 && h.crc == crc32(&h, offsetof(DbHeader, crc)));
+}
+
+// users.bin v2 ditulis tangan → dimigrasi saat boot
+static void writeV2() {
+  hostFsRoot = FS;
+  LittleFS.format();
+  File f = LittleFS.open(USERS_DB, "w");
+  DbHeader h = { DB_MAGIC, 2, (uint16_t)sizeof(DbRecordV2), 3, 0 };
+  h.crc = crc32(&h, offsetof(DbHeader, crc));
+  f.write((const uint8_t*)&h, sizeof(h));
+  for (uint8_t i = 0; i < 3; i++) {
+    DbRecordV2 r;
+    memset(&r, 0, sizeof(r));
+    r.uidLen = 7;
+    for (uint8_t k = 0; k < 7; k++) r.uid[k] = (uint8_t)(0x40 + i + k);
+    snprintf(r.name, NAME_SIZE, "Lama %u", i);
+    r.crc = crc32(&r, UID_MAX + 1 + NAME_SIZE);
+    f.write((const uint8_t*)&r, sizeof(r));
+  }
+  f.close();
+}
+
+static void afterV2() {
+  hostBoot(FS, false);
+  CHECK(userDb.count() == 3);
+  DbHeader h = header();
+  CHECK(h.version == DB_VERSION && h.recSize == sizeof(DbRecord) && h.count == 3);
+  User u;
+  CHECK(userDb.read(1, u));
+  CHECK(u.uidLen == 7 && u.uid[0] == 0x41 && !strcmp(u.name, "Lama 1") && u.ver == 0 && u.origin == 0);
+}
+
+int main() {
+  CHECK(hostFork(fill) == 0);
+  CHECK(hostFork(roundTrip) == 0);
+  CHECK(hostFork(corrupt) == 0);
+  CHECK(hostFork(afterCorrupt) == 0);
+  CHECK(hostFork(afterCorrupt) == 0);              // boot berikutnya stabil
+  CHECK(hostFork(truncated) == 0);
+  CHECK(hostFork(afterTruncate) == 0);
+  CHECK(hostFork(badHeader) == 0);
+  CHECK(hostFork(afterBadHeader) == 0);
+  CHECK(hostFork(writeV2) == 0);
+  CHECK(hostFork(afterV2) == 0);
+  printf("users_test OK\n");
+  return 0;
+}